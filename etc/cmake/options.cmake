@@ -31,6 +31,8 @@ find_package(PkgConfig)
 
 option(OTBR_DOC "Build documentation" OFF)
 
+option(OTBR_BENCHMARK "Build benchmarks" OFF)
+
 if (OTBR_MDNS STREQUAL "mDNSResponder")
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MDNS_MDNSSD=1)
 elseif (OTBR_MDNS STREQUAL "openthread")
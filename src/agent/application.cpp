@@ -76,9 +76,10 @@ Application::Application(Host::ThreadHost  &aHost,
 #if OTBR_ENABLE_BORDER_AGENT_MESHCOP_SERVICE
     , mBorderAgent(*mPublisher)
 #endif
-    , mBorderAgentUdpProxy(mHost)
+    , mUdpProxy(mHost)
+    , mBorderAgentThreadPort(0)
 #if OTBR_ENABLE_EPSKC
-    , mEphemeralKeyUdpProxy(mHost)
+    , mEphemeralKeyThreadPort(0)
 #endif
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
@@ -102,6 +103,45 @@ Application::Application(Host::ThreadHost  &aHost,
     }
 }
 
+void Application::SetNetifDatapathThreadEnabled(bool aEnabled)
+{
+    if (mNetif != nullptr)
+    {
+        mNetif->SetDatapathThreadEnabled(aEnabled);
+    }
+}
+
+void Application::SetNetifIp6SendBatchSize(size_t aBatchSize)
+{
+    if (mNetif != nullptr)
+    {
+        mNetif->SetIp6SendBatchSize(aBatchSize);
+    }
+}
+
+void Application::SetMulticastForwardingCacheCapacity(uint32_t aCapacity)
+{
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    if (mMulticastRoutingManager != nullptr)
+    {
+        mMulticastRoutingManager->SetMfcCapacity(aCapacity);
+    }
+#else
+    OTBR_UNUSED_VARIABLE(aCapacity);
+#endif
+}
+
+#if __linux__
+void Application::SetInfraLinkSelector(const Utils::InfraLinkSelector &aInfraLinkSelector)
+{
+#if OTBR_ENABLE_DBUS_SERVER
+    mDBusAgent.SetInfraLinkSelector(aInfraLinkSelector);
+#else
+    OTBR_UNUSED_VARIABLE(aInfraLinkSelector);
+#endif
+}
+#endif
+
 void Application::Init(const std::string &aRestListenAddress, int aRestListenPort)
 {
     CoprocessorType type;
@@ -439,6 +479,9 @@ void Application::InitNcpMode(void)
         mInfraIf->SetInfraIf(mBackboneInterfaceName);
     }
     ncpHost.InitInfraIfCallbacks(*mInfraIf);
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    ncpHost.SetMulticastRoutingManager(*mMulticastRoutingManager);
+#endif
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mMdnsStateSubject.AddObserver(ncpHost);
@@ -457,17 +500,21 @@ void Application::InitNcpMode(void)
 #if OTBR_ENABLE_BORDER_AGENT
     mHost.SetBorderAgentMeshCoPServiceChangedCallback(
         [this](bool aIsActive, uint16_t aPort, const uint8_t *aTxtData, uint16_t aLength) {
-            if (!aIsActive)
-            {
-                mBorderAgentUdpProxy.Stop();
-            }
-            else
+            // The proxied ports are reference counted, so a port is only started when it changes.
+            if (!aIsActive || aPort != mBorderAgentThreadPort)
             {
-                mBorderAgentUdpProxy.Start(aPort);
+                mUdpProxy.Stop(mBorderAgentThreadPort);
+                mBorderAgentThreadPort = 0;
+
+                if (aIsActive && mUdpProxy.Start(aPort) == OTBR_ERROR_NONE)
+                {
+                    mBorderAgentThreadPort = aPort;
+                }
             }
 #if OTBR_ENABLE_BORDER_AGENT_MESHCOP_SERVICE
-            mBorderAgent.HandleBorderAgentMeshCoPServiceChanged(aIsActive, mBorderAgentUdpProxy.GetHostPort(),
-                                                                std::vector<uint8_t>(aTxtData, aTxtData + aLength));
+            mBorderAgent.HandleBorderAgentMeshCoPServiceChanged(
+                aIsActive, mUdpProxy.GetHostPort(mBorderAgentThreadPort),
+                std::vector<uint8_t>(aTxtData, aTxtData + aLength));
 #else
             OTBR_UNUSED_VARIABLE(aTxtData);
             OTBR_UNUSED_VARIABLE(aLength);
@@ -475,31 +522,32 @@ void Application::InitNcpMode(void)
         });
     mHost.SetUdpForwardToHostCallback([this](const uint8_t *aUdpPayload, uint16_t aLength,
                                              const otIp6Address &aPeerAddr, uint16_t aPeerPort, uint16_t aLocalPort) {
-        if (aLocalPort == mBorderAgentUdpProxy.GetThreadPort())
-        {
-            mBorderAgentUdpProxy.SendToPeer(aUdpPayload, aLength, aPeerAddr, aPeerPort);
-        }
-#if OTBR_ENABLE_EPSKC
-        else if (aLocalPort == mEphemeralKeyUdpProxy.GetThreadPort())
-        {
-            mEphemeralKeyUdpProxy.SendToPeer(aUdpPayload, aLength, aPeerAddr, aPeerPort);
-        }
-#endif // OTBR_ENABLE_EPSKC
+        mUdpProxy.SendToPeer(aUdpPayload, aLength, aPeerAddr, aPeerPort, aLocalPort);
     });
 #if OTBR_ENABLE_EPSKC
     mHost.AddEphemeralKeyStateChangedCallback([this](otBorderAgentEphemeralKeyState aState, uint16_t aPort) {
         if (aState == OT_BORDER_AGENT_STATE_STARTED)
         {
             otbrLogInfo("Border Agent Ephemeral Key State Changed: Active on port %d", aPort);
-            mEphemeralKeyUdpProxy.Start(aPort);
+            if (aPort != mEphemeralKeyThreadPort)
+            {
+                mUdpProxy.Stop(mEphemeralKeyThreadPort);
+                mEphemeralKeyThreadPort = 0;
+
+                if (mUdpProxy.Start(aPort) == OTBR_ERROR_NONE)
+                {
+                    mEphemeralKeyThreadPort = aPort;
+                }
+            }
         }
         else if (aState == OT_BORDER_AGENT_STATE_STOPPED || aState == OT_BORDER_AGENT_STATE_DISABLED)
         {
             otbrLogInfo("Border Agent Ephemeral Key State Changed: Inactive");
-            mEphemeralKeyUdpProxy.Stop();
+            mUdpProxy.Stop(mEphemeralKeyThreadPort);
+            mEphemeralKeyThreadPort = 0;
         }
 #if OTBR_ENABLE_BORDER_AGENT_MESHCOP_SERVICE
-        mBorderAgent.HandleEpskcStateChanged(aState, mEphemeralKeyUdpProxy.GetHostPort());
+        mBorderAgent.HandleEpskcStateChanged(aState, mUdpProxy.GetHostPort(mEphemeralKeyThreadPort));
 #endif // OTBR_ENABLE_BORDER_AGENT_MESHCOP_SERVICE
     });
 #endif // OTBR_ENABLE_EPSKC
@@ -527,7 +575,11 @@ void Application::DeinitNcpMode(void)
 #if OTBR_ENABLE_BORDER_AGENT
     mBorderAgent.SetEnabled(false);
     mBorderAgent.Deinit();
-    mBorderAgentUdpProxy.Stop();
+    mUdpProxy.Stop();
+    mBorderAgentThreadPort = 0;
+#if OTBR_ENABLE_EPSKC
+    mEphemeralKeyThreadPort = 0;
+#endif
 #endif
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mPublisher->Stop();
@@ -554,7 +606,10 @@ DBus::DependentComponents Application::MakeDBusDependentComponents(void)
 {
     return DBus::DependentComponents{mHost, *mPublisher,
 #if OTBR_ENABLE_BORDER_AGENT
-                                     mBorderAgent
+                                     mBorderAgent,
+#endif
+#if __linux__
+                                     /* aInfraLinkSelector */ nullptr,
 #endif
     };
 }
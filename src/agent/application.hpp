@@ -44,6 +44,7 @@
 #if OTBR_ENABLE_BORDER_AGENT
 #include "border_agent/border_agent.hpp"
 #endif
+#include "common/log_rate_limiter.hpp"
 #include "host/ncp_host.hpp"
 #include "host/rcp_host.hpp"
 #if OTBR_ENABLE_BACKBONE_ROUTER
@@ -122,6 +123,44 @@ public:
      */
     void Init(const std::string &aRestListenAddress, int aRestListenPort);
 
+    /**
+     * This method enables or disables the datapath thread of the Thread network interface.
+     *
+     * It only takes effect in NCP mode and must be called before `Init()`.
+     *
+     * @param[in] aEnabled  TRUE to service the TUN device on a dedicated thread.
+     */
+    void SetNetifDatapathThreadEnabled(bool aEnabled);
+
+    /**
+     * This method sets the maximum number of packets read from the Thread network interface per mainloop wakeup.
+     *
+     * It only takes effect in NCP mode.
+     *
+     * @param[in] aBatchSize  The budget, clamped to [1, Netif::kMaxIp6SendBatchSize].
+     */
+    void SetNetifIp6SendBatchSize(size_t aBatchSize);
+
+    /**
+     * This method sets the max number of Multicast Forwarding Cache entries of the Backbone Router.
+     *
+     * It only takes effect in NCP mode with the Backbone Router enabled and must be called before `Init()`.
+     *
+     * @param[in] aCapacity  The max number of MFC entries.
+     */
+    void SetMulticastForwardingCacheCapacity(uint32_t aCapacity);
+
+#if __linux__
+    /**
+     * This method sets the infrastructure link selector whose counters are reported in the telemetry data.
+     *
+     * This method must be called before `Init()`.
+     *
+     * @param[in] aInfraLinkSelector  The infrastructure link selector.
+     */
+    void SetInfraLinkSelector(const Utils::InfraLinkSelector &aInfraLinkSelector);
+#endif
+
     /**
      * This method de-initializes the Application instance.
      */
@@ -275,6 +314,7 @@ private:
     Host::ThreadHost        &mHost;
     std::unique_ptr<Netif>   mNetif;
     std::unique_ptr<InfraIf> mInfraIf;
+    LogSuppressionReporter   mLogSuppressionReporter;
 
 #if OTBR_ENABLE_MDNS
     Mdns::StateSubject               mMdnsStateSubject;
@@ -285,9 +325,10 @@ private:
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
     BorderAgent mBorderAgent;
-    UdpProxy    mBorderAgentUdpProxy;
+    UdpProxy    mUdpProxy;
+    uint16_t    mBorderAgentThreadPort; ///< The proxied Thread port of Border Agent, `0` if inactive.
 #if OTBR_ENABLE_EPSKC
-    UdpProxy mEphemeralKeyUdpProxy;
+    uint16_t mEphemeralKeyThreadPort; ///< The proxied Thread port of ePSKc sessions, `0` if inactive.
 #endif
 
 #endif
@@ -36,6 +36,7 @@
 
 #include <assert.h>
 #include <getopt.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -86,6 +87,15 @@ enum
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
     OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_ASYNC_LOG,
+    OTBR_OPT_FLIGHT_RECORDER,
+    OTBR_OPT_DATAPATH_THREAD,
+    OTBR_OPT_IP6_SEND_BATCH_SIZE,
+    OTBR_OPT_MFC_CAPACITY,
+#if __linux__
+    OTBR_OPT_INFRA_LINK_DOWN_DELAY,
+    OTBR_OPT_INFRA_LINK_UP_DELAY,
+#endif
 #ifndef OTBR_VENDOR_NAME
     OTBR_OPT_VENDOR_NAME,
 #endif
@@ -113,6 +123,15 @@ static const struct option kOptions[] = {
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
     {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"async-log", no_argument, nullptr, OTBR_OPT_ASYNC_LOG},
+    {"flight-recorder", optional_argument, nullptr, OTBR_OPT_FLIGHT_RECORDER},
+    {"datapath-thread", no_argument, nullptr, OTBR_OPT_DATAPATH_THREAD},
+    {"ip6-send-batch-size", required_argument, nullptr, OTBR_OPT_IP6_SEND_BATCH_SIZE},
+    {"mfc-capacity", required_argument, nullptr, OTBR_OPT_MFC_CAPACITY},
+#if __linux__
+    {"infra-link-down-delay", required_argument, nullptr, OTBR_OPT_INFRA_LINK_DOWN_DELAY},
+    {"infra-link-up-delay", required_argument, nullptr, OTBR_OPT_INFRA_LINK_UP_DELAY},
+#endif
 #ifndef OTBR_VENDOR_NAME
     {"vendor-name", required_argument, nullptr, OTBR_OPT_VENDOR_NAME},
 #endif
@@ -171,6 +190,13 @@ static void PrintHelp(const char *aProgramName)
             "DEBUG=7).\n"
             "     -v, --verbose          Enable verbose logging.\n"
             "     -s, --syslog-disable   Disable syslog and print to standard error.\n"
+            "         --async-log        Write syslog on a background thread.\n"
+            "         --flight-recorder  Keep recent logs up to the given level (default: INFO=6) in memory, dumped on\n"
+            "                            fatal errors.\n"
+            "         --datapath-thread  Forward the IPv6 packets of the Thread interface on a dedicated thread.\n"
+            "         --ip6-send-batch-size  Max IPv6 packets read from the Thread interface per wakeup (1-64,\n"
+            "                            default: 16).\n"
+            "         --mfc-capacity     Max number of multicast forwarding cache entries of the Backbone Router.\n"
             "     -h, --help             Show this help text.\n"
             "     -V, --version          Print the application's version and exit.\n"
             "     --radio-version        Print the radio coprocessor version and exit.\n"
@@ -179,6 +205,14 @@ static void PrintHelp(const char *aProgramName)
             "     --rest-listen-port     Network port to listen on for the REST API "
             "(default: " HELP_DEFAULT_REST_PORT_NUMBER ").\n",
             aProgramName);
+#if __linux__
+    fprintf(stderr,
+            "     --infra-link-down-delay\n"
+            "                            Milliseconds the selected backbone interface may stay not running before\n"
+            "                            switching to another one (default: 10000).\n"
+            "     --infra-link-up-delay  Milliseconds another backbone interface must have been running before\n"
+            "                            switching to it (default: 0).\n");
+#endif
 #ifndef OTBR_VENDOR_NAME
     fprintf(stderr, "     --vendor-name          Vendor Name.\n");
 #endif
@@ -244,18 +278,28 @@ static int realmain(int argc, char *argv[])
 {
     otbrLogLevel              logLevel = GetDefaultLogLevel();
     int                       opt;
-    int                       ret               = EXIT_SUCCESS;
-    const char               *interfaceName     = kDefaultInterfaceName;
-    bool                      verbose           = false;
-    bool                      syslogDisable     = false;
-    bool                      printRadioVersion = false;
-    bool                      enableAutoAttach  = true;
-    const char               *restListenAddress = "127.0.0.1";
-    int                       restListenPort    = kPortNumber;
-    const char               *dataPath          = "";
+    int                       ret                 = EXIT_SUCCESS;
+    const char               *interfaceName       = kDefaultInterfaceName;
+    bool                      verbose             = false;
+    bool                      syslogDisable       = false;
+    bool                      asyncLog            = false;
+    bool                      flightRecorder      = false;
+    otbrLogLevel              flightRecorderLevel = OTBR_LOG_INFO;
+    bool                      datapathThread      = false;
+    uint32_t                  ip6SendBatchSize    = 0;
+    uint32_t                  mfcCapacity         = 0;
+    bool                      printRadioVersion   = false;
+    bool                      enableAutoAttach    = true;
+    const char               *restListenAddress   = "127.0.0.1";
+    int                       restListenPort      = kPortNumber;
+    const char               *dataPath            = "";
     std::vector<const char *> radioUrls;
     std::vector<const char *> backboneInterfaceNames;
     long                      parseResult;
+#if __linux__
+    otbr::Milliseconds infraLinkDownDelay = otbr::Utils::InfraLinkSelector::kDefaultDownDelay;
+    otbr::Milliseconds infraLinkUpDelay   = otbr::Utils::InfraLinkSelector::kDefaultUpDelay;
+#endif
 
 #ifdef OTBR_VENDOR_NAME
     const char *vendorName = OTBR_VENDOR_NAME;
@@ -331,6 +375,50 @@ static int realmain(int argc, char *argv[])
             VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
             restListenPort = parseResult;
             break;
+
+        case OTBR_OPT_ASYNC_LOG:
+            asyncLog = true;
+            break;
+
+        case OTBR_OPT_FLIGHT_RECORDER:
+            flightRecorder = true;
+            if (optarg != nullptr)
+            {
+                VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+                VerifyOrExit(OTBR_LOG_EMERG <= parseResult && parseResult <= OTBR_LOG_DEBUG, ret = EXIT_FAILURE);
+                flightRecorderLevel = static_cast<otbrLogLevel>(parseResult);
+            }
+            break;
+
+        case OTBR_OPT_DATAPATH_THREAD:
+            datapathThread = true;
+            break;
+
+        case OTBR_OPT_IP6_SEND_BATCH_SIZE:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 < parseResult && parseResult <= static_cast<long>(otbr::Netif::kMaxIp6SendBatchSize),
+                         ret = EXIT_FAILURE);
+            ip6SendBatchSize = static_cast<uint32_t>(parseResult);
+            break;
+
+        case OTBR_OPT_MFC_CAPACITY:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 < parseResult && parseResult <= UINT16_MAX, ret = EXIT_FAILURE);
+            mfcCapacity = static_cast<uint32_t>(parseResult);
+            break;
+#if __linux__
+        case OTBR_OPT_INFRA_LINK_DOWN_DELAY:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 <= parseResult && parseResult <= INT32_MAX, ret = EXIT_FAILURE);
+            infraLinkDownDelay = otbr::Milliseconds(parseResult);
+            break;
+
+        case OTBR_OPT_INFRA_LINK_UP_DELAY:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 <= parseResult && parseResult <= INT32_MAX, ret = EXIT_FAILURE);
+            infraLinkUpDelay = otbr::Milliseconds(parseResult);
+            break;
+#endif
 #ifndef OTBR_VENDOR_NAME
         case OTBR_OPT_VENDOR_NAME:
             vendorName = optarg;
@@ -368,6 +456,9 @@ static int realmain(int argc, char *argv[])
 #endif
 
     otbrLogInit(argv[0], logLevel, verbose, syslogDisable);
+    otbrLogAsyncSetEnabled(asyncLog);
+    otbrLogFlightRecorderSetLevel(flightRecorderLevel);
+    otbrLogFlightRecorderSetEnabled(flightRecorder);
     otbrLogNotice("Running %s", OTBR_PACKAGE_VERSION);
     otbrLogNotice("Thread version: %s", otbr::Host::RcpHost::GetThreadVersion());
     otbrLogNotice("Thread interface: %s", interfaceName);
@@ -391,7 +482,10 @@ static int realmain(int argc, char *argv[])
 
     {
 #if __linux__
-        otbr::Utils::InfraLinkSelector    infraLinkSelector(backboneInterfaceNames);
+        otbr::Utils::InfraLinkSelector infraLinkSelector(backboneInterfaceNames);
+
+        infraLinkSelector.SetHysteresis(infraLinkDownDelay, infraLinkUpDelay);
+
         const std::string                 backboneInterfaceName = infraLinkSelector.Select();
         otbr::Application::ErrorCondition errorCondition        = [&backboneInterfaceName, &infraLinkSelector](void) {
             return std::string(infraLinkSelector.Select()) == backboneInterfaceName ? OTBR_ERROR_NONE
@@ -422,6 +516,18 @@ static int realmain(int argc, char *argv[])
 #endif
 #endif
 
+#if __linux__
+        app.SetInfraLinkSelector(infraLinkSelector);
+#endif
+        app.SetNetifDatapathThreadEnabled(datapathThread);
+        if (ip6SendBatchSize != 0)
+        {
+            app.SetNetifIp6SendBatchSize(ip6SendBatchSize);
+        }
+        if (mfcCapacity != 0)
+        {
+            app.SetMulticastForwardingCacheCapacity(mfcCapacity);
+        }
         app.Init(restListenAddress, restListenPort);
 
 #ifndef OTBR_VENDOR_NAME
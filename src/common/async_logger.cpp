@@ -0,0 +1,301 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the asynchronous logger which writes logs on a background thread.
+ */
+
+#include "common/async_logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <string.h>
+
+namespace otbr {
+
+constexpr size_t AsyncLogger::kMaxLineLength;
+constexpr size_t AsyncLogger::kRingCapacity;
+constexpr size_t AsyncLogger::kMaxRings;
+
+std::atomic<uint64_t> AsyncLogger::sNextId{1};
+
+/**
+ * This class holds the ring of a producer thread.
+ *
+ * The ring is marked as orphaned when the thread exits so that the background
+ * thread releases it once all its lines are written.
+ */
+class AsyncLogger::RingHandle
+{
+public:
+    ~RingHandle(void) { Reset(0); }
+
+    void Reset(uint64_t aLoggerId)
+    {
+        if (mRing != nullptr)
+        {
+            mRing->mOrphaned.store(true);
+            mRing.reset();
+        }
+
+        mLoggerId = aLoggerId;
+    }
+
+    uint64_t              mLoggerId = 0;
+    std::shared_ptr<Ring> mRing;
+};
+
+AsyncLogger::AsyncLogger(Sink aSink)
+    : mId(sNextId.fetch_add(1))
+    , mSink(std::move(aSink))
+    , mWritten(0)
+    , mDropped(0)
+    , mTruncated(0)
+    , mFlushRequests(0)
+    , mFlushesDone(0)
+    , mSleeping(false)
+    , mStopped(false)
+    , mThread(&AsyncLogger::Run, this)
+{
+}
+
+AsyncLogger::~AsyncLogger(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopped = true;
+    }
+
+    mCondition.notify_one();
+    mThread.join();
+}
+
+bool AsyncLogger::Write(otbrLogLevel aLevel, const char *aLine)
+{
+    Ring    *ring = GetRing();
+    uint32_t tail;
+    size_t   length;
+
+    VerifyOrExit(ring != nullptr);
+
+    tail = ring->mTail.load(std::memory_order_relaxed);
+
+    if (tail - ring->mHead.load(std::memory_order_acquire) >= kRingCapacity)
+    {
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+        ExitNow();
+    }
+
+    {
+        Entry &entry = ring->mEntries[tail % kRingCapacity];
+
+        length = strlen(aLine);
+
+        if (length >= kMaxLineLength)
+        {
+            length = kMaxLineLength - 1;
+            mTruncated.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        memcpy(entry.mLine, aLine, length);
+        entry.mLine[length] = '\0';
+        entry.mLevel        = aLevel;
+    }
+
+    // Publishes the entry. Must be sequentially consistent with the load of
+    // `mSleeping` so that either this thread or the background thread observes
+    // the other's update.
+    ring->mTail.store(tail + 1);
+
+    if (mSleeping.load())
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mCondition.notify_one();
+    }
+
+exit:
+    return ring != nullptr;
+}
+
+void AsyncLogger::Flush(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    uint64_t                     target = mFlushRequests.fetch_add(1) + 1;
+
+    mCondition.notify_one();
+    mFlushCondition.wait(lock, [this, target]() { return mFlushesDone.load() >= target; });
+}
+
+AsyncLogger::Counters AsyncLogger::GetCounters(void) const
+{
+    Counters counters;
+
+    counters.mWritten   = mWritten.load(std::memory_order_relaxed);
+    counters.mDropped   = mDropped.load(std::memory_order_relaxed);
+    counters.mTruncated = mTruncated.load(std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        counters.mRings = static_cast<uint32_t>(mRings.size());
+    }
+
+    return counters;
+}
+
+AsyncLogger::Ring *AsyncLogger::GetRing(void)
+{
+    static thread_local RingHandle sHandle;
+
+    if (sHandle.mLoggerId != mId)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        sHandle.Reset(mId);
+
+        // A thread which finds no ring available keeps logging synchronously.
+        if (!mStopped && mRings.size() < kMaxRings)
+        {
+            sHandle.mRing = std::make_shared<Ring>();
+            mRings.push_back(sHandle.mRing);
+        }
+    }
+
+    return sHandle.mRing.get();
+}
+
+bool AsyncLogger::DrainRings(void)
+{
+    std::vector<std::shared_ptr<Ring>> rings;
+    bool                               drained = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        rings = mRings;
+    }
+
+    for (const std::shared_ptr<Ring> &ring : rings)
+    {
+        uint32_t head = ring->mHead.load(std::memory_order_relaxed);
+        uint32_t tail = ring->mTail.load(std::memory_order_acquire);
+
+        for (; head != tail; head++)
+        {
+            const Entry &entry = ring->mEntries[head % kRingCapacity];
+
+            mSink(entry.mLevel, entry.mLine);
+            mWritten.fetch_add(1, std::memory_order_relaxed);
+            ring->mHead.store(head + 1, std::memory_order_release);
+            drained = true;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mRings.erase(std::remove_if(mRings.begin(), mRings.end(),
+                                    [](const std::shared_ptr<Ring> &aRing) {
+                                        return aRing->mOrphaned.load() && aRing->mHead.load() == aRing->mTail.load();
+                                    }),
+                     mRings.end());
+    }
+
+    return drained;
+}
+
+bool AsyncLogger::HasPendingLines(void)
+{
+    bool hasPending = false;
+
+    for (const std::shared_ptr<Ring> &ring : mRings)
+    {
+        if (ring->mHead.load() != ring->mTail.load())
+        {
+            hasPending = true;
+            break;
+        }
+    }
+
+    return hasPending;
+}
+
+void AsyncLogger::Run(void)
+{
+    // The sleeping background thread is always woken up by producers, the
+    // interval only bounds the delay of releasing rings of exited threads.
+    const std::chrono::milliseconds kDrainInterval(100);
+
+    while (true)
+    {
+        uint64_t flushRequests = mFlushRequests.load();
+        bool     stopped;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            stopped = mStopped;
+        }
+
+        while (DrainRings())
+        {
+        }
+
+        if (mFlushesDone.load() != flushRequests)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mFlushesDone.store(flushRequests);
+            mFlushCondition.notify_all();
+        }
+
+        if (stopped)
+        {
+            break;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mSleeping.store(true);
+
+            if (!mStopped && !HasPendingLines() && mFlushRequests.load() == flushRequests)
+            {
+                mCondition.wait_for(lock, kDrainInterval);
+            }
+
+            mSleeping.store(false);
+        }
+    }
+}
+
+} // namespace otbr
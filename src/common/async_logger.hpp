@@ -0,0 +1,169 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the asynchronous logger which writes logs on a background thread.
+ */
+
+#ifndef OTBR_COMMON_ASYNC_LOGGER_HPP_
+#define OTBR_COMMON_ASYNC_LOGGER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements an asynchronous logger.
+ *
+ * Each producer thread appends formatted log lines to its own lock-free ring, and a
+ * background thread drains all rings to the sink. Producers never block on the sink:
+ * a line is dropped and counted when the ring of the thread is full. The memory is
+ * bounded by `kMaxRings` rings of `kRingCapacity` lines of at most `kMaxLineLength`
+ * bytes each.
+ */
+class AsyncLogger : private NonCopyable
+{
+public:
+    static constexpr size_t kMaxLineLength = 384; ///< The maximum length of a log line, including the null character.
+    static constexpr size_t kRingCapacity  = 64;  ///< The number of log lines buffered per thread.
+    static constexpr size_t kMaxRings      = 16;  ///< The maximum number of producer threads with a ring.
+
+    /**
+     * This type represents the sink which the background thread writes log lines to.
+     */
+    typedef std::function<void(otbrLogLevel aLevel, const char *aLine)> Sink;
+
+    /**
+     * This structure represents the counters of the asynchronous logger.
+     */
+    struct Counters
+    {
+        uint64_t mWritten;   ///< The number of log lines written to the sink.
+        uint64_t mDropped;   ///< The number of log lines dropped because the ring was full.
+        uint64_t mTruncated; ///< The number of log lines truncated to `kMaxLineLength`.
+        uint32_t mRings;     ///< The number of rings currently allocated.
+    };
+
+    /**
+     * This constructor initializes the asynchronous logger and starts the background thread.
+     *
+     * @param[in] aSink  The sink to write log lines to. It's only invoked on the background thread.
+     */
+    explicit AsyncLogger(Sink aSink);
+
+    /**
+     * This destructor writes all buffered log lines to the sink and stops the background thread.
+     */
+    ~AsyncLogger(void);
+
+    /**
+     * This method appends a log line to the ring of the calling thread.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aLevel  The log level.
+     * @param[in] aLine   The null-terminated log line.
+     *
+     * @retval TRUE   The log line was buffered or dropped (and counted).
+     * @retval FALSE  There is no ring available for the calling thread, the caller should log synchronously.
+     */
+    bool Write(otbrLogLevel aLevel, const char *aLine);
+
+    /**
+     * This method blocks until all log lines buffered before the call are written to the sink.
+     *
+     * This method must not be called on the background thread.
+     */
+    void Flush(void);
+
+    /**
+     * This method returns the counters of the asynchronous logger.
+     *
+     * @returns The counters.
+     */
+    Counters GetCounters(void) const;
+
+private:
+    struct Entry
+    {
+        otbrLogLevel mLevel;
+        char         mLine[kMaxLineLength];
+    };
+
+    // A single-producer single-consumer ring of log lines.
+    struct Ring
+    {
+        Entry                 mEntries[kRingCapacity];
+        std::atomic<uint32_t> mHead{0}; // Only advanced by the background thread.
+        std::atomic<uint32_t> mTail{0}; // Only advanced by the producer thread.
+        std::atomic_bool      mOrphaned{false};
+    };
+
+    class RingHandle;
+
+    Ring *GetRing(void);
+    bool  DrainRings(void);
+    bool  HasPendingLines(void);
+    void  Run(void);
+
+    static std::atomic<uint64_t> sNextId;
+
+    const uint64_t mId;
+    Sink           mSink;
+
+    std::atomic<uint64_t> mWritten;
+    std::atomic<uint64_t> mDropped;
+    std::atomic<uint64_t> mTruncated;
+    std::atomic<uint64_t> mFlushRequests;
+    std::atomic<uint64_t> mFlushesDone;
+    std::atomic_bool      mSleeping;
+
+    // The mutex which protects `mRings` and `mStopped`.
+    mutable std::mutex                 mMutex;
+    std::condition_variable            mCondition;
+    std::condition_variable            mFlushCondition;
+    std::vector<std::shared_ptr<Ring>> mRings;
+    bool                               mStopped;
+    std::thread                        mThread;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_ASYNC_LOGGER_HPP_
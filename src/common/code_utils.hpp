@@ -152,6 +152,7 @@
         if (!(aCondition))                                                   \
         {                                                                    \
             otbrLogEmerg("FAILED %s:%d - %s", __FILE__, __LINE__, aMessage); \
+            otbrLogFlushOnFatal();                                           \
             exit(-1);                                                        \
         }                                                                    \
     } while (false)
@@ -165,6 +166,7 @@
     do                                                                   \
     {                                                                    \
         otbrLogEmerg("FAILED %s:%d - %s", __FILE__, __LINE__, aMessage); \
+        otbrLogFlushOnFatal();                                           \
         exit(-1);                                                        \
     } while (false)
 
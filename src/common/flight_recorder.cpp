@@ -0,0 +1,643 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the flight recorder.
+ */
+
+#include "common/flight_recorder.hpp"
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+constexpr size_t FlightRecorder::kNumRecords;
+constexpr size_t FlightRecorder::kMaxArgsSize;
+constexpr size_t FlightRecorder::kMaxStringArgLength;
+constexpr size_t FlightRecorder::kMaxFormatLength;
+
+namespace {
+
+const char kLevelString[][8] = {
+    "[EMERG]", "[ALERT]", "[CRIT]", "[ERR ]", "[WARN]", "[NOTE]", "[INFO]", "[DEBG]",
+};
+
+enum LengthModifier : uint8_t
+{
+    kLengthNone,
+    kLengthChar,       // hh
+    kLengthShort,      // h
+    kLengthLong,       // l
+    kLengthLongLong,   // ll
+    kLengthIntMax,     // j
+    kLengthSize,       // z
+    kLengthPtrDiff,    // t
+    kLengthLongDouble, // L
+};
+
+// The conversion specification of a format string, e.g. "%-8.*lx".
+struct ConversionSpec
+{
+    static constexpr size_t kMaxTextLength = 16;
+
+    char           mText[kMaxTextLength]; // The flags, width and precision, e.g. "%-8.*".
+    size_t         mFormatLength;         // The length of the whole specification in the format string.
+    uint8_t        mNumStars;             // The number of '*' for the width and the precision.
+    LengthModifier mLengthModifier;
+    char           mConversion;
+};
+
+constexpr size_t ConversionSpec::kMaxTextLength;
+
+const char *SkipFieldWidth(const char *aCur, uint8_t &aNumStars)
+{
+    if (*aCur == '*')
+    {
+        aNumStars++;
+        aCur++;
+    }
+    else
+    {
+        while (*aCur >= '0' && *aCur <= '9')
+        {
+            aCur++;
+        }
+    }
+
+    return aCur;
+}
+
+/**
+ * This function parses the conversion specification which starts at @p aFormat.
+ *
+ * @param[in]  aFormat  A pointer to the '%' character which starts the specification.
+ * @param[out] aSpec    A reference to where the parsed specification is stored.
+ *
+ * @retval TRUE   Successfully parsed the specification.
+ * @retval FALSE  The specification is malformed or too long.
+ */
+bool ParseConversionSpec(const char *aFormat, ConversionSpec &aSpec)
+{
+    const char *cur = aFormat + 1;
+    bool        ok  = false;
+    size_t      textLength;
+
+    aSpec.mNumStars       = 0;
+    aSpec.mLengthModifier = kLengthNone;
+
+    while (*cur != '\0' && strchr("-+ #0", *cur) != nullptr)
+    {
+        cur++;
+    }
+
+    cur = SkipFieldWidth(cur, aSpec.mNumStars);
+    if (*cur == '.')
+    {
+        cur = SkipFieldWidth(cur + 1, aSpec.mNumStars);
+    }
+
+    textLength = static_cast<size_t>(cur - aFormat);
+    VerifyOrExit(textLength < ConversionSpec::kMaxTextLength);
+    memcpy(aSpec.mText, aFormat, textLength);
+    aSpec.mText[textLength] = '\0';
+
+    switch (*cur)
+    {
+    case 'h':
+        aSpec.mLengthModifier = (cur[1] == 'h') ? kLengthChar : kLengthShort;
+        break;
+    case 'l':
+        aSpec.mLengthModifier = (cur[1] == 'l') ? kLengthLongLong : kLengthLong;
+        break;
+    case 'j':
+        aSpec.mLengthModifier = kLengthIntMax;
+        break;
+    case 'z':
+        aSpec.mLengthModifier = kLengthSize;
+        break;
+    case 't':
+        aSpec.mLengthModifier = kLengthPtrDiff;
+        break;
+    case 'L':
+        aSpec.mLengthModifier = kLengthLongDouble;
+        break;
+    default:
+        break;
+    }
+
+    if (aSpec.mLengthModifier == kLengthChar || aSpec.mLengthModifier == kLengthLongLong)
+    {
+        cur += 2;
+    }
+    else if (aSpec.mLengthModifier != kLengthNone)
+    {
+        cur += 1;
+    }
+
+    VerifyOrExit(*cur != '\0');
+    aSpec.mConversion   = *cur;
+    aSpec.mFormatLength = static_cast<size_t>(cur - aFormat) + 1;
+    ok                  = true;
+
+exit:
+    return ok;
+}
+
+template <typename ValueType> bool PutArg(uint8_t *aArgs, uint8_t &aLength, const ValueType &aValue)
+{
+    bool ok = (aLength + sizeof(ValueType) <= FlightRecorder::kMaxArgsSize);
+
+    if (ok)
+    {
+        memcpy(&aArgs[aLength], &aValue, sizeof(ValueType));
+        aLength += sizeof(ValueType);
+    }
+
+    return ok;
+}
+
+bool PutStringArg(uint8_t *aArgs, uint8_t &aLength, const char *aString)
+{
+    size_t length;
+    bool   ok = (aLength < FlightRecorder::kMaxArgsSize);
+
+    VerifyOrExit(ok);
+
+    aString = (aString != nullptr) ? aString : "(null)";
+    length  = strnlen(aString, FlightRecorder::kMaxStringArgLength);
+    length  = std::min(length, FlightRecorder::kMaxArgsSize - aLength - 1);
+
+    aArgs[aLength++] = static_cast<uint8_t>(length);
+    memcpy(&aArgs[aLength], aString, length);
+    aLength += length;
+
+exit:
+    return ok;
+}
+
+template <typename ValueType> bool GetArg(const uint8_t *aArgs, uint8_t aLength, size_t &aOffset, ValueType &aValue)
+{
+    bool ok = (aOffset + sizeof(ValueType) <= aLength);
+
+    if (ok)
+    {
+        memcpy(&aValue, &aArgs[aOffset], sizeof(ValueType));
+        aOffset += sizeof(ValueType);
+    }
+
+    return ok;
+}
+
+template <typename ValueType>
+void AppendFormatted(std::string     &aOutput,
+                     const char      *aSpec,
+                     const int64_t (&aStars)[2],
+                     uint8_t          aNumStars,
+                     const ValueType &aValue)
+{
+    char buffer[128];
+    int  length = -1;
+
+    switch (aNumStars)
+    {
+    case 0:
+        length = snprintf(buffer, sizeof(buffer), aSpec, aValue);
+        break;
+    case 1:
+        length = snprintf(buffer, sizeof(buffer), aSpec, static_cast<int>(aStars[0]), aValue);
+        break;
+    default:
+        length = snprintf(buffer, sizeof(buffer), aSpec, static_cast<int>(aStars[0]), static_cast<int>(aStars[1]),
+                          aValue);
+        break;
+    }
+
+    if (length > 0)
+    {
+        aOutput.append(buffer, std::min(static_cast<size_t>(length), sizeof(buffer) - 1));
+    }
+}
+
+/**
+ * This function formats one argument of a record.
+ *
+ * @retval TRUE   Successfully formatted the argument.
+ * @retval FALSE  The argument was not recorded.
+ */
+bool AppendArg(std::string          &aOutput,
+               const ConversionSpec &aSpec,
+               const uint8_t        *aArgs,
+               uint8_t               aLength,
+               size_t               &aOffset)
+{
+    char    spec[ConversionSpec::kMaxTextLength + 4]; // Room for the "ll" length modifier and the conversion.
+    int64_t stars[2] = {0, 0};
+    bool    ok       = true;
+
+    for (uint8_t i = 0; i < aSpec.mNumStars; i++)
+    {
+        VerifyOrExit(ok = GetArg(aArgs, aLength, aOffset, stars[i]));
+    }
+
+    switch (aSpec.mConversion)
+    {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    {
+        bool isSigned = (aSpec.mConversion == 'd' || aSpec.mConversion == 'i');
+
+        snprintf(spec, sizeof(spec), "%sll%c", aSpec.mText, aSpec.mConversion);
+        if (isSigned)
+        {
+            int64_t value;
+
+            VerifyOrExit(ok = GetArg(aArgs, aLength, aOffset, value));
+            AppendFormatted(aOutput, spec, stars, aSpec.mNumStars, static_cast<long long>(value));
+        }
+        else
+        {
+            uint64_t value;
+
+            VerifyOrExit(ok = GetArg(aArgs, aLength, aOffset, value));
+            AppendFormatted(aOutput, spec, stars, aSpec.mNumStars, static_cast<unsigned long long>(value));
+        }
+        break;
+    }
+
+    case 'c':
+    {
+        int64_t value;
+
+        VerifyOrExit(ok = GetArg(aArgs, aLength, aOffset, value));
+        snprintf(spec, sizeof(spec), "%sc", aSpec.mText);
+        AppendFormatted(aOutput, spec, stars, aSpec.mNumStars, static_cast<int>(value));
+        break;
+    }
+
+    case 'p':
+    {
+        uint64_t value;
+
+        VerifyOrExit(ok = GetArg(aArgs, aLength, aOffset, value));
+        snprintf(spec, sizeof(spec), "%sp", aSpec.mText);
+        AppendFormatted(aOutput, spec, stars, aSpec.mNumStars,
+                        reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+        break;
+    }
+
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+    {
+        double value;
+
+        VerifyOrExit(ok = GetArg(aArgs, aLength, aOffset, value));
+        snprintf(spec, sizeof(spec), "%s%c", aSpec.mText, aSpec.mConversion);
+        AppendFormatted(aOutput, spec, stars, aSpec.mNumStars, value);
+        break;
+    }
+
+    case 's':
+    {
+        uint8_t length;
+        char    value[FlightRecorder::kMaxStringArgLength + 1];
+
+        VerifyOrExit(ok = GetArg(aArgs, aLength, aOffset, length));
+        VerifyOrExit(length <= FlightRecorder::kMaxStringArgLength && aOffset + length <= aLength, ok = false);
+        memcpy(value, &aArgs[aOffset], length);
+        value[length] = '\0';
+        aOffset += length;
+
+        snprintf(spec, sizeof(spec), "%ss", aSpec.mText);
+        AppendFormatted(aOutput, spec, stars, aSpec.mNumStars, static_cast<const char *>(value));
+        break;
+    }
+
+    default:
+        ok = false;
+        break;
+    }
+
+exit:
+    return ok;
+}
+
+} // namespace
+
+FlightRecorder::FlightRecorder(void)
+    : mNextSequence(0)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.mSequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+FlightRecorder &FlightRecorder::GetInstance(void)
+{
+    static FlightRecorder sFlightRecorder;
+
+    return sFlightRecorder;
+}
+
+void FlightRecorder::Record(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgs)
+{
+    uint64_t sequence     = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+    Entry   &entry        = mEntries[sequence % kNumRecords];
+    size_t   formatLength = strnlen(aFormat, kMaxFormatLength + 1);
+    va_list  args;
+
+    entry.mSequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    entry.mEvent.mTimestamp =
+        static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(Clock::now().time_since_epoch()).count());
+    entry.mEvent.mLogTag = aLogTag;
+    entry.mEvent.mLevel  = static_cast<uint8_t>(aLevel);
+
+    va_copy(args, aArgs);
+    EncodeArgs(aFormat, args, entry.mEvent);
+    va_end(args);
+
+    formatLength = std::min(formatLength, kMaxFormatLength);
+    memcpy(entry.mEvent.mFormat, aFormat, formatLength);
+    entry.mEvent.mFormat[formatLength] = '\0';
+    entry.mEvent.mTruncated |= (aFormat[formatLength] != '\0');
+
+    entry.mSequence.store(sequence + 1, std::memory_order_release);
+}
+
+void FlightRecorder::EncodeArgs(const char *aFormat, va_list aArgs, Event &aEvent)
+{
+    const char    *cur = aFormat;
+    ConversionSpec spec;
+    bool           ok = true;
+
+    aEvent.mArgsLength = 0;
+
+    while (ok && (cur = strchr(cur, '%')) != nullptr)
+    {
+        if (cur[1] == '%')
+        {
+            cur += 2;
+            continue;
+        }
+
+        VerifyOrExit(ok = ParseConversionSpec(cur, spec));
+        cur += spec.mFormatLength;
+
+        for (uint8_t i = 0; ok && i < spec.mNumStars; i++)
+        {
+            ok = PutArg(aEvent.mArgs, aEvent.mArgsLength, static_cast<int64_t>(va_arg(aArgs, int)));
+        }
+        VerifyOrExit(ok);
+
+        switch (spec.mConversion)
+        {
+        case 'd':
+        case 'i':
+        case 'c':
+        {
+            int64_t value;
+
+            switch (spec.mLengthModifier)
+            {
+            case kLengthChar:
+                value = static_cast<signed char>(va_arg(aArgs, int));
+                break;
+            case kLengthShort:
+                value = static_cast<short>(va_arg(aArgs, int));
+                break;
+            case kLengthLong:
+                value = va_arg(aArgs, long);
+                break;
+            case kLengthLongLong:
+                value = va_arg(aArgs, long long);
+                break;
+            case kLengthIntMax:
+                value = va_arg(aArgs, intmax_t);
+                break;
+            case kLengthSize:
+                value = static_cast<int64_t>(va_arg(aArgs, size_t));
+                break;
+            case kLengthPtrDiff:
+                value = va_arg(aArgs, ptrdiff_t);
+                break;
+            default:
+                value = va_arg(aArgs, int);
+                break;
+            }
+
+            ok = PutArg(aEvent.mArgs, aEvent.mArgsLength, value);
+            break;
+        }
+
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        {
+            uint64_t value;
+
+            switch (spec.mLengthModifier)
+            {
+            case kLengthChar:
+                value = static_cast<unsigned char>(va_arg(aArgs, unsigned int));
+                break;
+            case kLengthShort:
+                value = static_cast<unsigned short>(va_arg(aArgs, unsigned int));
+                break;
+            case kLengthLong:
+                value = va_arg(aArgs, unsigned long);
+                break;
+            case kLengthLongLong:
+                value = va_arg(aArgs, unsigned long long);
+                break;
+            case kLengthIntMax:
+                value = va_arg(aArgs, uintmax_t);
+                break;
+            case kLengthSize:
+                value = va_arg(aArgs, size_t);
+                break;
+            case kLengthPtrDiff:
+                value = static_cast<uint64_t>(va_arg(aArgs, ptrdiff_t));
+                break;
+            default:
+                value = va_arg(aArgs, unsigned int);
+                break;
+            }
+
+            ok = PutArg(aEvent.mArgs, aEvent.mArgsLength, value);
+            break;
+        }
+
+        case 'p':
+            ok = PutArg(aEvent.mArgs, aEvent.mArgsLength,
+                        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(aArgs, void *))));
+            break;
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double value;
+
+            if (spec.mLengthModifier == kLengthLongDouble)
+            {
+                value = static_cast<double>(va_arg(aArgs, long double));
+            }
+            else
+            {
+                value = va_arg(aArgs, double);
+            }
+
+            ok = PutArg(aEvent.mArgs, aEvent.mArgsLength, value);
+            break;
+        }
+
+        case 's':
+            // Wide strings are not supported.
+            VerifyOrExit(spec.mLengthModifier == kLengthNone, ok = false);
+            ok = PutStringArg(aEvent.mArgs, aEvent.mArgsLength, va_arg(aArgs, const char *));
+            break;
+
+        default:
+            // The type of the argument is unknown, so none of the following arguments can be read.
+            ok = false;
+            break;
+        }
+    }
+
+exit:
+    aEvent.mTruncated = !ok;
+}
+
+std::string FlightRecorder::Format(const Event &aEvent)
+{
+    std::string    line;
+    char           header[64];
+    const char    *cur    = aEvent.mFormat;
+    size_t         offset = 0;
+    bool           ok     = true;
+    ConversionSpec spec;
+
+    snprintf(header, sizeof(header), "%" PRIu64 ".%06" PRIu64 " %s ", aEvent.mTimestamp / 1000000,
+             aEvent.mTimestamp % 1000000, kLevelString[aEvent.mLevel]);
+    line = header;
+
+    if (aEvent.mLogTag != nullptr)
+    {
+        line.append(aEvent.mLogTag);
+        line.append(": ");
+    }
+
+    while (ok)
+    {
+        const char *percent = strchr(cur, '%');
+
+        if (percent == nullptr)
+        {
+            line.append(cur);
+            break;
+        }
+
+        line.append(cur, static_cast<size_t>(percent - cur));
+
+        if (percent[1] == '%')
+        {
+            line.push_back('%');
+            cur = percent + 2;
+            continue;
+        }
+
+        ok  = ParseConversionSpec(percent, spec) && AppendArg(line, spec, aEvent.mArgs, aEvent.mArgsLength, offset);
+        cur = percent + (ok ? spec.mFormatLength : 0);
+    }
+
+    if (!ok || aEvent.mTruncated)
+    {
+        line.append("...");
+    }
+
+    return line;
+}
+
+std::vector<std::string> FlightRecorder::Dump(void) const
+{
+    std::vector<std::string> lines;
+    uint64_t                 end   = mNextSequence.load(std::memory_order_acquire);
+    uint64_t                 begin = (end > kNumRecords) ? end - kNumRecords : 0;
+
+    lines.reserve(static_cast<size_t>(end - begin));
+
+    for (uint64_t sequence = begin; sequence < end; sequence++)
+    {
+        const Entry &entry = mEntries[sequence % kNumRecords];
+        Event        event;
+
+        // The entry is skipped if it's being written, or overwritten while being copied.
+        if (entry.mSequence.load(std::memory_order_acquire) != sequence + 1)
+        {
+            continue;
+        }
+
+        event = entry.mEvent;
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (entry.mSequence.load(std::memory_order_relaxed) == sequence + 1)
+        {
+            lines.push_back(Format(event));
+        }
+    }
+
+    return lines;
+}
+
+} // namespace otbr
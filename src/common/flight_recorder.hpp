@@ -0,0 +1,137 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the flight recorder which keeps recent log events in memory.
+ */
+
+#ifndef OTBR_COMMON_FLIGHT_RECORDER_HPP_
+#define OTBR_COMMON_FLIGHT_RECORDER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the flight recorder.
+ *
+ * The flight recorder is a fixed-size ring of binary records. Each record keeps the timestamp, the
+ * level, the log tag and the format string of a log event, together with its raw arguments. The
+ * arguments are only formatted when the records are dumped, so recording an event costs a few
+ * copies instead of a call to printf. The oldest records are overwritten when the ring is full.
+ *
+ * The format string is copied, because some callers log a formatted temporary string, and truncated
+ * to `kMaxFormatLength` bytes. String arguments are copied and truncated to `kMaxStringArgLength`
+ * bytes. The log tag is kept by pointer and must be a string literal, which is the case for all the
+ * logging macros.
+ *
+ * Recording is lock-free and may happen on any thread. Records being overwritten while dumping are
+ * skipped.
+ */
+class FlightRecorder : private NonCopyable
+{
+public:
+    static constexpr size_t kNumRecords         = 512; ///< The number of records in the ring.
+    static constexpr size_t kMaxArgsSize        = 64;  ///< The maximum size of the raw arguments of a record.
+    static constexpr size_t kMaxStringArgLength = 24;  ///< The maximum length of a string argument.
+    static constexpr size_t kMaxFormatLength    = 127; ///< The maximum length of a recorded format string.
+
+    /**
+     * This constructor initializes an empty flight recorder.
+     */
+    FlightRecorder(void);
+
+    /**
+     * This method returns the flight recorder of the process.
+     *
+     * @returns A reference to the flight recorder.
+     */
+    static FlightRecorder &GetInstance(void);
+
+    /**
+     * This method records a log event.
+     *
+     * @param[in] aLevel   The log level.
+     * @param[in] aLogTag  The log tag, may be nullptr.
+     * @param[in] aFormat  The format string as in printf.
+     * @param[in] aArgs    The arguments for the format specification.
+     */
+    void Record(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgs);
+
+    /**
+     * This method formats the records, from the oldest to the newest.
+     *
+     * @returns The formatted records, one line per record.
+     */
+    std::vector<std::string> Dump(void) const;
+
+    /**
+     * This method returns the number of events recorded since the flight recorder was created.
+     *
+     * @returns The number of recorded events, including the overwritten ones.
+     */
+    uint64_t GetRecordedCount(void) const { return mNextSequence.load(std::memory_order_relaxed); }
+
+private:
+    struct Event
+    {
+        uint64_t    mTimestamp; // In microseconds of the steady clock.
+        const char *mLogTag;
+        uint8_t     mLevel;
+        uint8_t     mArgsLength;
+        bool        mTruncated; // Whether the format string or the arguments are truncated.
+        uint8_t     mArgs[kMaxArgsSize];
+        char        mFormat[kMaxFormatLength + 1];
+    };
+
+    struct Entry
+    {
+        std::atomic<uint64_t> mSequence; // One plus the sequence number of the event, zero while being written.
+        Event                 mEvent;
+    };
+
+    static void        EncodeArgs(const char *aFormat, va_list aArgs, Event &aEvent);
+    static std::string Format(const Event &aEvent);
+
+    Entry                 mEntries[kNumRecords];
+    std::atomic<uint64_t> mNextSequence;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_FLIGHT_RECORDER_HPP_
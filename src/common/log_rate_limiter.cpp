@@ -0,0 +1,268 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the per-call-site log rate limiter.
+ */
+
+#include "common/log_rate_limiter.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+namespace otbr {
+
+constexpr uint32_t     LogRateLimiter::kBurstSize;
+constexpr Milliseconds LogRateLimiter::kTokenInterval;
+constexpr Milliseconds LogRateLimiter::kReportInterval;
+
+std::atomic<uint64_t> LogRateLimiter::sTotalSuppressedCount{0};
+std::atomic<uint32_t> LogRateLimiter::sPendingSiteCount{0};
+
+LogRateLimiter::LogRateLimiter(otbrLogLevel aLevel, const char *aLogTag, const char *aFile, int aLine)
+    : mLevel(aLevel)
+    , mLogTag(aLogTag)
+    , mFile(aFile)
+    , mLine(aLine)
+    , mTokens(kBurstSize)
+    , mPendingSuppressed(0)
+    , mLastRefillTime(Clock::now())
+    , mLastReportTime(mLastRefillTime)
+    , mSuppressedCount(0)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+    GetRegistry().push_back(this);
+}
+
+LogRateLimiter::~LogRateLimiter(void)
+{
+    std::lock_guard<std::mutex>    lock(GetRegistryMutex());
+    std::vector<LogRateLimiter *> &registry = GetRegistry();
+
+    registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+    SetPendingSuppressed(0);
+}
+
+bool LogRateLimiter::Allow(uint32_t &aSuppressed)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    Timepoint                   now = Clock::now();
+    bool                        allowed;
+
+    if (mTokens >= kBurstSize)
+    {
+        mLastRefillTime = now;
+    }
+    else
+    {
+        auto newTokens = (now - mLastRefillTime) / kTokenInterval;
+
+        if (newTokens > 0)
+        {
+            mTokens = static_cast<uint32_t>(std::min<decltype(newTokens)>(mTokens + newTokens, kBurstSize));
+            mLastRefillTime += newTokens * kTokenInterval;
+        }
+    }
+
+    allowed = (mTokens > 0);
+
+    if (allowed)
+    {
+        mTokens--;
+    }
+    else
+    {
+        SetPendingSuppressed(mPendingSuppressed + 1);
+        mSuppressedCount.fetch_add(1, std::memory_order_relaxed);
+        sTotalSuppressedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    aSuppressed = 0;
+
+    if (mPendingSuppressed > 0 && (allowed || now - mLastReportTime >= kReportInterval))
+    {
+        aSuppressed     = mPendingSuppressed;
+        mLastReportTime = now;
+        SetPendingSuppressed(0);
+    }
+
+    return allowed;
+}
+
+void LogRateLimiter::SetPendingSuppressed(uint32_t aPendingSuppressed)
+{
+    if (mPendingSuppressed == 0 && aPendingSuppressed > 0)
+    {
+        sPendingSiteCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (mPendingSuppressed > 0 && aPendingSuppressed == 0)
+    {
+        sPendingSiteCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    mPendingSuppressed = aPendingSuppressed;
+}
+
+Timepoint LogRateLimiter::GetReportTime(void) const
+{
+    // Suppressed messages are reported no later than when the call site is allowed to log again.
+    return std::min(mLastRefillTime + kTokenInterval, mLastReportTime + kReportInterval);
+}
+
+bool LogRateLimiter::GetNextReportTime(Timepoint &aTime)
+{
+    bool found = false;
+
+    VerifyOrExit(sPendingSiteCount.load(std::memory_order_relaxed) > 0);
+
+    {
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+        for (LogRateLimiter *limiter : GetRegistry())
+        {
+            std::lock_guard<std::mutex> siteLock(limiter->mMutex);
+
+            if (limiter->mPendingSuppressed > 0 && (!found || limiter->GetReportTime() < aTime))
+            {
+                aTime = limiter->GetReportTime();
+                found = true;
+            }
+        }
+    }
+
+exit:
+    return found;
+}
+
+void LogRateLimiter::ReportDueSuppressions(Timepoint aNow)
+{
+    std::vector<Report> reports;
+
+    VerifyOrExit(sPendingSiteCount.load(std::memory_order_relaxed) > 0);
+
+    {
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+        for (LogRateLimiter *limiter : GetRegistry())
+        {
+            std::lock_guard<std::mutex> siteLock(limiter->mMutex);
+
+            if (limiter->mPendingSuppressed > 0 && limiter->GetReportTime() <= aNow)
+            {
+                reports.push_back({limiter->mLevel, limiter->mLogTag, limiter->GetFileName(), limiter->mLine,
+                                   limiter->mPendingSuppressed});
+                limiter->mLastReportTime = aNow;
+                limiter->SetPendingSuppressed(0);
+            }
+        }
+    }
+
+    // Logged without holding the locks, the log backends may take their own.
+    for (const Report &report : reports)
+    {
+        otbrLog(report.mLevel, report.mLogTag, "Suppressed %u messages at %s:%d", report.mSuppressed,
+                report.mFileName, report.mLine);
+    }
+
+exit:
+    return;
+}
+
+const char *LogRateLimiter::GetFileName(void) const
+{
+    const char *name = strrchr(mFile, '/');
+
+    return (name != nullptr) ? name + 1 : mFile;
+}
+
+std::vector<LogRateLimiter::SiteCounter> LogRateLimiter::GetSiteCounters(void)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    std::vector<SiteCounter>    counters;
+
+    for (const LogRateLimiter *limiter : GetRegistry())
+    {
+        uint64_t suppressedCount = limiter->mSuppressedCount.load(std::memory_order_relaxed);
+
+        if (suppressedCount > 0)
+        {
+            counters.push_back({std::string(limiter->GetFileName()) + ":" + std::to_string(limiter->mLine),
+                                suppressedCount});
+        }
+    }
+
+    return counters;
+}
+
+uint64_t LogRateLimiter::GetTotalSuppressedCount(void)
+{
+    return sTotalSuppressedCount.load(std::memory_order_relaxed);
+}
+
+std::mutex &LogRateLimiter::GetRegistryMutex(void)
+{
+    // Never destroyed so that rate limiters of static storage duration can be
+    // destroyed in any order at exit.
+    static std::mutex *sMutex = new std::mutex();
+
+    return *sMutex;
+}
+
+std::vector<LogRateLimiter *> &LogRateLimiter::GetRegistry(void)
+{
+    static std::vector<LogRateLimiter *> *sRegistry = new std::vector<LogRateLimiter *>();
+
+    return *sRegistry;
+}
+
+void LogSuppressionReporter::Update(MainloopContext &aMainloop)
+{
+    Timepoint reportTime;
+
+    if (LogRateLimiter::GetNextReportTime(reportTime))
+    {
+        struct timeval timeout = ToTimeval(std::max(reportTime - Clock::now(), Clock::duration::zero()));
+
+        if (timercmp(&timeout, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = timeout;
+        }
+    }
+}
+
+void LogSuppressionReporter::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    LogRateLimiter::ReportDueSuppressions(Clock::now());
+}
+
+} // namespace otbr
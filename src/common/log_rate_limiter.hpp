@@ -0,0 +1,232 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the per-call-site log rate limiter.
+ */
+
+#ifndef OTBR_COMMON_LOG_RATE_LIMITER_HPP_
+#define OTBR_COMMON_LOG_RATE_LIMITER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a token bucket which limits the logs of a single call site.
+ *
+ * A call site may log a burst of `kBurstSize` messages and then one message every
+ * `kTokenInterval`. The number of suppressed messages is reported along with the
+ * next message which is allowed, or at most every `kReportInterval` while the call
+ * site keeps being suppressed. A `LogSuppressionReporter` reports them once the call
+ * site is allowed to log again but stays silent.
+ */
+class LogRateLimiter : private NonCopyable
+{
+public:
+    static constexpr uint32_t     kBurstSize      = 10;                      ///< The bucket size.
+    static constexpr Milliseconds kTokenInterval  = Milliseconds(1000);      ///< The interval to add a token.
+    static constexpr Milliseconds kReportInterval = Milliseconds(10 * 1000); ///< The suppression report interval.
+
+    /**
+     * This structure represents the suppression counter of a call site.
+     */
+    struct SiteCounter
+    {
+        std::string mLocation;        ///< The call site in the form of "file:line".
+        uint64_t    mSuppressedCount; ///< The number of messages suppressed at the call site.
+    };
+
+    /**
+     * This constructor initializes the rate limiter of a call site.
+     *
+     * @param[in] aLevel   The log level of the suppression reports.
+     * @param[in] aLogTag  The log tag of the suppression reports.
+     * @param[in] aFile    The source file of the call site.
+     * @param[in] aLine    The line number of the call site.
+     */
+    LogRateLimiter(otbrLogLevel aLevel, const char *aLogTag, const char *aFile, int aLine);
+
+    /**
+     * This destructor unregisters the rate limiter.
+     */
+    ~LogRateLimiter(void);
+
+    /**
+     * This method decides whether a message of the call site should be logged.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[out] aSuppressed  The number of suppressed messages to report, zero if there is nothing to report.
+     *
+     * @retval TRUE   The message should be logged.
+     * @retval FALSE  The message is suppressed.
+     */
+    bool Allow(uint32_t &aSuppressed);
+
+    /**
+     * This method returns the file name of the call site.
+     *
+     * @returns The file name without the directories.
+     */
+    const char *GetFileName(void) const;
+
+    /**
+     * This method returns the line number of the call site.
+     *
+     * @returns The line number.
+     */
+    int GetLine(void) const { return mLine; }
+
+    /**
+     * This method returns the suppression counters of all call sites which have suppressed messages.
+     *
+     * @returns The suppression counters.
+     */
+    static std::vector<SiteCounter> GetSiteCounters(void);
+
+    /**
+     * This method returns the total number of suppressed messages of all call sites.
+     *
+     * @returns The total number of suppressed messages.
+     */
+    static uint64_t GetTotalSuppressedCount(void);
+
+    /**
+     * This method returns the time when the earliest pending suppression report of all call sites is due.
+     *
+     * @param[out] aTime  A reference to receive the time point.
+     *
+     * @retval TRUE   Successfully retrieved the time point.
+     * @retval FALSE  There is no pending suppression report.
+     */
+    static bool GetNextReportTime(Timepoint &aTime);
+
+    /**
+     * This method logs the pending suppression reports of all call sites which are due at @p aNow.
+     *
+     * A report is due once the call site is allowed to log again, or `kReportInterval` after its last report.
+     *
+     * @param[in] aNow  The current time.
+     */
+    static void ReportDueSuppressions(Timepoint aNow);
+
+private:
+    struct Report
+    {
+        otbrLogLevel mLevel;
+        const char  *mLogTag;
+        const char  *mFileName;
+        int          mLine;
+        uint32_t     mSuppressed;
+    };
+
+    static std::mutex                    &GetRegistryMutex(void);
+    static std::vector<LogRateLimiter *> &GetRegistry(void);
+
+    Timepoint GetReportTime(void) const;
+    void      SetPendingSuppressed(uint32_t aPendingSuppressed);
+
+    static std::atomic<uint64_t> sTotalSuppressedCount;
+    static std::atomic<uint32_t> sPendingSiteCount;
+
+    const otbrLogLevel    mLevel;
+    const char           *mLogTag;
+    const char           *mFile;
+    const int             mLine;
+    std::mutex            mMutex;
+    uint32_t              mTokens;
+    uint32_t              mPendingSuppressed;
+    Timepoint             mLastRefillTime;
+    Timepoint             mLastReportTime;
+    std::atomic<uint64_t> mSuppressedCount;
+};
+
+/**
+ * This class logs the pending suppression reports of the rate limited call sites from the mainloop.
+ *
+ * Without it, the messages suppressed in a burst are only reported when the call site logs again.
+ */
+class LogSuppressionReporter : public MainloopProcessor, private NonCopyable
+{
+public:
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "LogSuppressionReporter"; }
+};
+
+} // namespace otbr
+
+/**
+ * This macro logs at level @p aLevel with the rate limit of the call site.
+ *
+ * Each invocation location of this macro owns its own token bucket, see `otbr::LogRateLimiter`.
+ * Messages filtered by the log level don't consume tokens. The suppression reports use the log
+ * level of the first message of the call site.
+ *
+ * @param[in] aLevel   The log level.
+ * @param[in] aFormat  Format string as in printf.
+ * @param[in] ...      Arguments for the format specification.
+ */
+#define otbrLogRateLimited(aLevel, aFormat, ...)                                              \
+    do                                                                                        \
+    {                                                                                         \
+        otbrLogLevel _level = (aLevel);                                                       \
+                                                                                              \
+        if (otbrLogIsLevelEnabled(_level))                                                    \
+        {                                                                                     \
+            static otbr::LogRateLimiter _limiter(_level, OTBR_LOG_TAG, __FILE__, __LINE__);   \
+            uint32_t                    _suppressed;                                          \
+            bool                        _allowed = _limiter.Allow(_suppressed);               \
+                                                                                              \
+            if (_suppressed > 0)                                                              \
+            {                                                                                 \
+                otbrLog(_level, OTBR_LOG_TAG, "Suppressed %u messages at %s:%d", _suppressed, \
+                        _limiter.GetFileName(), _limiter.GetLine());                          \
+            }                                                                                 \
+            if (_allowed)                                                                     \
+            {                                                                                 \
+                otbrLog(_level, OTBR_LOG_TAG, aFormat, ##__VA_ARGS__);                        \
+            }                                                                                 \
+        }                                                                                     \
+    } while (0)
+
+#endif // OTBR_COMMON_LOG_RATE_LIMITER_HPP_
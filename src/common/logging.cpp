@@ -48,9 +48,16 @@
 #include <log/log.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <vector>
 
+#include "common/async_logger.hpp"
 #include "common/code_utils.hpp"
+#include "common/flight_recorder.hpp"
 #include "common/time.hpp"
 
 static otbrLogLevel sLevel            = OTBR_LOG_INFO;
@@ -61,12 +68,33 @@ static bool sSyslogDisabled = false;
 
 static otbrLogLevel sDefaultLevel = OTBR_LOG_INFO;
 
+// The asynchronous logger is created on the first enabling and never deleted, so that threads
+// which are logging while it's disabled can still access it safely.
+static std::atomic<otbr::AsyncLogger *> sAsyncLogger{nullptr};
+static std::atomic<bool>                sAsyncLogEnabled{false};
+static std::mutex                       sAsyncLogMutex;
+static std::atomic<bool>                sFlightRecorderEnabled{false};
+static std::atomic<otbrLogLevel>        sFlightRecorderLevel{OTBR_LOG_INFO};
+
 /** Get the current debug log level */
 otbrLogLevel otbrLogGetLevel(void)
 {
     return sLevel;
 }
 
+/** Get the most verbose log level which is logged or recorded */
+otbrLogLevel otbrLogGetCaptureLevel(void)
+{
+    otbrLogLevel level = sLevel;
+
+    if (sFlightRecorderEnabled.load(std::memory_order_relaxed))
+    {
+        level = std::max(level, sFlightRecorderLevel.load(std::memory_order_relaxed));
+    }
+
+    return level;
+}
+
 /** Get the default log level */
 otbrLogLevel otbrLogGetDefaultLevel(void)
 {
@@ -171,6 +199,135 @@ static android_LogPriority ConvertToAndroidLogPriority(otbrLogLevel aLevel)
 }
 #endif
 
+static void WriteSyslogLine(otbrLogLevel aLevel, const char *aLine)
+{
+#if OTBR_ENABLE_PLATFORM_ANDROID
+    __android_log_print(ConvertToAndroidLogPriority(aLevel), LOG_TAG, "%s", aLine);
+#else
+    syslog(static_cast<int>(aLevel), "%s", aLine);
+#endif
+}
+
+/** Get the asynchronous logger if the asynchronous logging is enabled */
+static otbr::AsyncLogger *GetAsyncLogger(void)
+{
+    return sAsyncLogEnabled.load() ? sAsyncLogger.load() : nullptr;
+}
+
+/** Write out the lines buffered by the asynchronous logger, if any */
+static void FlushAsyncLogger(void)
+{
+    otbr::AsyncLogger *asyncLogger = sAsyncLogger.load();
+
+    if (asyncLogger != nullptr)
+    {
+        asyncLogger->Flush();
+    }
+}
+
+/** Enable/disable writing syslog on a background thread */
+void otbrLogAsyncSetEnabled(bool aEnabled)
+{
+    std::lock_guard<std::mutex> lock(sAsyncLogMutex);
+
+    if (aEnabled)
+    {
+        if (sAsyncLogger.load() == nullptr)
+        {
+            sAsyncLogger.store(new otbr::AsyncLogger(WriteSyslogLine));
+        }
+        sAsyncLogEnabled.store(true);
+    }
+    else
+    {
+        // Lines written by threads which haven't observed the change yet are still written out
+        // by the background thread, which keeps running.
+        sAsyncLogEnabled.store(false);
+        FlushAsyncLogger();
+    }
+}
+
+/** Get the counters of the asynchronous logging */
+void otbrLogGetAsyncCounters(otbrLogAsyncCounters &aCounters)
+{
+    otbr::AsyncLogger *asyncLogger = GetAsyncLogger();
+
+    memset(&aCounters, 0, sizeof(aCounters));
+    VerifyOrExit(asyncLogger != nullptr);
+
+    {
+        otbr::AsyncLogger::Counters counters = asyncLogger->GetCounters();
+
+        aCounters.mWritten   = counters.mWritten;
+        aCounters.mDropped   = counters.mDropped;
+        aCounters.mTruncated = counters.mTruncated;
+    }
+
+exit:
+    return;
+}
+
+/** Enable/disable the flight recorder */
+void otbrLogFlightRecorderSetEnabled(bool aEnabled)
+{
+    sFlightRecorderEnabled.store(aEnabled, std::memory_order_relaxed);
+}
+
+/** Set the most verbose log level kept by the flight recorder */
+void otbrLogFlightRecorderSetLevel(otbrLogLevel aLevel)
+{
+    assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
+    sFlightRecorderLevel.store(aLevel, std::memory_order_relaxed);
+}
+
+/** Flush the logs before terminating on a fatal error */
+void otbrLogFlushOnFatal(void)
+{
+    std::vector<std::string> records;
+
+    // The asynchronous logger is only flushed, it may be in use by other threads.
+    FlushAsyncLogger();
+
+    VerifyOrExit(sFlightRecorderEnabled.load(std::memory_order_relaxed));
+    records = otbr::FlightRecorder::GetInstance().Dump();
+
+    for (const std::string &record : records)
+    {
+        if (sSyslogDisabled)
+        {
+            fprintf(stderr, "[FLREC] %s\n", record.c_str());
+        }
+        else
+        {
+            WriteSyslogLine(OTBR_LOG_ERR, ("[FLREC] " + record).c_str());
+        }
+    }
+
+exit:
+    return;
+}
+
+/**
+ * This function indicates whether a log message at the given level is kept by the flight recorder.
+ */
+static bool IsRecorded(otbrLogLevel aLevel)
+{
+    return sFlightRecorderEnabled.load(std::memory_order_relaxed) && aLevel <= otbrLogGetCaptureLevel();
+}
+
+/**
+ * This function writes a log line on the background thread if the asynchronous logging is enabled.
+ *
+ * @retval TRUE   The log line is taken by the asynchronous logger.
+ * @retval FALSE  The log line should be written synchronously.
+ */
+static bool WriteAsync(otbrLogLevel aLevel, const char *aLine)
+{
+    otbr::AsyncLogger *asyncLogger = GetAsyncLogger();
+
+    return !sSyslogDisabled && asyncLogger != nullptr && asyncLogger->Write(aLevel, aLine);
+}
+
 /** log to the syslog or standard out */
 void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 {
@@ -180,9 +337,22 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 
     va_start(ap, aFormat);
 
+    if (IsRecorded(aLevel))
+    {
+        otbr::FlightRecorder::GetInstance().Record(aLevel, aLogTag, aFormat, ap);
+    }
+
     if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
     {
-        if (sSyslogDisabled)
+        char line[kBufferSize];
+
+        if (GetAsyncLogger() != nullptr &&
+            snprintf(line, sizeof(line), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer) > 0 &&
+            WriteAsync(aLevel, line))
+        {
+            // The line is written by the asynchronous logger.
+        }
+        else if (sSyslogDisabled)
         {
             fprintf(stderr, "%s%s: %s\n", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
         }
@@ -211,11 +381,34 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
     {
         otbrLogvNoFilter(aLevel, aFormat, aArgList);
     }
+    else if (IsRecorded(aLevel))
+    {
+        otbr::FlightRecorder::GetInstance().Record(aLevel, nullptr, aFormat, aArgList);
+    }
 }
 
 /** log to the syslog or standard out */
 void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 {
+    if (IsRecorded(aLevel))
+    {
+        otbr::FlightRecorder::GetInstance().Record(aLevel, nullptr, aFormat, aArgList);
+    }
+
+    if (GetAsyncLogger() != nullptr && !sSyslogDisabled)
+    {
+        char    line[1024];
+        va_list argList;
+        bool    written;
+
+        // The argument list is still needed when the line is written synchronously.
+        va_copy(argList, aArgList);
+        written = vsnprintf(line, sizeof(line), aFormat, argList) >= 0 && WriteAsync(aLevel, line);
+        va_end(argList);
+
+        VerifyOrExit(!written);
+    }
+
     if (sSyslogDisabled)
     {
         vprintf(aFormat, aArgList);
@@ -229,6 +422,9 @@ void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList
         vsyslog(static_cast<int>(aLevel), aFormat, aArgList);
 #endif
     }
+
+exit:
+    return;
 }
 
 /** Hex dump data to the log */
@@ -336,6 +532,10 @@ const char *otbrErrorString(otbrError aError)
         error = "Invalid state";
         break;
 
+    case OTBR_ERROR_BUSY:
+        error = "Busy";
+        break;
+
     default:
         error = "Unknown";
     }
@@ -345,6 +545,7 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+    otbrLogAsyncSetEnabled(false);
     closelog();
 }
 
@@ -37,6 +37,7 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <openthread/platform/logging.h>
 
@@ -61,11 +62,44 @@ typedef enum
     OTBR_LOG_DEBUG,   ///< Debug level messages
 } otbrLogLevel;
 
+/**
+ * @def OTBR_LOG_LEVEL_MAX
+ *
+ * The most verbose log level compiled into the binary.
+ *
+ * The logging macros below discard messages more verbose than this level at compile time, including the
+ * evaluation of their arguments, regardless of the runtime log level.
+ */
+#ifndef OTBR_LOG_LEVEL_MAX
+#define OTBR_LOG_LEVEL_MAX OTBR_LOG_DEBUG
+#endif
+
 /**
  * Get current log level.
  */
 otbrLogLevel otbrLogGetLevel(void);
 
+/**
+ * Get the most verbose log level which is either logged or kept by the flight recorder.
+ */
+otbrLogLevel otbrLogGetCaptureLevel(void);
+
+/**
+ * This function indicates whether messages at level @p aLevel are logged or kept by the flight recorder.
+ *
+ * The check against `OTBR_LOG_LEVEL_MAX` comes first so that the compiler drops the whole logging
+ * statement when @p aLevel is a constant more verbose than the build-time level.
+ *
+ * @param[in] aLevel  The log level.
+ *
+ * @retval TRUE   Messages at @p aLevel are captured.
+ * @retval FALSE  Messages at @p aLevel are discarded.
+ */
+inline bool otbrLogIsLevelEnabled(otbrLogLevel aLevel)
+{
+    return aLevel <= OTBR_LOG_LEVEL_MAX && aLevel <= otbrLogGetCaptureLevel();
+}
+
 /**
  * Get default log level.
  */
@@ -83,6 +117,68 @@ void otbrLogSetLevel(otbrLogLevel aLevel);
  */
 void otbrLogSyslogSetEnabled(bool aEnabled);
 
+/**
+ * Counters of the asynchronous logging.
+ */
+typedef struct
+{
+    uint64_t mWritten;   ///< The number of log lines written by the background thread.
+    uint64_t mDropped;   ///< The number of log lines dropped because the ring of the thread was full.
+    uint64_t mTruncated; ///< The number of log lines truncated to fit a ring entry.
+} otbrLogAsyncCounters;
+
+/**
+ * Control writing logs to syslog on a background thread.
+ *
+ * When enabled, log lines are appended to per-thread bounded rings and written to syslog by a
+ * background thread, so that a slow syslog daemon doesn't block the callers. Lines are dropped
+ * and counted when a ring is full. Logs to standard error are always written synchronously.
+ * Disabling writes out all buffered lines. The background thread is kept for a later enabling, so it's
+ * safe to disable while other threads are logging.
+ *
+ * @param[in] aEnabled  True to enable the asynchronous logging.
+ */
+void otbrLogAsyncSetEnabled(bool aEnabled);
+
+/**
+ * Get the counters of the asynchronous logging.
+ *
+ * The counters are all zero if the asynchronous logging is disabled.
+ *
+ * @param[out] aCounters  A reference to where the counters are stored.
+ */
+void otbrLogGetAsyncCounters(otbrLogAsyncCounters &aCounters);
+
+/**
+ * Control the flight recorder.
+ *
+ * When enabled, every log message up to the more verbose of the current log level and the level set by
+ * `otbrLogFlightRecorderSetLevel()`, including the ones filtered out by the current log level, is kept in
+ * the in-memory ring of `otbr::FlightRecorder` without being formatted.
+ *
+ * @param[in] aEnabled  True to enable the flight recorder.
+ */
+void otbrLogFlightRecorderSetEnabled(bool aEnabled);
+
+/**
+ * Set the most verbose log level kept by the flight recorder in addition to the current log level.
+ *
+ * The arguments of messages up to this level are evaluated even if the current log level is lower, so
+ * a level more verbose than the default `OTBR_LOG_INFO` adds the cost of the debug logs to every caller.
+ *
+ * @param[in] aLevel  The log level.
+ */
+void otbrLogFlightRecorderSetLevel(otbrLogLevel aLevel);
+
+/**
+ * This function flushes the logs before the program terminates on a fatal error.
+ *
+ * It writes out the lines buffered by the asynchronous logging and then the records of the flight
+ * recorder, if enabled. It's safe to call on any thread except the background thread of the
+ * asynchronous logging.
+ */
+void otbrLogFlushOnFatal(void);
+
 /**
  * This function initialize the logging service.
  *
@@ -155,14 +251,29 @@ void otbrLogDeinit(void);
  * @param[in] aFormat  Format string as in printf.
  * @param[in] ...      Arguments for the format specification.
  */
-#define otbrLogResult(aError, aFormat, ...)                                                               \
-    do                                                                                                    \
-    {                                                                                                     \
-        otbrError _err = (aError);                                                                        \
-        otbrLog(_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG, aFormat ": %s", \
-                ##__VA_ARGS__, otbrErrorString(_err));                                                    \
+#define otbrLogResult(aError, aFormat, ...)                                                      \
+    do                                                                                           \
+    {                                                                                            \
+        otbrError    _err   = (aError);                                                          \
+        otbrLogLevel _level = (_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING);      \
+                                                                                                 \
+        if (otbrLogIsLevelEnabled(_level))                                                       \
+        {                                                                                        \
+            otbrLog(_level, OTBR_LOG_TAG, aFormat ": %s", ##__VA_ARGS__, otbrErrorString(_err)); \
+        }                                                                                        \
     } while (0)
 
+/**
+ * This macro logs at level @p aLevel, evaluating the arguments only if the level is enabled.
+ *
+ * It is an expression so that it can be used as the action of `VerifyOrExit()` and friends.
+ *
+ * @param[in] aLevel  The log level.
+ * @param[in] ...     Format string as in printf and arguments for the format specification.
+ */
+#define otbrLogAtLevel(aLevel, ...) \
+    (otbrLogIsLevelEnabled(aLevel) ? otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__) : static_cast<void>(0))
+
 /**
  * @def otbrLogEmerg
  *
@@ -226,14 +337,14 @@ void otbrLogDeinit(void);
  *
  * @param[in] ...  Arguments for the format specification.
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+#define otbrLogEmerg(...) otbrLogAtLevel(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogAtLevel(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogAtLevel(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogAtLevel(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogAtLevel(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogAtLevel(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogAtLevel(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogAtLevel(OTBR_LOG_DEBUG, __VA_ARGS__)
 
 /**
  * Convert otbrLogLevel to otLogLevel.
@@ -31,6 +31,10 @@
 
 namespace otbr {
 
+constexpr uint8_t MainloopContext::kErrorFdSet;
+constexpr uint8_t MainloopContext::kReadFdSet;
+constexpr uint8_t MainloopContext::kWriteFdSet;
+
 MainloopProcessor::MainloopProcessor(void)
 {
     MainloopManager::GetInstance().AddMainloopProcessor(this);
@@ -90,6 +90,15 @@ public:
      * @param[in] aMainloop  A reference to the mainloop context.
      */
     virtual void Process(const MainloopContext &aMainloop) = 0;
+
+    /**
+     * This method returns the name of the mainloop processor.
+     *
+     * The name identifies the processor in the mainloop statistics.
+     *
+     * @returns The name of the mainloop processor.
+     */
+    virtual const char *GetName(void) const { return "Unknown"; }
 };
 
 } // namespace otbr
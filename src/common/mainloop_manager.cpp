@@ -25,12 +25,56 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+#define OTBR_LOG_TAG "MAINLOOP"
+
 #include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+#include <algorithm>
 
+#include "common/logging.hpp"
 #include "common/mainloop_manager.hpp"
 
 namespace otbr {
 
+constexpr uint8_t MainloopProcessorStats::kNumTimeBuckets;
+constexpr int     MainloopManager::kFdsPerChunk;
+#ifdef __linux__
+constexpr int MainloopManager::kMaxEpollEvents;
+#endif
+
+MainloopManager::ProcessorEntry::ProcessorEntry(MainloopProcessor *aProcessor)
+    : mProcessor(aProcessor)
+    , mStats()
+{
+}
+
+MainloopManager::MainloopManager(void)
+    : mIsIterating(false)
+    , mCurrentEntry(nullptr)
+    , mTimeoutOwner(nullptr)
+    , mEpollFd(-1)
+{
+    memset(&mProcessorContext, 0, sizeof(mProcessorContext));
+    mProcessorContext.mMaxFd = -1;
+}
+
+MainloopManager::~MainloopManager(void)
+{
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+}
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     assert(aMainloopProcessor != nullptr);
@@ -39,22 +83,524 @@ void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor
 
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
-    mMainloopProcessorList.remove(aMainloopProcessor);
+    for (auto it = mMainloopProcessorList.begin(); it != mMainloopProcessorList.end(); ++it)
+    {
+        if (it->mProcessor != aMainloopProcessor)
+        {
+            continue;
+        }
+
+        if (&*it == mCurrentEntry)
+        {
+            mCurrentEntry = nullptr;
+        }
+        if (&*it == mTimeoutOwner)
+        {
+            mTimeoutOwner = nullptr;
+        }
+
+        // The entry is erased after the iteration so that the loops in `Update()` and `Process()` stay valid.
+        if (mIsIterating)
+        {
+            it->mProcessor = nullptr;
+        }
+        else
+        {
+            mMainloopProcessorList.erase(it);
+        }
+        break;
+    }
 }
 
 void MainloopManager::Update(MainloopContext &aMainloop)
 {
-    for (auto &mainloopProcessor : mMainloopProcessorList)
+    Timepoint start = Clock::now();
+    Timepoint end;
+
+    mIsIterating  = true;
+    mTimeoutOwner = nullptr;
+
+    for (ProcessorEntry &entry : mMainloopProcessorList)
     {
-        mainloopProcessor->Update(aMainloop);
+        size_t length;
+
+        if (entry.mProcessor == nullptr)
+        {
+            continue;
+        }
+
+        mProcessorContext.mTimeout = aMainloop.mTimeout;
+        entry.mProcessor->Update(mProcessorContext);
+        end = Clock::now();
+
+        entry.mStats.mUpdateTimeUs += ToMicroseconds(start, end);
+        RecordFds(mProcessorContext, entry);
+        MergeFds(mProcessorContext, aMainloop);
+
+        // The processor asking for the earliest timeout is the one woken up if no fd becomes ready.
+        if (timercmp(&mProcessorContext.mTimeout, &aMainloop.mTimeout, <))
+        {
+            mTimeoutOwner = &entry;
+        }
+        aMainloop.mTimeout = mProcessorContext.mTimeout;
+
+        // Only the chunks used by the processor are cleared for the next one.
+        length = GetFdSetsLength(mProcessorContext.mMaxFd);
+        memset(&mProcessorContext.mReadFdSet, 0, length);
+        memset(&mProcessorContext.mWriteFdSet, 0, length);
+        memset(&mProcessorContext.mErrorFdSet, 0, length);
+        mProcessorContext.mMaxFd = -1;
+
+        start = end;
     }
+
+    mIsIterating = false;
+    PurgeRemovedProcessors();
+
+#ifdef __linux__
+    if (!mFdWatches.empty())
+    {
+        aMainloop.AddFdToReadSet(mEpollFd);
+    }
+#else
+    for (const auto &watch : mFdWatches)
+    {
+        aMainloop.AddFdToSet(watch.first, watch.second->mEventsMask);
+    }
+#endif
 }
 
 void MainloopManager::Process(const MainloopContext &aMainloop)
 {
-    for (auto &mainloopProcessor : mMainloopProcessorList)
+    bool      isAnyFdReady = IsAnyWatchedFdReady(aMainloop);
+    Timepoint start;
+    uint32_t  duration;
+
+    mIsIterating = true;
+
+    for (ProcessorEntry &entry : mMainloopProcessorList)
+    {
+        if (entry.mProcessor == nullptr)
+        {
+            continue;
+        }
+
+        if (IsAnyFdReady(aMainloop, entry))
+        {
+            entry.mStats.mWakeups++;
+            isAnyFdReady = true;
+        }
+
+        mCurrentEntry = &entry;
+        start         = Clock::now();
+        entry.mProcessor->Process(aMainloop);
+        duration = ToMicroseconds(start, Clock::now());
+
+        // The entry is still valid even if the processor has been removed by itself, only the pointer is cleared.
+        mCurrentEntry = nullptr;
+
+        entry.mStats.mIterations++;
+        entry.mStats.mProcessTimeUs += duration;
+        entry.mStats.mMaxProcessTimeUs = std::max(entry.mStats.mMaxProcessTimeUs, duration);
+        entry.mStats.mProcessTimeHistogram[GetTimeBucket(duration)]++;
+    }
+
+    if (!isAnyFdReady && mTimeoutOwner != nullptr)
+    {
+        mTimeoutOwner->mStats.mWakeups++;
+    }
+
+    mIsIterating = false;
+    PurgeRemovedProcessors();
+
+    if (IsAnyWatchedFdReady(aMainloop))
+    {
+        ProcessFds(aMainloop);
+    }
+}
+
+std::vector<MainloopProcessorStats> MainloopManager::GetProcessorStats(void) const
+{
+    std::vector<MainloopProcessorStats> stats;
+
+    for (const ProcessorEntry &entry : mMainloopProcessorList)
     {
-        mainloopProcessor->Process(aMainloop);
+        if (entry.mProcessor == nullptr)
+        {
+            continue;
+        }
+
+        stats.push_back(entry.mStats);
+        stats.back().mName = entry.mProcessor->GetName();
     }
+
+    return stats;
 }
+
+void MainloopManager::RecordTasksRun(uint32_t aCount)
+{
+    VerifyOrExit(mCurrentEntry != nullptr);
+    mCurrentEntry->mStats.mTasksRun += aCount;
+
+exit:
+    return;
+}
+
+size_t MainloopManager::GetFdSetsLength(int aMaxFd)
+{
+    // The length is rounded up to whole chunks so that it covers full `fd_mask` words regardless of their size.
+    size_t length = aMaxFd < 0 ? 0 : static_cast<size_t>(aMaxFd / kFdsPerChunk + 1) * (kFdsPerChunk / CHAR_BIT);
+
+    return std::min(length, sizeof(fd_set));
+}
+
+bool MainloopManager::IsFdChunkEmpty(const fd_set &aFdSet, int aFd)
+{
+    uint64_t chunk;
+
+    static_assert(FD_SETSIZE % kFdsPerChunk == 0, "FD_SETSIZE must be a multiple of kFdsPerChunk");
+    static_assert(sizeof(chunk) * CHAR_BIT == kFdsPerChunk, "The chunk must hold kFdsPerChunk fds");
+
+    memcpy(&chunk, reinterpret_cast<const uint8_t *>(&aFdSet) + aFd / CHAR_BIT, sizeof(chunk));
+
+    return chunk == 0;
+}
+
+void MainloopManager::RecordFds(const MainloopContext &aContext, ProcessorEntry &aEntry)
+{
+    aEntry.mFds.clear();
+
+    for (int base = 0; base <= aContext.mMaxFd; base += kFdsPerChunk)
+    {
+        int last = std::min(base + kFdsPerChunk - 1, aContext.mMaxFd);
+
+        if (IsFdChunkEmpty(aContext.mReadFdSet, base) && IsFdChunkEmpty(aContext.mWriteFdSet, base) &&
+            IsFdChunkEmpty(aContext.mErrorFdSet, base))
+        {
+            continue;
+        }
+
+        for (int fd = base; fd <= last; fd++)
+        {
+            uint8_t mask = 0;
+
+            if (FD_ISSET(fd, &aContext.mReadFdSet))
+            {
+                mask |= MainloopContext::kReadFdSet;
+            }
+            if (FD_ISSET(fd, &aContext.mWriteFdSet))
+            {
+                mask |= MainloopContext::kWriteFdSet;
+            }
+            if (FD_ISSET(fd, &aContext.mErrorFdSet))
+            {
+                mask |= MainloopContext::kErrorFdSet;
+            }
+
+            if (mask != 0)
+            {
+                aEntry.mFds.emplace_back(fd, mask);
+            }
+        }
+    }
+
+    aEntry.mStats.mFdCount = static_cast<uint32_t>(aEntry.mFds.size());
+}
+
+void MainloopManager::MergeFds(const MainloopContext &aContext, MainloopContext &aMainloop)
+{
+    size_t length = GetFdSetsLength(aContext.mMaxFd);
+
+    MergeFdSet(aContext.mReadFdSet, aMainloop.mReadFdSet, length);
+    MergeFdSet(aContext.mWriteFdSet, aMainloop.mWriteFdSet, length);
+    MergeFdSet(aContext.mErrorFdSet, aMainloop.mErrorFdSet, length);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, aContext.mMaxFd);
+}
+
+void MainloopManager::MergeFdSet(const fd_set &aFrom, fd_set &aTo, size_t aLength)
+{
+    const uint8_t *from = reinterpret_cast<const uint8_t *>(&aFrom);
+    uint8_t       *to   = reinterpret_cast<uint8_t *>(&aTo);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        to[i] |= from[i];
+    }
+}
+
+bool MainloopManager::IsAnyFdReady(const MainloopContext &aMainloop, const ProcessorEntry &aEntry)
+{
+    bool isReady = false;
+
+    for (const auto &fd : aEntry.mFds)
+    {
+        if (((fd.second & MainloopContext::kReadFdSet) && FD_ISSET(fd.first, &aMainloop.mReadFdSet)) ||
+            ((fd.second & MainloopContext::kWriteFdSet) && FD_ISSET(fd.first, &aMainloop.mWriteFdSet)) ||
+            ((fd.second & MainloopContext::kErrorFdSet) && FD_ISSET(fd.first, &aMainloop.mErrorFdSet)))
+        {
+            ExitNow(isReady = true);
+        }
+    }
+
+exit:
+    return isReady;
+}
+
+uint32_t MainloopManager::ToMicroseconds(Timepoint aStart, Timepoint aEnd)
+{
+    auto duration = std::chrono::duration_cast<Microseconds>(aEnd - aStart).count();
+
+    return duration > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(duration);
+}
+
+uint8_t MainloopManager::GetTimeBucket(uint32_t aTimeUs)
+{
+    uint8_t bucket = 0;
+
+    while (aTimeUs != 0 && bucket < MainloopProcessorStats::kNumTimeBuckets - 1)
+    {
+        aTimeUs >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+void MainloopManager::PurgeRemovedProcessors(void)
+{
+    mMainloopProcessorList.remove_if([](const ProcessorEntry &aEntry) { return aEntry.mProcessor == nullptr; });
+}
+
+otbrError MainloopManager::AddFd(int aFd, uint8_t aEventsMask, FdCallback aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aFd >= 0 && aCallback != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(mFdWatches.find(aFd) == mFdWatches.end(), error = OTBR_ERROR_DUPLICATED);
+
+#ifdef __linux__
+    {
+        struct epoll_event event;
+
+        // The epoll fd is created on demand so that a failure doesn't affect users of the
+        // `Update/Process` contract.
+        if (mEpollFd == -1)
+        {
+            mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+            VerifyOrExit(mEpollFd != -1, error = OTBR_ERROR_ERRNO);
+        }
+
+        memset(&event, 0, sizeof(event));
+        event.events  = ToEpollEvents(aEventsMask);
+        event.data.fd = aFd;
+        VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+    }
+#else
+    VerifyOrExit(aFd < FD_SETSIZE, error = OTBR_ERROR_INVALID_ARGS);
+#endif
+
+    mFdWatches.emplace(aFd, std::make_shared<FdWatch>(FdWatch{aEventsMask, std::move(aCallback)}));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to add fd %d: %s", aFd, otbrErrorString(error));
+    }
+    return error;
+}
+
+otbrError MainloopManager::UpdateFd(int aFd, uint8_t aEventsMask)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      it    = mFdWatches.find(aFd);
+
+    VerifyOrExit(it != mFdWatches.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(it->second->mEventsMask != aEventsMask);
+
+#ifdef __linux__
+    {
+        struct epoll_event event;
+
+        memset(&event, 0, sizeof(event));
+        event.events  = ToEpollEvents(aEventsMask);
+        event.data.fd = aFd;
+        VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+    }
+#endif
+
+    it->second->mEventsMask = aEventsMask;
+
+exit:
+    return error;
+}
+
+void MainloopManager::RemoveFd(int aFd)
+{
+    auto it = mFdWatches.find(aFd);
+
+    VerifyOrExit(it != mFdWatches.end());
+
+#ifdef __linux__
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr) != 0)
+    {
+        otbrLogWarning("Failed to remove fd %d: %s", aFd, strerror(errno));
+    }
+#endif
+
+    mFdWatches.erase(it);
+
+exit:
+    return;
+}
+
+bool MainloopManager::IsAnyWatchedFdReady(const MainloopContext &aMainloop) const
+{
+    bool isReady = false;
+
+    VerifyOrExit(!mFdWatches.empty());
+
+#ifdef __linux__
+    isReady = FD_ISSET(mEpollFd, &aMainloop.mReadFdSet);
+#else
+    for (const auto &watch : mFdWatches)
+    {
+        if (GetReadyEvents(aMainloop, watch.first, watch.second->mEventsMask) != 0)
+        {
+            ExitNow(isReady = true);
+        }
+    }
+#endif
+
+exit:
+    return isReady;
+}
+
+#ifdef __linux__
+void MainloopManager::ProcessFds(const MainloopContext &aMainloop)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                count;
+
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    do
+    {
+        count = epoll_wait(mEpollFd, events, kMaxEpollEvents, 0);
+    } while (count == -1 && errno == EINTR);
+
+    if (count == -1)
+    {
+        otbrLogWarning("epoll_wait() failed: %s", strerror(errno));
+        ExitNow();
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        auto it = mFdWatches.find(events[i].data.fd);
+
+        // The fd may have been removed by a callback invoked earlier in this pass.
+        if (it == mFdWatches.end())
+        {
+            continue;
+        }
+
+        // Holds a reference so that the callback stays valid if it removes its own fd.
+        std::shared_ptr<FdWatch> watch = it->second;
+
+        watch->mCallback(FromEpollEvents(events[i].events) & (watch->mEventsMask | MainloopContext::kErrorFdSet));
+    }
+
+exit:
+    return;
+}
+
+uint32_t MainloopManager::ToEpollEvents(uint8_t aEventsMask)
+{
+    uint32_t events = 0;
+
+    if (aEventsMask & MainloopContext::kReadFdSet)
+    {
+        events |= EPOLLIN;
+    }
+    if (aEventsMask & MainloopContext::kWriteFdSet)
+    {
+        events |= EPOLLOUT;
+    }
+    if (aEventsMask & MainloopContext::kErrorFdSet)
+    {
+        events |= EPOLLPRI;
+    }
+
+    return events;
+}
+
+uint8_t MainloopManager::FromEpollEvents(uint32_t aEpollEvents)
+{
+    uint8_t events = 0;
+
+    // Like select(), a hang-up is reported as readable so that the owner reads EOF.
+    if (aEpollEvents & (EPOLLIN | EPOLLHUP | EPOLLRDHUP))
+    {
+        events |= MainloopContext::kReadFdSet;
+    }
+    if (aEpollEvents & EPOLLOUT)
+    {
+        events |= MainloopContext::kWriteFdSet;
+    }
+    if (aEpollEvents & (EPOLLPRI | EPOLLERR))
+    {
+        events |= MainloopContext::kErrorFdSet;
+    }
+
+    return events;
+}
+#else // __linux__
+void MainloopManager::ProcessFds(const MainloopContext &aMainloop)
+{
+    std::vector<std::pair<int, std::shared_ptr<FdWatch>>> readyWatches;
+
+    // The ready fds are collected first because the callbacks may add or remove fds.
+    for (const auto &watch : mFdWatches)
+    {
+        if (GetReadyEvents(aMainloop, watch.first, watch.second->mEventsMask) != 0)
+        {
+            readyWatches.emplace_back(watch.first, watch.second);
+        }
+    }
+
+    for (const auto &ready : readyWatches)
+    {
+        auto it = mFdWatches.find(ready.first);
+
+        // The fd may have been removed or re-registered by a callback invoked earlier in this pass.
+        if (it == mFdWatches.end() || it->second != ready.second)
+        {
+            continue;
+        }
+
+        ready.second->mCallback(GetReadyEvents(aMainloop, ready.first, ready.second->mEventsMask));
+    }
+}
+#endif // __linux__
+
+uint8_t MainloopManager::GetReadyEvents(const MainloopContext &aMainloop, int aFd, uint8_t aEventsMask)
+{
+    uint8_t events = 0;
+
+    if ((aEventsMask & MainloopContext::kReadFdSet) && FD_ISSET(aFd, &aMainloop.mReadFdSet))
+    {
+        events |= MainloopContext::kReadFdSet;
+    }
+    if ((aEventsMask & MainloopContext::kWriteFdSet) && FD_ISSET(aFd, &aMainloop.mWriteFdSet))
+    {
+        events |= MainloopContext::kWriteFdSet;
+    }
+    if ((aEventsMask & MainloopContext::kErrorFdSet) && FD_ISSET(aFd, &aMainloop.mErrorFdSet))
+    {
+        events |= MainloopContext::kErrorFdSet;
+    }
+
+    return events;
+}
+
 } // namespace otbr
@@ -38,23 +38,69 @@
 
 #include <openthread/openthread-system.h>
 
+#include <array>
+#include <functional>
 #include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 
 namespace otbr {
 
+/**
+ * This structure represents the statistics of a mainloop processor.
+ */
+struct MainloopProcessorStats
+{
+    /**
+     * The number of buckets of the `Process()` time histogram.
+     *
+     * Bucket 0 counts calls shorter than 1 us, bucket i (0 < i < kNumTimeBuckets - 1) counts calls
+     * in [2^(i-1), 2^i) us, and the last bucket counts calls of 2^(kNumTimeBuckets - 2) us (~262 ms) or longer.
+     */
+    static constexpr uint8_t kNumTimeBuckets = 20;
+
+    std::string mName;             ///< The name of the processor.
+    uint64_t    mIterations;       ///< The number of mainloop iterations the processor has been processed.
+    uint64_t    mWakeups;          ///< The number of iterations woken up by the processor's fds or timeout.
+    uint64_t    mTasksRun;         ///< The number of `TaskRunner` tasks run within the processor's `Process()`.
+    uint64_t    mUpdateTimeUs;     ///< The total time spent in `Update()` in microseconds.
+    uint64_t    mProcessTimeUs;    ///< The total time spent in `Process()` in microseconds.
+    uint32_t    mMaxProcessTimeUs; ///< The longest time spent in a single `Process()` in microseconds.
+    uint32_t    mFdCount;          ///< The number of fds contributed by the latest `Update()`.
+
+    std::array<uint32_t, kNumTimeBuckets> mProcessTimeHistogram; ///< The `Process()` time histogram.
+};
+
 /**
  * This class implements the mainloop manager.
  */
 class MainloopManager : private NonCopyable
 {
 public:
+    /**
+     * This type represents the callback invoked when a registered fd is ready.
+     *
+     * @param[in] aEvents  A bitmask of `MainloopContext::k*FdSet` indicating the ready events.
+     */
+    typedef std::function<void(uint8_t aEvents)> FdCallback;
+
     /**
      * The constructor to initialize the mainloop manager.
      */
-    MainloopManager() = default;
+    MainloopManager(void);
+
+    /**
+     * The destructor to release the mainloop manager.
+     */
+    ~MainloopManager(void);
 
     /**
      * This method returns the singleton instance of the mainloop manager.
@@ -93,8 +139,128 @@ public:
      */
     void Process(const MainloopContext &aMainloop);
 
+    /**
+     * This method registers a fd to be watched by the mainloop manager.
+     *
+     * Unlike the `MainloopProcessor::Update/Process` contract, a registered fd is added to the
+     * kernel (epoll) interest list only once and @p aCallback is invoked only when the fd is ready,
+     * so the per-iteration cost doesn't grow with the number of idle fds, and the fd is not limited
+     * by `FD_SETSIZE`. On platforms without epoll, the registered fds are multiplexed with the
+     * `select()` fd sets instead.
+     *
+     * The callback is always invoked on the mainloop thread.
+     *
+     * @param[in] aFd          The fd to watch.
+     * @param[in] aEventsMask  A bitmask of `MainloopContext::k*FdSet` indicating the events of interest.
+     * @param[in] aCallback    The callback to invoke when the fd is ready.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully registered the fd.
+     * @retval OTBR_ERROR_INVALID_ARGS  @p aFd is invalid or @p aCallback is empty.
+     * @retval OTBR_ERROR_DUPLICATED    @p aFd has already been registered.
+     * @retval OTBR_ERROR_ERRNO         Failed to create the epoll fd or to add @p aFd to the epoll interest list.
+     */
+    otbrError AddFd(int aFd, uint8_t aEventsMask, FdCallback aCallback);
+
+    /**
+     * This method updates the events of interest of a registered fd.
+     *
+     * @param[in] aFd          The fd to update.
+     * @param[in] aEventsMask  A bitmask of `MainloopContext::k*FdSet` indicating the events of interest.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully updated the fd.
+     * @retval OTBR_ERROR_NOT_FOUND  @p aFd has not been registered.
+     * @retval OTBR_ERROR_ERRNO      Failed to modify @p aFd in the epoll interest list.
+     */
+    otbrError UpdateFd(int aFd, uint8_t aEventsMask);
+
+    /**
+     * This method unregisters a fd from the mainloop manager.
+     *
+     * It is safe to call this method from a fd callback, including the callback of @p aFd itself.
+     * The fd must be removed before it is closed.
+     *
+     * @param[in] aFd  The fd to remove.
+     */
+    void RemoveFd(int aFd);
+
+    /**
+     * This method returns a snapshot of the statistics of all mainloop processors.
+     *
+     * The statistics are recorded by `Update()` and `Process()`, so this method must be called
+     * on the mainloop thread.
+     *
+     * @returns The statistics of the mainloop processors, in the order of registration.
+     */
+    std::vector<MainloopProcessorStats> GetProcessorStats(void) const;
+
+    /**
+     * This method records tasks run on behalf of the mainloop processor being processed.
+     *
+     * The tasks are ignored if no processor is being processed.
+     *
+     * @param[in] aCount  The number of tasks run.
+     */
+    void RecordTasksRun(uint32_t aCount);
+
 private:
-    std::list<MainloopProcessor *> mMainloopProcessorList;
+#ifdef __linux__
+    static constexpr int kMaxEpollEvents = 64;
+#endif
+    // The fd sets are scanned in 64-bit chunks so that the fds of a processor are found without
+    // testing every fd below its max fd.
+    static constexpr int kFdsPerChunk = 64;
+
+    struct ProcessorEntry
+    {
+        explicit ProcessorEntry(MainloopProcessor *aProcessor);
+
+        // Set to `nullptr` when the processor is removed while the list is being iterated.
+        MainloopProcessor     *mProcessor;
+        MainloopProcessorStats mStats;
+
+        // The fds and `MainloopContext::k*FdSet` masks contributed by the latest `Update()`.
+        std::vector<std::pair<int, uint8_t>> mFds;
+    };
+
+    struct FdWatch
+    {
+        uint8_t    mEventsMask;
+        FdCallback mCallback;
+    };
+
+#ifdef __linux__
+    static uint32_t ToEpollEvents(uint8_t aEventsMask);
+    static uint8_t  FromEpollEvents(uint32_t aEpollEvents);
+#endif
+    static uint8_t GetReadyEvents(const MainloopContext &aMainloop, int aFd, uint8_t aEventsMask);
+
+    static size_t   GetFdSetsLength(int aMaxFd);
+    static bool     IsFdChunkEmpty(const fd_set &aFdSet, int aFd);
+    static void     RecordFds(const MainloopContext &aContext, ProcessorEntry &aEntry);
+    static void     MergeFds(const MainloopContext &aContext, MainloopContext &aMainloop);
+    static void     MergeFdSet(const fd_set &aFrom, fd_set &aTo, size_t aLength);
+    static bool     IsAnyFdReady(const MainloopContext &aMainloop, const ProcessorEntry &aEntry);
+    static uint32_t ToMicroseconds(Timepoint aStart, Timepoint aEnd);
+    static uint8_t  GetTimeBucket(uint32_t aTimeUs);
+
+    bool IsAnyWatchedFdReady(const MainloopContext &aMainloop) const;
+    void ProcessFds(const MainloopContext &aMainloop);
+    void PurgeRemovedProcessors(void);
+
+    std::list<ProcessorEntry> mMainloopProcessorList;
+    bool                      mIsIterating;
+    ProcessorEntry           *mCurrentEntry;
+    ProcessorEntry           *mTimeoutOwner;
+
+    // Each processor updates this context so that only the fds it contributes are recorded and
+    // merged into the mainloop context.
+    MainloopContext mProcessorContext;
+
+    // The epoll fd that holds the registered fds, created by the first `AddFd()`. The epoll fd
+    // itself is added to the read fd set so that it can be multiplexed with the legacy
+    // `Update/Process` fds. Always -1 on platforms without epoll.
+    int                                               mEpollFd;
+    std::unordered_map<int, std::shared_ptr<FdWatch>> mFdWatches;
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
@@ -0,0 +1,170 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a lock-free multi-producer single-consumer queue.
+ */
+
+#ifndef OTBR_COMMON_MPSC_QUEUE_HPP_
+#define OTBR_COMMON_MPSC_QUEUE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <utility>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements an unbounded, lock-free multi-producer single-consumer FIFO queue.
+ *
+ * Producers never block (a push is a single atomic exchange). The consumer never blocks either,
+ * but `Pop()` may transiently report the queue as empty while a producer is in the middle of
+ * a push. A producer which signals the consumer after `Push()` returns guarantees that the
+ * consumer observes the item after it has been woken up.
+ *
+ * @tparam T  The item type, which must be default constructible and movable.
+ */
+template <typename T> class MpscQueue : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty queue.
+     */
+    MpscQueue(void)
+        : mHead(&mStub)
+        , mTail(&mStub)
+    {
+    }
+
+    /**
+     * This destructor releases all items remaining in the queue.
+     *
+     * The queue must not be accessed by producers when it is destroyed.
+     */
+    ~MpscQueue(void)
+    {
+        T item;
+
+        while (Pop(item))
+        {
+        }
+    }
+
+    /**
+     * This method pushes an item to the tail of the queue.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aItem  The item to push.
+     */
+    void Push(T aItem) { PushNode(new Node(std::move(aItem))); }
+
+    /**
+     * This method pops an item from the head of the queue.
+     *
+     * This method must only be called by the single consumer thread.
+     *
+     * @param[out] aItem  A reference to receive the popped item.
+     *
+     * @retval TRUE   Successfully popped an item.
+     * @retval FALSE  The queue is empty or the next item is not completely pushed yet.
+     */
+    bool Pop(T &aItem)
+    {
+        bool  popped = false;
+        Node *tail   = mTail;
+        Node *next   = tail->mNext.load(std::memory_order_acquire);
+
+        if (tail == &mStub)
+        {
+            VerifyOrExit(next != nullptr);
+            mTail = next;
+            tail  = next;
+            next  = next->mNext.load(std::memory_order_acquire);
+        }
+
+        if (next == nullptr)
+        {
+            // Either `tail` is the last item or a producer has swapped the head but not
+            // linked its node yet. In the latter case, wait for the producer's signal.
+            VerifyOrExit(tail == mHead.load(std::memory_order_acquire));
+
+            // Re-insert the stub so that the last item can be detached.
+            PushNode(&mStub);
+            next = tail->mNext.load(std::memory_order_acquire);
+            VerifyOrExit(next != nullptr);
+        }
+
+        mTail  = next;
+        aItem  = std::move(tail->mItem);
+        popped = true;
+        delete tail;
+
+    exit:
+        return popped;
+    }
+
+private:
+    struct Node
+    {
+        Node(void)
+            : mNext(nullptr)
+        {
+        }
+
+        explicit Node(T &&aItem)
+            : mNext(nullptr)
+            , mItem(std::move(aItem))
+        {
+        }
+
+        std::atomic<Node *> mNext;
+        T                   mItem;
+    };
+
+    void PushNode(Node *aNode)
+    {
+        Node *prev;
+
+        aNode->mNext.store(nullptr, std::memory_order_relaxed);
+        prev = mHead.exchange(aNode, std::memory_order_acq_rel);
+        prev->mNext.store(aNode, std::memory_order_release);
+    }
+
+    std::atomic<Node *> mHead; // Written by producers.
+    Node               *mTail; // Only accessed by the consumer.
+    Node                mStub;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MPSC_QUEUE_HPP_
@@ -0,0 +1,247 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the pooled, reference-counted packet buffers.
+ */
+
+#include "common/packet_buffer.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <string.h>
+
+namespace otbr {
+
+PacketBuffer::PacketBuffer(void)
+    : mSlot(nullptr)
+    , mOffset(0)
+    , mLength(0)
+{
+}
+
+PacketBuffer::PacketBuffer(Slot &aSlot, uint16_t aOffset)
+    : mSlot(&aSlot)
+    , mOffset(aOffset)
+    , mLength(0)
+{
+}
+
+PacketBuffer::PacketBuffer(const PacketBuffer &aOther)
+    : mSlot(aOther.mSlot)
+    , mOffset(aOther.mOffset)
+    , mLength(aOther.mLength)
+    , mTimestamp(aOther.mTimestamp)
+{
+    if (mSlot != nullptr)
+    {
+        mSlot->mRefCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+PacketBuffer::PacketBuffer(PacketBuffer &&aOther)
+    : mSlot(aOther.mSlot)
+    , mOffset(aOther.mOffset)
+    , mLength(aOther.mLength)
+    , mTimestamp(aOther.mTimestamp)
+{
+    aOther.mSlot   = nullptr;
+    aOther.mOffset = 0;
+    aOther.mLength = 0;
+}
+
+PacketBuffer &PacketBuffer::operator=(const PacketBuffer &aOther)
+{
+    if (this != &aOther)
+    {
+        PacketBuffer copy(aOther);
+
+        *this = std::move(copy);
+    }
+
+    return *this;
+}
+
+PacketBuffer &PacketBuffer::operator=(PacketBuffer &&aOther)
+{
+    if (this != &aOther)
+    {
+        Reset();
+
+        mSlot          = aOther.mSlot;
+        mOffset        = aOther.mOffset;
+        mLength        = aOther.mLength;
+        mTimestamp     = aOther.mTimestamp;
+        aOther.mSlot   = nullptr;
+        aOther.mOffset = 0;
+        aOther.mLength = 0;
+    }
+
+    return *this;
+}
+
+PacketBuffer::~PacketBuffer(void)
+{
+    Reset();
+}
+
+void PacketBuffer::Reset(void)
+{
+    VerifyOrExit(mSlot != nullptr);
+
+    if (mSlot->mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        mSlot->mPool->Free(*mSlot);
+    }
+
+    mSlot   = nullptr;
+    mOffset = 0;
+    mLength = 0;
+
+exit:
+    return;
+}
+
+uint8_t *PacketBuffer::GetData(void) const
+{
+    return mSlot == nullptr ? nullptr : mSlot->mData.get() + mOffset;
+}
+
+uint16_t PacketBuffer::GetCapacity(void) const
+{
+    uint16_t capacity = 0;
+
+    VerifyOrExit(mSlot != nullptr);
+    capacity = mSlot->mPool->GetHeadroom() + mSlot->mPool->GetDataSize() - mOffset;
+
+exit:
+    return capacity;
+}
+
+otbrError PacketBuffer::SetLength(uint16_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aLength <= GetCapacity(), error = OTBR_ERROR_INVALID_ARGS);
+    mLength = aLength;
+
+exit:
+    return error;
+}
+
+otbrError PacketBuffer::Prepend(const uint8_t *aHeader, uint16_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mSlot != nullptr && aLength <= mOffset, error = OTBR_ERROR_INVALID_ARGS);
+
+    mOffset -= aLength;
+    mLength += aLength;
+    memcpy(GetData(), aHeader, aLength);
+
+exit:
+    return error;
+}
+
+otbrError PacketBuffer::RemoveHeader(uint16_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aLength <= mLength, error = OTBR_ERROR_INVALID_ARGS);
+
+    mOffset += aLength;
+    mLength -= aLength;
+
+exit:
+    return error;
+}
+
+uint32_t PacketBuffer::GetRefCount(void) const
+{
+    return mSlot == nullptr ? 0 : mSlot->mRefCount.load(std::memory_order_relaxed);
+}
+
+PacketBufferPool::PacketBufferPool(size_t aCapacity, uint16_t aDataSize, uint16_t aHeadroom)
+    : mCapacity(aCapacity)
+    , mDataSize(aDataSize)
+    , mHeadroom(aHeadroom)
+{
+    memset(&mCounters, 0, sizeof(mCounters));
+    mSlots.reserve(aCapacity);
+    mFreeSlots.reserve(aCapacity);
+}
+
+PacketBuffer PacketBufferPool::Allocate(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    PacketBuffer::Slot         *slot = nullptr;
+
+    if (!mFreeSlots.empty())
+    {
+        slot = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    }
+    else if (mSlots.size() < mCapacity)
+    {
+        mSlots.emplace_back(new PacketBuffer::Slot());
+        slot        = mSlots.back().get();
+        slot->mPool = this;
+        slot->mData.reset(new uint8_t[mHeadroom + mDataSize]);
+        mCounters.mCreatedBuffers++;
+    }
+
+    VerifyOrExit(slot != nullptr, mCounters.mFailures++);
+
+    slot->mRefCount.store(1, std::memory_order_relaxed);
+    mCounters.mAllocations++;
+    mCounters.mInUse++;
+    mCounters.mMaxInUse = std::max(mCounters.mMaxInUse, mCounters.mInUse);
+
+exit:
+    return slot == nullptr ? PacketBuffer() : PacketBuffer(*slot, mHeadroom);
+}
+
+PacketBufferPool::Counters PacketBufferPool::GetCounters(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mCounters;
+}
+
+void PacketBufferPool::Free(PacketBuffer::Slot &aSlot)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    assert(mCounters.mInUse > 0);
+    mCounters.mInUse--;
+    mFreeSlots.push_back(&aSlot);
+}
+
+} // namespace otbr
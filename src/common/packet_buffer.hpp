@@ -0,0 +1,268 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the pooled, reference-counted packet buffers.
+ */
+
+#ifndef OTBR_COMMON_PACKET_BUFFER_HPP_
+#define OTBR_COMMON_PACKET_BUFFER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+class PacketBufferPool;
+
+/**
+ * This class represents a reference-counted view of a buffer allocated from a `PacketBufferPool`.
+ *
+ * Copying a `PacketBuffer` shares the underlying buffer, the buffer returns to its pool when the last
+ * view is destroyed. Each buffer reserves a headroom in front of the data so that lower layers can
+ * prepend their headers in place instead of copying the packet into a new frame.
+ *
+ * The views of the same buffer share the bytes but not the offset or length, so moving the data start
+ * of one view with `Prepend()` doesn't affect the others.
+ */
+class PacketBuffer
+{
+public:
+    /**
+     * This constructor creates a null view.
+     */
+    PacketBuffer(void);
+
+    PacketBuffer(const PacketBuffer &aOther);
+    PacketBuffer(PacketBuffer &&aOther);
+    PacketBuffer &operator=(const PacketBuffer &aOther);
+    PacketBuffer &operator=(PacketBuffer &&aOther);
+    ~PacketBuffer(void);
+
+    /**
+     * This method indicates whether the view refers to a buffer.
+     *
+     * @retval TRUE   The view is null.
+     * @retval FALSE  The view refers to a buffer.
+     */
+    bool IsNull(void) const { return mSlot == nullptr; }
+
+    /**
+     * This method releases the view, the buffer returns to its pool if this is the last view.
+     */
+    void Reset(void);
+
+    /**
+     * This method returns the start of the data.
+     *
+     * @returns A pointer to the data, nullptr if the view is null.
+     */
+    uint8_t *GetData(void) const;
+
+    /**
+     * This method returns the length of the data.
+     *
+     * @returns The length of the data in bytes.
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method sets the length of the data.
+     *
+     * @param[in] aLength  The length of the data in bytes.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully set the length.
+     * @retval OTBR_ERROR_INVALID_ARGS  @p aLength exceeds the space after the data start.
+     */
+    otbrError SetLength(uint16_t aLength);
+
+    /**
+     * This method returns the number of bytes available in front of the data.
+     *
+     * @returns The headroom in bytes.
+     */
+    uint16_t GetHeadroom(void) const { return mOffset; }
+
+    /**
+     * This method returns the number of bytes the data may grow to without moving the data start.
+     *
+     * @returns The capacity in bytes.
+     */
+    uint16_t GetCapacity(void) const;
+
+    /**
+     * This method moves the data start backwards and copies @p aHeader into the headroom.
+     *
+     * @param[in] aHeader  A pointer to the header.
+     * @param[in] aLength  The length of the header.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully prepended the header.
+     * @retval OTBR_ERROR_INVALID_ARGS  The headroom is too small for @p aLength bytes.
+     */
+    otbrError Prepend(const uint8_t *aHeader, uint16_t aLength);
+
+    /**
+     * This method moves the data start forwards, dropping @p aLength bytes from the front of the data.
+     *
+     * @param[in] aLength  The number of bytes to remove.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully removed the bytes.
+     * @retval OTBR_ERROR_INVALID_ARGS  @p aLength exceeds the length of the data.
+     */
+    otbrError RemoveHeader(uint16_t aLength);
+
+    /**
+     * This method returns the number of views which share the buffer.
+     *
+     * @returns The reference count, zero if the view is null.
+     */
+    uint32_t GetRefCount(void) const;
+
+    /**
+     * This method sets the timestamp of the view, e.g. the time the packet was queued.
+     *
+     * @param[in] aTimestamp  The timestamp.
+     */
+    void SetTimestamp(Timepoint aTimestamp) { mTimestamp = aTimestamp; }
+
+    /**
+     * This method returns the timestamp of the view.
+     *
+     * @returns The timestamp set by `SetTimestamp()`, or the epoch of `Clock` if not set.
+     */
+    Timepoint GetTimestamp(void) const { return mTimestamp; }
+
+private:
+    friend class PacketBufferPool;
+
+    struct Slot
+    {
+        PacketBufferPool          *mPool;
+        std::atomic<uint32_t>      mRefCount;
+        std::unique_ptr<uint8_t[]> mData;
+    };
+
+    PacketBuffer(Slot &aSlot, uint16_t aOffset);
+
+    Slot     *mSlot;
+    uint16_t  mOffset;
+    uint16_t  mLength;
+    Timepoint mTimestamp;
+};
+
+/**
+ * This class implements a pool of fixed-size packet buffers.
+ *
+ * The buffers are allocated lazily up to the capacity of the pool and recycled afterwards, so the
+ * steady state doesn't touch the heap. Allocation and release are safe from different threads. The
+ * pool must outlive all the buffers allocated from it.
+ */
+class PacketBufferPool : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the counters of a pool.
+     */
+    struct Counters
+    {
+        uint64_t mAllocations;    ///< The number of successful allocations.
+        uint64_t mFailures;       ///< The number of allocations which failed because the pool was exhausted.
+        uint32_t mInUse;          ///< The number of buffers currently allocated.
+        uint32_t mMaxInUse;       ///< The largest number of buffers allocated at once.
+        uint32_t mCreatedBuffers; ///< The number of buffers created so far.
+    };
+
+    /**
+     * This constructor initializes the pool.
+     *
+     * @param[in] aCapacity  The maximum number of buffers.
+     * @param[in] aDataSize  The number of data bytes of each buffer, not including the headroom.
+     * @param[in] aHeadroom  The number of bytes reserved in front of the data of each buffer.
+     */
+    PacketBufferPool(size_t aCapacity, uint16_t aDataSize, uint16_t aHeadroom);
+
+    /**
+     * This method allocates a buffer.
+     *
+     * The view of the new buffer starts after the headroom and has a zero length.
+     *
+     * @returns The view of the buffer, or a null view if the pool is exhausted.
+     */
+    PacketBuffer Allocate(void);
+
+    /**
+     * This method returns the number of data bytes of each buffer.
+     *
+     * @returns The data size in bytes.
+     */
+    uint16_t GetDataSize(void) const { return mDataSize; }
+
+    /**
+     * This method returns the headroom reserved in each buffer.
+     *
+     * @returns The headroom in bytes.
+     */
+    uint16_t GetHeadroom(void) const { return mHeadroom; }
+
+    /**
+     * This method returns the counters of the pool.
+     *
+     * @returns The counters.
+     */
+    Counters GetCounters(void) const;
+
+private:
+    friend class PacketBuffer;
+
+    void Free(PacketBuffer::Slot &aSlot);
+
+    const size_t   mCapacity;
+    const uint16_t mDataSize;
+    const uint16_t mHeadroom;
+
+    mutable std::mutex                               mMutex;
+    std::vector<std::unique_ptr<PacketBuffer::Slot>> mSlots;
+    std::vector<PacketBuffer::Slot *>                mFreeSlots;
+    Counters                                         mCounters;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_PACKET_BUFFER_HPP_
@@ -37,14 +37,28 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
 
 #include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
 
 namespace otbr {
 
-TaskRunner::TaskRunner(void)
-    : mTaskQueue(DelayedTask::Comparator{})
+constexpr uint8_t TaskRunner::kNumPriorities;
+constexpr uint8_t TaskRunner::kMaxBypassCount;
+
+TaskRunner::TaskRunner(const char *aName)
+    : mName(aName)
+    , mWakeupPending(false)
 {
+#ifdef __linux__
+    // We do not handle failures when creating an eventfd, simply die.
+    mEventFd[kRead] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrDie(mEventFd[kRead] != -1, strerror(errno));
+    mEventFd[kWrite] = mEventFd[kRead];
+#else
     int flags;
 
     // We do not handle failures when creating a pipe, simply die.
@@ -54,30 +68,43 @@ TaskRunner::TaskRunner(void)
     VerifyOrDie(fcntl(mEventFd[kRead], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
     flags = fcntl(mEventFd[kWrite], F_GETFL, 0);
     VerifyOrDie(fcntl(mEventFd[kWrite], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
+#endif
 }
 
 TaskRunner::~TaskRunner(void)
 {
+    if (mEventFd[kWrite] != -1 && mEventFd[kWrite] != mEventFd[kRead])
+    {
+        close(mEventFd[kWrite]);
+    }
+    mEventFd[kWrite] = -1;
+
     if (mEventFd[kRead] != -1)
     {
         close(mEventFd[kRead]);
         mEventFd[kRead] = -1;
     }
-    if (mEventFd[kWrite] != -1)
-    {
-        close(mEventFd[kWrite]);
-        mEventFd[kWrite] = -1;
-    }
 }
 
-void TaskRunner::Post(Task<void> aTask)
+void TaskRunner::Post(Priority aPriority, Task<void> aTask)
 {
-    Post(Milliseconds::zero(), std::move(aTask));
+    uint8_t index = static_cast<uint8_t>(aPriority);
+    Lane   &lane  = mLanes[index];
+
+    lane.mQueueDepth.fetch_add(1);
+    UpdateMaxQueueDepth(lane, GetQueueDepth(index));
+
+    lane.mTasks.Push(std::move(aTask));
+    Wakeup();
 }
 
 TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask)
 {
-    return PushTask(aDelay, std::move(aTask));
+    TaskId taskId = PushTask(aDelay, std::move(aTask));
+
+    Wakeup();
+
+    return taskId;
 }
 
 void TaskRunner::Update(MainloopContext &aMainloop)
@@ -86,15 +113,15 @@ void TaskRunner::Update(MainloopContext &aMainloop)
 
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
+        Timepoint                   serviceTime;
 
-        if (!mTaskQueue.empty())
+        if (mTimerWheel.GetNextServiceTime(serviceTime))
         {
-            auto  now     = Clock::now();
-            auto &task    = mTaskQueue.top();
-            auto  delay   = std::chrono::duration_cast<Microseconds>(task.GetTimeExecute() - now);
-            auto  timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+            auto now     = Clock::now();
+            auto delay   = std::chrono::duration_cast<Microseconds>(serviceTime - now);
+            auto timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
 
-            if (task.GetTimeExecute() < now)
+            if (serviceTime < now)
             {
                 delay = Microseconds::zero();
             }
@@ -114,6 +141,20 @@ void TaskRunner::Process(const MainloopContext &aMainloop)
 
     VerifyOrExit(FD_ISSET(mEventFd[kRead], &aMainloop.mReadFdSet));
 
+#ifdef __linux__
+    {
+        uint64_t counter;
+
+        // A single read consumes all the coalesced wakeups.
+        do
+        {
+            rval = read(mEventFd[kRead], &counter, sizeof(counter));
+        } while (rval == -1 && errno == EINTR);
+
+        // Critical error happens, simply die.
+        VerifyOrDie(rval == sizeof(counter) || errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
+    }
+#else
     // Read any data in the pipe.
     do
     {
@@ -124,41 +165,46 @@ void TaskRunner::Process(const MainloopContext &aMainloop)
 
     // Critical error happens, simply die.
     VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
+#endif
+
+    // Must be cleared before draining the queues so that a task pushed
+    // after this point always signals the `mEventFd` again.
+    mWakeupPending.store(false);
 
 exit:
     PopTasks();
 }
 
-TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
+void TaskRunner::Wakeup(void)
 {
-    ssize_t       rval;
+    ssize_t rval;
+#ifdef __linux__
+    const uint64_t kOne = 1;
+#else
     const uint8_t kOne = 1;
-    TaskId        taskId;
+#endif
 
-    {
-        std::lock_guard<std::mutex> _(mTaskQueueMutex);
-
-        taskId = mNextTaskId++;
-
-        mActiveTaskIds.insert(taskId);
-        mTaskQueue.emplace(taskId, aDelay, std::move(aTask));
-    }
+    VerifyOrExit(!mWakeupPending.exchange(true));
 
     do
     {
         rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
     } while (rval == -1 && errno == EINTR);
 
-    VerifyOrExit(rval == -1);
-
     // Critical error happens, simply die.
-    VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
-
-    // We are blocked because there are already data (written by other concurrent callers in
-    // different threads) in the pipe, and the mEventFd[kRead] should be readable now.
-    otbrLogWarning("Failed to write fd %d: %s", mEventFd[kWrite], strerror(errno));
+    VerifyOrDie(rval == sizeof(kOne), strerror(errno));
 
 exit:
+    return;
+}
+
+TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
+{
+    std::lock_guard<std::mutex> _(mTaskQueueMutex);
+    TaskId                      taskId = mNextTaskId++;
+
+    mTimerWheel.Add(taskId, Clock::now() + aDelay, std::move(aTask));
+
     return taskId;
 }
 
@@ -166,40 +212,152 @@ void TaskRunner::Cancel(TaskRunner::TaskId aTaskId)
 {
     std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-    mActiveTaskIds.erase(aTaskId);
+    if (mTimerWheel.Remove(aTaskId))
+    {
+        UpdateExpiredTaskCount();
+    }
 }
 
-void TaskRunner::PopTasks(void)
+void TaskRunner::UpdateMaxQueueDepth(Lane &aLane, uint32_t aDepth)
 {
-    while (true)
+    uint32_t maxDepth = aLane.mMaxQueueDepth.load();
+
+    while (aDepth > maxDepth && !aLane.mMaxQueueDepth.compare_exchange_weak(maxDepth, aDepth))
     {
-        Task<void> task;
-        bool       canceled;
+    }
+}
 
-        // The braces here are necessary for auto-releasing of the mutex.
-        {
-            std::lock_guard<std::mutex> _(mTaskQueueMutex);
+void TaskRunner::UpdateExpiredTaskCount(void)
+{
+    uint8_t normal = static_cast<uint8_t>(Priority::kNormal);
 
-            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= Clock::now())
-            {
-                const DelayedTask &top    = mTaskQueue.top();
-                TaskId             taskId = top.mTaskId;
+    mExpiredTaskCount.store(static_cast<uint32_t>(mTimerWheel.GetExpiredCount(Clock::now())));
+    UpdateMaxQueueDepth(mLanes[normal], GetQueueDepth(normal));
+}
 
-                task = std::move(top.mTask);
-                mTaskQueue.pop();
-                canceled = (mActiveTaskIds.erase(taskId) == 0);
-            }
-            else
-            {
-                break;
-            }
+uint32_t TaskRunner::GetQueueDepth(uint8_t aLane) const
+{
+    uint32_t depth = mLanes[aLane].mQueueDepth.load();
+
+    if (aLane == static_cast<uint8_t>(Priority::kNormal))
+    {
+        depth += mExpiredTaskCount.load();
+    }
+
+    return depth;
+}
+
+bool TaskRunner::PopDelayedTask(Task<void> &aTask)
+{
+    std::lock_guard<std::mutex> _(mTaskQueueMutex);
+    bool                        popped = mTimerWheel.PopExpired(Clock::now(), aTask);
+
+    UpdateExpiredTaskCount();
+
+    return popped;
+}
+
+TaskRunner::LaneStats TaskRunner::GetLaneStats(Priority aPriority) const
+{
+    const Lane &lane = mLanes[static_cast<uint8_t>(aPriority)];
+    LaneStats   stats;
+
+    stats.mQueueDepth    = GetQueueDepth(static_cast<uint8_t>(aPriority));
+    stats.mMaxQueueDepth = lane.mMaxQueueDepth.load();
+    stats.mTasksRun      = lane.mTasksRun.load();
+    stats.mPromotions    = lane.mPromotions.load();
+
+    return stats;
+}
+
+bool TaskRunner::PopLaneTask(uint8_t aLane, Task<void> &aTask)
+{
+    Lane &lane   = mLanes[aLane];
+    bool  popped = lane.mTasks.Pop(aTask);
+
+    if (popped)
+    {
+        lane.mQueueDepth.fetch_sub(1);
+    }
+    else if (aLane == static_cast<uint8_t>(Priority::kNormal))
+    {
+        popped = PopDelayedTask(aTask);
+    }
+
+    if (popped)
+    {
+        lane.mTasksRun.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return popped;
+}
+
+bool TaskRunner::PopNextTask(Task<void> &aTask)
+{
+    uint8_t served = kNumPriorities;
+
+    // A lane which has been bypassed too many times is served first,
+    // starting from the lowest priority one.
+    for (uint8_t i = kNumPriorities; i > 0 && served == kNumPriorities; i--)
+    {
+        if (mLanes[i - 1].mBypassCount >= kMaxBypassCount && PopLaneTask(i - 1, aTask))
+        {
+            served = i - 1;
+            mLanes[served].mPromotions.fetch_add(1, std::memory_order_relaxed);
         }
+    }
 
-        if (!canceled)
+    for (uint8_t i = 0; i < kNumPriorities && served == kNumPriorities; i++)
+    {
+        if (PopLaneTask(i, aTask))
+        {
+            served = i;
+        }
+    }
+
+    VerifyOrExit(served != kNumPriorities);
+
+    mLanes[served].mBypassCount = 0;
+
+    for (uint8_t i = served + 1; i < kNumPriorities; i++)
+    {
+        if (GetQueueDepth(i) > 0)
+        {
+            mLanes[i].mBypassCount++;
+        }
+        else
         {
-            task();
+            mLanes[i].mBypassCount = 0;
         }
     }
+
+exit:
+    return served != kNumPriorities;
+}
+
+void TaskRunner::PopTasks(void)
+{
+    Task<void> task;
+    uint32_t   count = 0;
+
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+        // Counts the delayed tasks expired since the last time in the normal lane, so that
+        // they take part in the bypass accounting of the lanes.
+        UpdateExpiredTaskCount();
+    }
+
+    while (PopNextTask(task))
+    {
+        task();
+        count++;
+    }
+
+    if (count > 0)
+    {
+        MainloopManager::GetInstance().RecordTasksRun(count);
+    }
 }
 
 } // namespace otbr
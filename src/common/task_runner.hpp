@@ -36,16 +36,17 @@
 
 #include <openthread-br/config.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <future>
 #include <mutex>
-#include <queue>
-#include <set>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/mpsc_queue.hpp"
 #include "common/time.hpp"
+#include "common/timer_wheel.hpp"
 
 namespace otbr {
 
@@ -68,10 +69,41 @@ public:
      */
     typedef uint64_t TaskId;
 
+    /**
+     * This enumeration represents the priority lanes of immediate tasks.
+     */
+    enum class Priority : uint8_t
+    {
+        kHigh   = 0, ///< Latency-sensitive tasks, e.g. Spinel command results and DNS-SD subscription updates.
+        kNormal = 1, ///< The default priority.
+        kLow    = 2, ///< Management work, e.g. REST requests and telemetry.
+    };
+
+    static constexpr uint8_t kNumPriorities = 3; ///< The number of priority lanes.
+
+    /**
+     * The maximum number of times a non-empty lane can be bypassed by tasks in higher
+     * priority lanes before one of its tasks is executed.
+     */
+    static constexpr uint8_t kMaxBypassCount = 8;
+
+    /**
+     * This structure represents the statistics of a priority lane.
+     */
+    struct LaneStats
+    {
+        uint32_t mQueueDepth;    ///< The number of tasks currently waiting in the lane, see `GetLaneStats()`.
+        uint32_t mMaxQueueDepth; ///< The maximum number of tasks ever waiting in the lane.
+        uint64_t mTasksRun;      ///< The number of tasks executed from the lane.
+        uint64_t mPromotions;    ///< The number of times the lane was served ahead of higher priority lanes.
+    };
+
     /**
      * This constructor initializes the Task Runner instance.
+     *
+     * @param[in] aName  The name that attributes the tasks run to the owner in the mainloop statistics.
      */
-    TaskRunner(void);
+    explicit TaskRunner(const char *aName = "TaskRunner");
 
     /**
      * This destructor destroys the Task Runner instance.
@@ -82,11 +114,25 @@ public:
      * This method posts a task to the task runner and returns immediately.
      *
      * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
-     * It is safe to call this method in different threads concurrently.
+     * It is safe to call this method in different threads concurrently. This method
+     * doesn't take any lock and wakes up the mainloop at most once per iteration.
      *
      * @param[in] aTask  The task to be executed.
      */
-    void Post(Task<void> aTask);
+    void Post(Task<void> aTask) { Post(Priority::kNormal, std::move(aTask)); }
+
+    /**
+     * This method posts a task to the given priority lane of the task runner and returns immediately.
+     *
+     * Tasks in higher priority lanes are executed first, tasks in the same lane follow the
+     * First-Come-First-Serve rule. A non-empty lane is never bypassed more than `kMaxBypassCount`
+     * times in a row, so lower priority tasks are not starved. Delayed tasks are executed with the
+     * normal priority once expired. It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aPriority  The priority lane of the task.
+     * @param[in] aTask      The task to be executed.
+     */
+    void Post(Priority aPriority, Task<void> aTask);
 
     /**
      * This method posts a task to the task runner and returns immediately.
@@ -94,6 +140,10 @@ public:
      * The task will be executed on the mainloop after `aDelay` milliseconds from now.
      * It is safe to call this method in different threads concurrently.
      *
+     * Expired delayed tasks, including those posted with a zero delay, are executed once the
+     * normal lane is empty. So a task posted with `Post(aTask)` runs before a zero-delay task
+     * posted earlier. Use `Post(aTask)` when the order relative to other immediate tasks matters.
+     *
      * @param[in] aDelay  The delay before executing the task (in milliseconds).
      * @param[in] aTask   The task to be executed.
      *
@@ -103,12 +153,27 @@ public:
 
     /**
      * This method cancels a delayed task from the task runner.
+     *
+     * The task and its captured state are released immediately.
      * It is safe to call this method in different threads concurrently.
      *
      * @param[in] aTaskId  The unique task ID of the delayed task to cancel.
      */
     void Cancel(TaskId aTaskId);
 
+    /**
+     * This method returns the statistics of a priority lane.
+     *
+     * Expired delayed tasks are counted in the normal lane, which they are executed from. They are
+     * counted when the mainloop serves the task runner, not as soon as they expire.
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aPriority  The priority lane.
+     *
+     * @returns The statistics of the lane.
+     */
+    LaneStats GetLaneStats(Priority aPriority) const;
+
     /**
      * This method posts a task and waits for the completion of the task.
      *
@@ -116,81 +181,115 @@ public:
      * This method must be called in a thread other than the mainloop thread. Otherwise,
      * the caller will be blocked forever.
      *
+     * @param[in] aTask      The task to be executed.
+     * @param[in] aDelay     The delay before executing the task.
+     * @param[in] aPriority  The priority lane of the task, ignored for delayed tasks.
+     *
      * @returns The result returned by the task @p aTask.
      */
-    template <class T> T PostAndWait(const Task<T> &aTask, Milliseconds aDelay = Milliseconds::zero())
+    template <class T>
+    T PostAndWait(const Task<T> &aTask,
+                  Milliseconds   aDelay    = Milliseconds::zero(),
+                  Priority       aPriority = Priority::kNormal)
     {
         std::promise<T> pro;
+        Task<void>      task = [&pro, &aTask]() { pro.set_value(aTask()); };
 
-        Post(aDelay, [&pro, &aTask]() { pro.set_value(aTask()); });
+        if (aDelay == Milliseconds::zero())
+        {
+            Post(aPriority, std::move(task));
+        }
+        else
+        {
+            Post(aDelay, std::move(task));
+        }
 
         return pro.get_future().get();
     }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return mName; }
 
 private:
-    enum
+    struct Lane
     {
-        kRead  = 0,
-        kWrite = 1,
+        MpscQueue<Task<void>> mTasks;
+        std::atomic<uint32_t> mQueueDepth{0};
+        std::atomic<uint32_t> mMaxQueueDepth{0};
+        std::atomic<uint64_t> mTasksRun{0};
+        std::atomic<uint64_t> mPromotions{0};
+
+        // Only accessed by the mainloop thread.
+        uint8_t mBypassCount = 0;
     };
 
-    struct DelayedTask
-    {
-        friend class Comparator;
+    static void UpdateMaxQueueDepth(Lane &aLane, uint32_t aDepth);
 
-        struct Comparator
-        {
-            bool operator()(const DelayedTask &aLhs, const DelayedTask &aRhs) const { return aRhs < aLhs; }
-        };
+    TaskId   PushTask(Milliseconds aDelay, Task<void> aTask);
+    void     UpdateExpiredTaskCount(void);
+    uint32_t GetQueueDepth(uint8_t aLane) const;
+    bool     PopDelayedTask(Task<void> &aTask);
+    bool     PopLaneTask(uint8_t aLane, Task<void> &aTask);
+    bool     PopNextTask(Task<void> &aTask);
+    void     PopTasks(void);
+    void     Wakeup(void);
 
-        DelayedTask(TaskId aTaskId, Milliseconds aDelay, Task<void> aTask)
-            : mTaskId(aTaskId)
-            , mDeadline(Clock::now() + aDelay)
-            , mTask(std::move(aTask))
-        {
-        }
-
-        bool operator<(const DelayedTask &aOther) const
-        {
-            return mDeadline <= aOther.mDeadline || (mDeadline == aOther.mDeadline && mTaskId < aOther.mTaskId);
-        }
-
-        Timepoint GetTimeExecute(void) const { return mDeadline; }
-
-        TaskId     mTaskId;
-        Timepoint  mDeadline;
-        Task<void> mTask;
+    enum
+    {
+        kRead  = 0,
+        kWrite = 1,
     };
 
-    TaskId PushTask(Milliseconds aDelay, Task<void> aTask);
-    void   PopTasks(void);
+    // The name reported in the mainloop statistics.
+    const char *mName;
 
-    // The event fds which are used to wakeup the mainloop
-    // when there are pending tasks in the task queue.
+    // The fds which are used to wakeup the mainloop when there are pending
+    // tasks in the task queues. On Linux both refer to the same eventfd,
+    // elsewhere they are the two ends of a pipe.
     int mEventFd[2];
 
-    std::priority_queue<DelayedTask, std::vector<DelayedTask>, DelayedTask::Comparator> mTaskQueue;
+    // Whether the `mEventFd` has been signaled since the last time the
+    // mainloop consumed it. Used to coalesce wakeups of concurrent posters.
+    std::atomic_bool mWakeupPending;
+
+    // The lanes of tasks to be executed immediately, indexed by `Priority`.
+    Lane mLanes[kNumPriorities];
 
-    std::set<TaskId> mActiveTaskIds;
-    TaskId           mNextTaskId = 1;
+    // The delayed tasks keyed by the task IDs. A canceled task is
+    // removed from the wheel and released immediately.
+    TimerWheel mTimerWheel;
+    TaskId     mNextTaskId = 1;
 
-    // The mutex which protects the `mTaskQueue` from being
+    // The number of expired delayed tasks in the `mTimerWheel`, which are
+    // counted in the queue depth of the normal lane. Only updated with the
+    // `mTaskQueueMutex` held.
+    std::atomic<uint32_t> mExpiredTaskCount{0};
+
+    // The mutex which protects the `mTimerWheel` from being
     // simultaneously accessed by multiple threads.
     std::mutex mTaskQueueMutex;
 };
 
 // specialization for void return type
-template <> inline void TaskRunner::PostAndWait<void>(const Task<void> &aTask, Milliseconds aDelay)
+template <>
+inline void TaskRunner::PostAndWait<void>(const Task<void> &aTask, Milliseconds aDelay, Priority aPriority)
 {
     std::promise<void> pro;
-    auto               fut = pro.get_future();
-    Post(aDelay, [&pro, &aTask]() {
+    auto               fut  = pro.get_future();
+    Task<void>         task = [&pro, &aTask]() {
         aTask();
         pro.set_value();
-    });
+    };
+
+    if (aDelay == Milliseconds::zero())
+    {
+        Post(aPriority, std::move(task));
+    }
+    else
+    {
+        Post(aDelay, std::move(task));
+    }
     fut.get();
 }
 
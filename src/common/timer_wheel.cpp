@@ -0,0 +1,333 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a hierarchical timer wheel.
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+
+namespace otbr {
+
+constexpr uint8_t  TimerWheel::kLevel0Bits;
+constexpr uint8_t  TimerWheel::kLevelNBits;
+constexpr uint8_t  TimerWheel::kNumLevels;
+constexpr size_t   TimerWheel::kLevel0Slots;
+constexpr size_t   TimerWheel::kLevelNSlots;
+constexpr uint64_t TimerWheel::kNoTick;
+constexpr uint8_t  TimerWheel::kMaxTickShift;
+
+TimerWheel::TimerWheel(Timepoint aEpoch)
+    : mEpoch(aEpoch)
+    , mCurrentTick(0)
+    , mNextServiceTick(kNoTick)
+    , mNextServiceTickValid(true)
+    , mLevel0Count(0)
+{
+}
+
+void TimerWheel::Add(TimerId aTimerId, Timepoint aDeadline, Handler aHandler)
+{
+    uint64_t   deadline = ToTick(aDeadline, /* aRoundUp */ true);
+    TimerList &list     = GetTargetList(deadline);
+
+    assert(mTimers.find(aTimerId) == mTimers.end());
+
+    list.push_back(Timer{aTimerId, deadline, std::move(aHandler), &list});
+    mTimers.emplace(aTimerId, std::prev(list.end()));
+
+    if (IsLevel0(&list))
+    {
+        mLevel0Count++;
+    }
+
+    mNextServiceTickValid = false;
+}
+
+bool TimerWheel::Remove(TimerId aTimerId)
+{
+    auto it      = mTimers.find(aTimerId);
+    bool removed = false;
+
+    VerifyOrExit(it != mTimers.end());
+
+    if (IsLevel0(it->second->mList))
+    {
+        mLevel0Count--;
+    }
+
+    it->second->mList->erase(it->second);
+    mTimers.erase(it);
+    mNextServiceTickValid = false;
+    removed               = true;
+
+exit:
+    return removed;
+}
+
+bool TimerWheel::PopExpired(Timepoint aNow, Handler &aHandler)
+{
+    bool popped = false;
+
+    Advance(ToTick(aNow, /* aRoundUp */ false));
+
+    VerifyOrExit(!mExpired.empty());
+
+    aHandler = std::move(mExpired.front().mHandler);
+    mTimers.erase(mExpired.front().mTimerId);
+    mExpired.pop_front();
+    mNextServiceTickValid = false;
+    popped                = true;
+
+exit:
+    return popped;
+}
+
+size_t TimerWheel::GetExpiredCount(Timepoint aNow)
+{
+    Advance(ToTick(aNow, /* aRoundUp */ false));
+
+    return mExpired.size();
+}
+
+bool TimerWheel::GetNextServiceTime(Timepoint &aTimepoint)
+{
+    if (!mNextServiceTickValid)
+    {
+        mNextServiceTick      = CalculateNextServiceTick();
+        mNextServiceTickValid = true;
+    }
+
+    if (mNextServiceTick != kNoTick)
+    {
+        aTimepoint = mEpoch + Milliseconds(mNextServiceTick);
+    }
+
+    return mNextServiceTick != kNoTick;
+}
+
+uint64_t TimerWheel::ToTick(Timepoint aTimepoint, bool aRoundUp) const
+{
+    uint64_t tick = 0;
+
+    if (aTimepoint > mEpoch)
+    {
+        auto elapsed = aTimepoint - mEpoch;
+
+        tick = static_cast<uint64_t>(std::chrono::duration_cast<Milliseconds>(elapsed).count());
+
+        if (aRoundUp && Milliseconds(tick) < elapsed)
+        {
+            tick++;
+        }
+    }
+
+    return tick;
+}
+
+TimerWheel::TimerList &TimerWheel::GetSlot(uint8_t aLevel, uint64_t aTick)
+{
+    return aLevel == 0 ? mLevel0[aTick & (kLevel0Slots - 1)]
+                       : mLevelN[aLevel - 1][(aTick >> GetShift(aLevel)) & (kLevelNSlots - 1)];
+}
+
+TimerWheel::TimerList &TimerWheel::GetTargetList(uint64_t aDeadline)
+{
+    uint64_t delta;
+
+    // Overdue timers are expired by the next processed tick.
+    if (aDeadline <= mCurrentTick)
+    {
+        return GetSlot(0, mCurrentTick);
+    }
+
+    delta = aDeadline - mCurrentTick;
+
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        if (delta < (static_cast<uint64_t>(GetNumSlots(level)) << GetShift(level)))
+        {
+            return GetSlot(level, aDeadline);
+        }
+    }
+
+    return mOverflow;
+}
+
+bool TimerWheel::IsLevel0(const TimerList *aList) const
+{
+    return aList >= &mLevel0.front() && aList <= &mLevel0.back();
+}
+
+void TimerWheel::Move(TimerList &aFrom, TimerList::iterator aIter, TimerList &aTo)
+{
+    mLevel0Count -= IsLevel0(&aFrom) ? 1 : 0;
+    mLevel0Count += IsLevel0(&aTo) ? 1 : 0;
+
+    // Splicing keeps the iterators in `mTimers` valid.
+    aIter->mList = &aTo;
+    aTo.splice(aTo.end(), aFrom, aIter);
+}
+
+void TimerWheel::Cascade(TimerList &aList)
+{
+    TimerList pending;
+
+    // Detaches the timers first since some of them may be placed back to `aList`.
+    pending.splice(pending.end(), aList);
+
+    while (!pending.empty())
+    {
+        Move(pending, pending.begin(), GetTargetList(pending.front().mDeadline));
+    }
+}
+
+void TimerWheel::Advance(uint64_t aNowTick)
+{
+    VerifyOrExit(mCurrentTick <= aNowTick);
+
+    // Any cascade may change the next service time.
+    mNextServiceTickValid = false;
+
+    while (mCurrentTick <= aNowTick && mTimers.size() > mExpired.size())
+    {
+        TimerList *slot;
+
+        if ((mCurrentTick & (kLevel0Slots - 1)) == 0)
+        {
+            // Moves the timers of the upper levels down when the lower level wraps around.
+            for (uint8_t level = 1; level < kNumLevels; level++)
+            {
+                Cascade(GetSlot(level, mCurrentTick));
+
+                if (((mCurrentTick >> GetShift(level)) & (kLevelNSlots - 1)) != 0)
+                {
+                    break;
+                }
+
+                if (level == kNumLevels - 1)
+                {
+                    Cascade(mOverflow);
+                }
+            }
+        }
+
+        slot = &GetSlot(0, mCurrentTick);
+
+        if (!slot->empty())
+        {
+            mLevel0Count -= slot->size();
+
+            for (Timer &timer : *slot)
+            {
+                timer.mList = &mExpired;
+            }
+
+            slot->sort();
+            mExpired.merge(*slot);
+        }
+
+        mCurrentTick++;
+
+        if (mLevel0Count == 0)
+        {
+            // Nothing to expire until the next cascade.
+            uint64_t nextCascadeTick = (mCurrentTick + kLevel0Slots - 1) & ~static_cast<uint64_t>(kLevel0Slots - 1);
+
+            if (nextCascadeTick > mCurrentTick)
+            {
+                mCurrentTick = std::min(nextCascadeTick, aNowTick + 1);
+            }
+        }
+    }
+
+    // Keeps the wheel in sync with the time even if it's empty, so that
+    // the deltas of new timers are calculated from the current time.
+    if (mTimers.size() == mExpired.size() && mCurrentTick <= aNowTick)
+    {
+        mCurrentTick = aNowTick + 1;
+    }
+
+exit:
+    return;
+}
+
+uint64_t TimerWheel::CalculateNextServiceTick(void)
+{
+    uint64_t nextTick = kNoTick;
+
+    VerifyOrExit(mExpired.empty(), nextTick = 0);
+    VerifyOrExit(!mTimers.empty());
+
+    if (mLevel0Count > 0)
+    {
+        for (uint64_t tick = mCurrentTick; tick < mCurrentTick + kLevel0Slots; tick++)
+        {
+            if (!GetSlot(0, tick).empty())
+            {
+                nextTick = tick;
+                break;
+            }
+        }
+    }
+
+    // The timers on the upper levels need to be cascaded when the
+    // wheel reaches the beginning of their slots.
+    for (uint8_t level = 1; level < kNumLevels; level++)
+    {
+        uint8_t  shift = GetShift(level);
+        uint64_t base  = mCurrentTick >> shift;
+        uint64_t first = ((mCurrentTick & ((1ull << shift) - 1)) == 0) ? 0 : 1;
+
+        for (uint64_t offset = first; offset < first + kLevelNSlots; offset++)
+        {
+            if (!GetSlot(level, (base + offset) << shift).empty())
+            {
+                nextTick = std::min(nextTick, (base + offset) << shift);
+                break;
+            }
+        }
+    }
+
+    if (!mOverflow.empty())
+    {
+        uint64_t mask = (1ull << kMaxTickShift) - 1;
+
+        nextTick = std::min(nextTick, (mCurrentTick + mask) & ~mask);
+    }
+
+exit:
+    return nextTick;
+}
+
+} // namespace otbr
@@ -0,0 +1,189 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a hierarchical timer wheel.
+ */
+
+#ifndef OTBR_COMMON_TIMER_WHEEL_HPP_
+#define OTBR_COMMON_TIMER_WHEEL_HPP_
+
+#include <openthread-br/config.h>
+
+#include <array>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a hierarchical timer wheel with millisecond resolution.
+ *
+ * Adding and removing a timer are O(1). A removed timer releases its handler
+ * immediately. Timers expire in the order of (deadline, timer ID), and never
+ * earlier than their deadline.
+ *
+ * This class is not thread-safe.
+ */
+class TimerWheel : private NonCopyable
+{
+public:
+    /**
+     * This type represents the handler of a timer.
+     */
+    typedef std::function<void(void)> Handler;
+
+    /**
+     * This type represents a unique timer ID.
+     */
+    typedef uint64_t TimerId;
+
+    /**
+     * This constructor initializes an empty timer wheel.
+     *
+     * @param[in] aEpoch  The time point of the first tick, deadlines must not be earlier than it.
+     */
+    explicit TimerWheel(Timepoint aEpoch = Clock::now());
+
+    /**
+     * This method adds a timer.
+     *
+     * @param[in] aTimerId   The unique ID of the timer.
+     * @param[in] aDeadline  The time point when the timer expires.
+     * @param[in] aHandler   The handler of the timer.
+     */
+    void Add(TimerId aTimerId, Timepoint aDeadline, Handler aHandler);
+
+    /**
+     * This method removes a timer and releases its handler.
+     *
+     * @param[in] aTimerId  The ID of the timer to remove.
+     *
+     * @retval TRUE   Successfully removed the timer.
+     * @retval FALSE  The timer doesn't exist or has already been popped.
+     */
+    bool Remove(TimerId aTimerId);
+
+    /**
+     * This method pops the earliest expired timer.
+     *
+     * @param[in]  aNow      The current time.
+     * @param[out] aHandler  A reference to receive the handler of the expired timer.
+     *
+     * @retval TRUE   Successfully popped an expired timer.
+     * @retval FALSE  No timer has expired at @p aNow.
+     */
+    bool PopExpired(Timepoint aNow, Handler &aHandler);
+
+    /**
+     * This method returns the number of expired timers which have not been popped yet.
+     *
+     * @param[in] aNow  The current time.
+     *
+     * @returns The number of expired timers at @p aNow.
+     */
+    size_t GetExpiredCount(Timepoint aNow);
+
+    /**
+     * This method returns the time point when the wheel needs to be serviced next.
+     *
+     * The returned time point is never later than the earliest deadline, but may be earlier
+     * when timers need to be moved to a finer-grained level.
+     *
+     * @param[out] aTimepoint  A reference to receive the time point.
+     *
+     * @retval TRUE   Successfully retrieved the time point.
+     * @retval FALSE  There is no timer.
+     */
+    bool GetNextServiceTime(Timepoint &aTimepoint);
+
+    /**
+     * This method returns the number of timers in the wheel.
+     */
+    size_t GetSize(void) const { return mTimers.size(); }
+
+private:
+    static constexpr uint8_t  kLevel0Bits   = 8;
+    static constexpr uint8_t  kLevelNBits   = 6;
+    static constexpr uint8_t  kNumLevels    = 4;
+    static constexpr size_t   kLevel0Slots  = 1u << kLevel0Bits;
+    static constexpr size_t   kLevelNSlots  = 1u << kLevelNBits;
+    static constexpr uint64_t kNoTick       = UINT64_MAX;
+    static constexpr uint8_t  kMaxTickShift = kLevel0Bits + (kNumLevels - 1) * kLevelNBits;
+
+    struct Timer
+    {
+        TimerId           mTimerId;
+        uint64_t          mDeadline; // In ticks.
+        Handler           mHandler;
+        std::list<Timer> *mList;     // The list which holds this timer.
+
+        bool operator<(const Timer &aOther) const
+        {
+            return mDeadline < aOther.mDeadline || (mDeadline == aOther.mDeadline && mTimerId < aOther.mTimerId);
+        }
+    };
+
+    typedef std::list<Timer> TimerList;
+
+    static uint8_t GetShift(uint8_t aLevel) { return aLevel == 0 ? 0 : kLevel0Bits + (aLevel - 1) * kLevelNBits; }
+    static size_t  GetNumSlots(uint8_t aLevel) { return aLevel == 0 ? kLevel0Slots : kLevelNSlots; }
+
+    uint64_t   ToTick(Timepoint aTimepoint, bool aRoundUp) const;
+    TimerList &GetSlot(uint8_t aLevel, uint64_t aTick);
+    TimerList &GetTargetList(uint64_t aDeadline);
+    bool       IsLevel0(const TimerList *aList) const;
+    void       Move(TimerList &aFrom, TimerList::iterator aIter, TimerList &aTo);
+    void       Cascade(TimerList &aList);
+    void       Advance(uint64_t aNowTick);
+    uint64_t   CalculateNextServiceTick(void);
+
+    const Timepoint mEpoch;
+    uint64_t        mCurrentTick; // The next tick to be processed.
+    uint64_t        mNextServiceTick;
+    bool            mNextServiceTickValid;
+    size_t          mLevel0Count;
+
+    std::array<TimerList, kLevel0Slots>                             mLevel0;
+    std::array<std::array<TimerList, kLevelNSlots>, kNumLevels - 1> mLevelN;
+    TimerList                                                       mOverflow;
+    TimerList                                                       mExpired;
+    std::unordered_map<TimerId, TimerList::iterator>                mTimers;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_WHEEL_HPP_
@@ -243,6 +243,10 @@ otError OtbrErrorToOtError(otbrError aError)
         error = OT_ERROR_INVALID_STATE;
         break;
 
+    case OTBR_ERROR_BUSY:
+        error = OT_ERROR_BUSY;
+        break;
+
     default:
         error = OT_ERROR_FAILED;
         break;
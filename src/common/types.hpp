@@ -39,6 +39,7 @@
 #include <netinet/in.h>
 #include <stdint.h>
 #include <string.h>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -86,6 +87,7 @@ enum otbrError
     OTBR_ERROR_INVALID_STATE      = -13, ///< The target isn't in a valid state.
     OTBR_ERROR_INFRA_LINK_CHANGED = -14, ///< The infrastructure link is changed.
     OTBR_ERROR_DROPPED            = -15, ///< The packet is dropped.
+    OTBR_ERROR_BUSY               = -16, ///< The target is busy.
 };
 
 namespace otbr {
@@ -331,6 +333,21 @@ private:
     static Ip6Address FromString(const char *aStr);
 };
 
+/**
+ * This class implements the hash function of `Ip6Address`, so it can be the key of unordered containers.
+ */
+struct Ip6AddressHash
+{
+    size_t operator()(const Ip6Address &aAddress) const
+    {
+        uint64_t hash = aAddress.m64[0];
+
+        hash ^= aAddress.m64[1] + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+
+        return std::hash<uint64_t>()(hash);
+    }
+};
+
 /**
  * This class represents a Ipv6 prefix.
  */
@@ -452,6 +469,19 @@ public:
     bool operator==(const Ip6AddressInfo &aOther) const { return memcmp(this, &aOther, sizeof(Ip6AddressInfo)) == 0; }
 };
 
+/**
+ * This class implements the hash function of `Ip6AddressInfo`, so it can be the key of unordered containers.
+ *
+ * Only the address is hashed, entries which differ in the other fields fall into the same bucket.
+ */
+struct Ip6AddressInfoHash
+{
+    size_t operator()(const Ip6AddressInfo &aAddressInfo) const
+    {
+        return Ip6AddressHash()(Ip6Address(aAddressInfo.mAddress));
+    }
+};
+
 /**
  * This class represents an ethernet MAC address.
  */
@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the Worker Pool that executes CPU-heavy jobs off the mainloop.
+ */
+
+#define OTBR_LOG_TAG "WORKER"
+
+#include "common/worker_pool.hpp"
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+constexpr size_t WorkerPool::kDefaultNumWorkers;
+constexpr size_t WorkerPool::kDefaultMaxPendingJobs;
+
+WorkerPool::WorkerPool(TaskRunner &aTaskRunner, size_t aNumWorkers, size_t aMaxPendingJobs)
+    : mTaskRunner(aTaskRunner)
+    , mMaxPendingJobs(aMaxPendingJobs)
+    , mStopped(false)
+{
+    VerifyOrDie(aNumWorkers > 0, "Worker pool requires at least one worker");
+
+    mWorkers.reserve(aNumWorkers);
+
+    for (size_t i = 0; i < aNumWorkers; i++)
+    {
+        mWorkers.emplace_back(&WorkerPool::Run, this);
+    }
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    std::deque<Job> droppedJobs;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopped = true;
+        droppedJobs.swap(mJobs);
+    }
+
+    mCondition.notify_all();
+
+    for (std::thread &worker : mWorkers)
+    {
+        worker.join();
+    }
+
+    // The completions may no longer be posted to the Task Runner, they are invoked directly on the mainloop.
+    for (Job &job : droppedJobs)
+    {
+        if (job.mCompletion)
+        {
+            job.mCompletion(OTBR_ERROR_ABORTED);
+        }
+    }
+}
+
+size_t WorkerPool::GetPendingJobCount(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mJobs.size();
+}
+
+otbrError WorkerPool::PostJob(std::function<void(void)> aWork, std::function<void(otbrError)> aCompletion)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        VerifyOrExit(!mStopped, error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(mJobs.size() < mMaxPendingJobs, error = OTBR_ERROR_BUSY);
+
+        mJobs.push_back({std::move(aWork), std::move(aCompletion)});
+    }
+
+    mCondition.notify_one();
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to post job: %s", otbrErrorString(error));
+    }
+    return error;
+}
+
+void WorkerPool::Run(void)
+{
+    while (true)
+    {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondition.wait(lock, [this]() { return mStopped || !mJobs.empty(); });
+
+            if (mStopped)
+            {
+                break;
+            }
+
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+
+        job.mWork();
+
+        if (job.mCompletion)
+        {
+            std::function<void(otbrError)> completion = std::move(job.mCompletion);
+
+            mTaskRunner.Post(TaskRunner::Priority::kLow, [completion]() { completion(OTBR_ERROR_NONE); });
+        }
+    }
+}
+
+} // namespace otbr
@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the Worker Pool that executes CPU-heavy jobs off the mainloop.
+ */
+
+#ifndef OTBR_COMMON_WORKER_POOL_HPP_
+#define OTBR_COMMON_WORKER_POOL_HPP_
+
+#include <openthread-br/config.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a bounded pool of worker threads.
+ *
+ * A job runs on one of the worker threads and its completion handler is posted
+ * back to the low priority lane of the Task Runner, so that the result is always
+ * consumed on the mainloop.
+ * Jobs must not touch any state that is owned by the mainloop.
+ *
+ * Every posted job gets its completion handler invoked exactly once, with `OTBR_ERROR_ABORTED`
+ * if the job is dropped because the worker pool is destroyed.
+ */
+class WorkerPool : private NonCopyable
+{
+public:
+    static constexpr size_t kDefaultNumWorkers     = 2;  ///< The default number of worker threads.
+    static constexpr size_t kDefaultMaxPendingJobs = 32; ///< The default maximum number of queued jobs.
+
+    /**
+     * This constructor initializes the Worker Pool and starts the worker threads.
+     *
+     * @param[in] aTaskRunner      The Task Runner to post the completion handlers to.
+     * @param[in] aNumWorkers      The number of worker threads.
+     * @param[in] aMaxPendingJobs  The maximum number of jobs waiting for a worker.
+     */
+    explicit WorkerPool(TaskRunner &aTaskRunner,
+                        size_t      aNumWorkers     = kDefaultNumWorkers,
+                        size_t      aMaxPendingJobs = kDefaultMaxPendingJobs);
+
+    /**
+     * This destructor stops and joins all worker threads.
+     *
+     * Jobs which have not been started yet are dropped and their completion handlers are invoked
+     * with `OTBR_ERROR_ABORTED` before returning, so the Worker Pool must be destroyed on the mainloop.
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method posts a job to the worker pool and returns immediately.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aJob         The job to be executed on a worker thread.
+     * @param[in] aCompletion  The handler to be invoked on the mainloop with the result of @p aJob, or
+     *                         with `OTBR_ERROR_ABORTED` and a default-constructed result if @p aJob is dropped.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully posted the job.
+     * @retval OTBR_ERROR_BUSY           The pending job queue is full.
+     * @retval OTBR_ERROR_INVALID_STATE  The worker pool has been stopped.
+     */
+    template <class T> otbrError Post(std::function<T(void)> aJob, std::function<void(otbrError, T)> aCompletion)
+    {
+        std::shared_ptr<T> result = std::make_shared<T>();
+
+        return PostJob([result, aJob]() { *result = aJob(); },
+                       [result, aCompletion](otbrError aError) { aCompletion(aError, std::move(*result)); });
+    }
+
+    /**
+     * This method posts a job which doesn't produce a result to the worker pool and returns immediately.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aJob         The job to be executed on a worker thread.
+     * @param[in] aCompletion  The handler to be invoked on the mainloop after @p aJob is done, or with
+     *                         `OTBR_ERROR_ABORTED` if @p aJob is dropped, may be `nullptr`.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully posted the job.
+     * @retval OTBR_ERROR_BUSY           The pending job queue is full.
+     * @retval OTBR_ERROR_INVALID_STATE  The worker pool has been stopped.
+     */
+    otbrError Post(std::function<void(void)> aJob, std::function<void(otbrError)> aCompletion)
+    {
+        return PostJob(std::move(aJob), std::move(aCompletion));
+    }
+
+    /**
+     * This method returns the number of jobs waiting for a worker.
+     *
+     * @returns The number of pending jobs.
+     */
+    size_t GetPendingJobCount(void) const;
+
+private:
+    struct Job
+    {
+        std::function<void(void)>      mWork;
+        std::function<void(otbrError)> mCompletion;
+    };
+
+    otbrError PostJob(std::function<void(void)> aWork, std::function<void(otbrError)> aCompletion);
+    void      Run(void);
+
+    TaskRunner              &mTaskRunner;
+    const size_t             mMaxPendingJobs;
+    std::vector<std::thread> mWorkers;
+
+    // The mutex which protects `mJobs` and `mStopped`.
+    mutable std::mutex      mMutex;
+    std::condition_variable mCondition;
+    std::deque<Job>         mJobs;
+    bool                    mStopped;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_WORKER_POOL_HPP_
@@ -713,6 +713,16 @@ ClientError ThreadApiDBus::GetDnssdCounters(DnssdCounters &aDnssdCounters)
 }
 #endif
 
+ClientError ThreadApiDBus::GetMainloopStats(std::vector<MainloopProcessorStats> &aStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MAINLOOP_STATS, aStats);
+}
+
+ClientError ThreadApiDBus::GetFlightRecorder(std::vector<std::string> &aRecords)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_FLIGHT_RECORDER, aRecords);
+}
+
 ClientError ThreadApiDBus::GetTelemetryData(std::vector<uint8_t> &aTelemetryData)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_TELEMETRY_DATA, aTelemetryData);
@@ -782,6 +782,28 @@ public:
     ClientError GetDnssdCounters(DnssdCounters &aDnssdCounters);
 #endif
 
+    /**
+     * This method gets the statistics of the mainloop processors.
+     *
+     * @param[out] aStats  The statistics of the mainloop processors.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetMainloopStats(std::vector<MainloopProcessorStats> &aStats);
+
+    /**
+     * This method gets the log messages kept by the flight recorder.
+     *
+     * @param[out] aRecords  The log messages, from the oldest to the newest.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetFlightRecorder(std::vector<std::string> &aRecords);
+
     /**
      * This method returns the network interface name the client is bound to.
      *
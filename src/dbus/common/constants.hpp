@@ -108,6 +108,8 @@
 #define OTBR_DBUS_PROPERTY_TREL_INFO "TrelInfo"
 #define OTBR_DBUS_PROPERTY_MULTI_AIL_DETECTED "MultiAilDetected"
 #define OTBR_DBUS_PROPERTY_DNSSD_COUNTERS "DnssdCounters"
+#define OTBR_DBUS_PROPERTY_MAINLOOP_STATS "MainloopStats"
+#define OTBR_DBUS_PROPERTY_FLIGHT_RECORDER "FlightRecorder"
 #define OTBR_DBUS_PROPERTY_OTBR_VERSION "OtbrVersion"
 #define OTBR_DBUS_PROPERTY_OT_HOST_VERSION "OtHostVersion"
 #define OTBR_DBUS_PROPERTY_OT_RCP_VERSION "OtRcpVersion"
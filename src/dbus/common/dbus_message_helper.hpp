@@ -119,6 +119,8 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo &aTrelInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo &aTrelInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo::TrelPacketCounters &aCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo::TrelPacketCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopProcessorStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopProcessorStats &aStats);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -146,6 +148,12 @@ template <> struct DBusTypeTrait<std::vector<uint8_t>>
     static constexpr const char *TYPE_AS_STRING = "ay";
 };
 
+template <> struct DBusTypeTrait<std::vector<std::string>>
+{
+    // array of strings
+    static constexpr const char *TYPE_AS_STRING = "as";
+};
+
 template <size_t SIZE> struct DBusTypeTrait<std::array<uint8_t, SIZE>>
 {
     // array of bytes
@@ -290,6 +298,18 @@ template <> struct DBusTypeTrait<DnssdCounters>
     static constexpr const char *TYPE_AS_STRING = "(uuuuuuu)";
 };
 
+template <> struct DBusTypeTrait<MainloopProcessorStats>
+{
+    // struct of { string, uint64, uint64, uint64, uint64, uint64, uint32, uint32, array of uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(stttttuuau)";
+};
+
+template <> struct DBusTypeTrait<std::vector<MainloopProcessorStats>>
+{
+    // array of struct of { string, uint64, uint64, uint64, uint64, uint64, uint32, uint32, array of uint32 }
+    static constexpr const char *TYPE_AS_STRING = "a(stttttuuau)";
+};
+
 template <> struct DBusTypeTrait<RadioSpinelMetrics>
 {
     // struct of { uint32, uint32, uint32, uint32 }
@@ -1258,5 +1258,49 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopProcessorStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mIterations));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mWakeups));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mTasksRun));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mUpdateTimeUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mProcessTimeUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mMaxProcessTimeUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mFdCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mProcessTimeHistogram));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopProcessorStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mIterations));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mWakeups));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mTasksRun));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mUpdateTimeUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mProcessTimeUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mMaxProcessTimeUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mFdCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mProcessTimeHistogram));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
@@ -684,6 +684,20 @@ struct TrelInfo
     TrelPacketCounters mTrelCounters; ///< The TREL counters.
 };
 
+struct MainloopProcessorStats
+{
+    std::string mName;             ///< The name of the mainloop processor.
+    uint64_t    mIterations;       ///< The number of mainloop iterations the processor has been processed.
+    uint64_t    mWakeups;          ///< The number of iterations woken up by the processor's fds or timeout.
+    uint64_t    mTasksRun;         ///< The number of tasks run within the processor.
+    uint64_t    mUpdateTimeUs;     ///< The total time spent in updating the mainloop context in microseconds.
+    uint64_t    mProcessTimeUs;    ///< The total time spent in processing mainloop events in microseconds.
+    uint32_t    mMaxProcessTimeUs; ///< The longest time spent in processing mainloop events in microseconds.
+    uint32_t    mFdCount;          ///< The number of fds contributed to the latest mainloop iteration.
+
+    std::vector<uint32_t> mProcessTimeHistogram; ///< The log2 histogram of processing time in microseconds.
+};
+
 } // namespace DBus
 } // namespace otbr
 
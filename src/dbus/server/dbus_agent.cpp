@@ -32,9 +32,11 @@
 
 #include <chrono>
 #include <thread>
+#include <vector>
 #include <unistd.h>
 
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_thread_object_ncp.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
@@ -108,6 +110,11 @@ void DBusAgent::Deinit(void)
         dbus_error_free(&err);
         dbus_connection_set_watch_functions(mConnection.get(), nullptr, nullptr, nullptr, nullptr, nullptr);
         mWatches.clear();
+        for (int fd : mWatchedFds)
+        {
+            MainloopManager::GetInstance().RemoveFd(fd);
+        }
+        mWatchedFds.clear();
         dbus_connection_flush(mConnection.get());
         mConnection = nullptr;
     }
@@ -139,9 +146,9 @@ DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
                      otbrLogWarning("Failed to request DBus name: %s: %s", dbusError.name, dbusError.message);
                      uniqueConn = nullptr;
                  });
-    VerifyOrExit(
-        dbus_connection_set_watch_functions(uniqueConn.get(), AddDBusWatch, RemoveDBusWatch, nullptr, this, nullptr),
-        uniqueConn = nullptr);
+    VerifyOrExit(dbus_connection_set_watch_functions(uniqueConn.get(), AddDBusWatch, RemoveDBusWatch, ToggleDBusWatch,
+                                                     this, nullptr),
+                 uniqueConn = nullptr);
 
 exit:
     dbus_error_free(&dbusError);
@@ -151,93 +158,129 @@ exit:
 
 dbus_bool_t DBusAgent::AddDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.insert(aWatch);
-    return TRUE;
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+    bool       added = true;
+
+    agent->mWatches.insert(aWatch);
+
+    if (agent->UpdateWatchedFd(dbus_watch_get_unix_fd(aWatch)) != OTBR_ERROR_NONE)
+    {
+        // libdbus doesn't call `RemoveDBusWatch()` for a watch which failed to be added.
+        agent->mWatches.erase(aWatch);
+        added = false;
+    }
+
+    return added;
 }
 
 void DBusAgent::RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.erase(aWatch);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    agent->mWatches.erase(aWatch);
+    OTBR_UNUSED_VARIABLE(agent->UpdateWatchedFd(dbus_watch_get_unix_fd(aWatch)));
 }
 
-void DBusAgent::Update(MainloopContext &aMainloop)
+void DBusAgent::ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    unsigned int flags;
-    int          fd;
-    uint8_t      fdSetMask = MainloopContext::kErrorFdSet;
+    OTBR_UNUSED_VARIABLE(static_cast<DBusAgent *>(aContext)->UpdateWatchedFd(dbus_watch_get_unix_fd(aWatch)));
+}
 
-    VerifyOrExit(mConnection != nullptr);
+otbrError DBusAgent::UpdateWatchedFd(int aFd)
+{
+    MainloopManager &manager         = MainloopManager::GetInstance();
+    otbrError        error           = OTBR_ERROR_NONE;
+    bool             hasEnabledWatch = false;
+    uint8_t          fdSetMask       = MainloopContext::kErrorFdSet;
 
-    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
-    {
-        aMainloop.mTimeout = {0, 0};
-    }
+    VerifyOrExit(aFd >= 0);
 
     for (const auto &watch : mWatches)
     {
-        if (!dbus_watch_get_enabled(watch))
-        {
-            continue;
-        }
+        unsigned int flags;
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
-
-        if (fd < 0)
+        if (dbus_watch_get_unix_fd(watch) != aFd || !dbus_watch_get_enabled(watch))
         {
             continue;
         }
 
+        hasEnabledWatch = true;
+        flags           = dbus_watch_get_flags(watch);
+
         if (flags & DBUS_WATCH_READABLE)
         {
             fdSetMask |= MainloopContext::kReadFdSet;
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE))
+        if (flags & DBUS_WATCH_WRITABLE)
         {
             fdSetMask |= MainloopContext::kWriteFdSet;
         }
+    }
 
-        aMainloop.AddFdToSet(fd, fdSetMask);
+    // A fd without any enabled watch is not watched at all, otherwise a hang-up would wake up the
+    // mainloop over and over with nobody to handle it.
+    if (!hasEnabledWatch)
+    {
+        if (mWatchedFds.erase(aFd) != 0)
+        {
+            manager.RemoveFd(aFd);
+        }
+    }
+    else if (mWatchedFds.count(aFd) != 0)
+    {
+        error = manager.UpdateFd(aFd, fdSetMask);
+    }
+    else
+    {
+        SuccessOrExit(error = manager.AddFd(aFd, fdSetMask,
+                                            [this, aFd](uint8_t aEvents) { HandleWatchedFd(aFd, aEvents); }));
+        mWatchedFds.insert(aFd);
     }
 
 exit:
-    return;
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to watch DBus fd %d: %s", aFd, otbrErrorString(error));
+    }
+    return error;
 }
 
-void DBusAgent::Process(const MainloopContext &aMainloop)
+void DBusAgent::HandleWatchedFd(int aFd, uint8_t aEvents)
 {
-    unsigned int flags;
-    int          fd;
-
-    VerifyOrExit(mConnection != nullptr);
+    std::vector<DBusWatch *> watches;
 
     for (const auto &watch : mWatches)
     {
-        if (!dbus_watch_get_enabled(watch))
+        if (dbus_watch_get_unix_fd(watch) == aFd && dbus_watch_get_enabled(watch))
         {
-            continue;
+            watches.push_back(watch);
         }
+    }
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+    for (DBusWatch *watch : watches)
+    {
+        unsigned int flags;
 
-        if (fd < 0)
+        // Handling a watch may add or remove other watches.
+        if (mWatches.count(watch) == 0)
         {
             continue;
         }
 
-        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(fd, &aMainloop.mReadFdSet))
+        flags = dbus_watch_get_flags(watch);
+
+        if (!(aEvents & MainloopContext::kReadFdSet))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        if (!(aEvents & MainloopContext::kWriteFdSet))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
         }
 
-        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        if (aEvents & MainloopContext::kErrorFdSet)
         {
             flags |= DBUS_WATCH_ERROR;
         }
@@ -245,6 +288,34 @@ void DBusAgent::Process(const MainloopContext &aMainloop)
         dbus_watch_handle(watch, flags);
     }
 
+    VerifyOrExit(mConnection != nullptr);
+    while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()));
+
+exit:
+    return;
+}
+
+void DBusAgent::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(mConnection != nullptr);
+
+    // The DBus fds are watched by the `MainloopManager`, only the messages which have
+    // already been read need the mainloop to wake up.
+    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+
+exit:
+    return;
+}
+
+void DBusAgent::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    VerifyOrExit(mConnection != nullptr);
+
     while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()));
 
 exit:
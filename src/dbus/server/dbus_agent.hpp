@@ -63,6 +63,20 @@ public:
      */
     DBusAgent(const DependentComponents &aDeps);
 
+#if __linux__
+    /**
+     * This method sets the infrastructure link selector reported by the d-bus objects.
+     *
+     * This method must be called before `Init()`.
+     *
+     * @param[in]  aInfraLinkSelector  The infrastructure link selector.
+     */
+    void SetInfraLinkSelector(const Utils::InfraLinkSelector &aInfraLinkSelector)
+    {
+        mDeps.mInfraLinkSelector = &aInfraLinkSelector;
+    }
+#endif
+
     /**
      * This method initializes the dbus agent.
      */
@@ -70,8 +84,9 @@ public:
 
     void Deinit(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "DBusAgent"; }
 
 private:
     using Clock                                              = std::chrono::steady_clock;
@@ -81,7 +96,10 @@ private:
 
     static dbus_bool_t   AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void          RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    static void          ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
     UniqueDBusConnection PrepareDBusConnection(void);
+    otbrError            UpdateWatchedFd(int aFd);
+    void                 HandleWatchedFd(int aFd, uint8_t aEvents);
 
     static const struct timeval kPollTimeout;
 
@@ -94,6 +112,12 @@ private:
      * This map is used to track DBusWatch-es.
      */
     std::set<DBusWatch *> mWatches;
+
+    /**
+     * The fds of the DBusWatch-es registered with the `MainloopManager`. libdbus usually
+     * creates a readable and a writable watch on the same fd.
+     */
+    std::set<int> mWatchedFds;
 };
 
 } // namespace DBus
@@ -190,11 +190,23 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
     std::string     propertyName;
     otError         error      = OT_ERROR_NONE;
     otError         replyError = OT_ERROR_NONE;
+    bool            isAsync    = false;
 
     VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+    {
+        const AsyncPropertyHandlerType *asyncHandler = FindAsyncGetPropertyHandler(interfaceName, propertyName);
+
+        if (asyncHandler != nullptr)
+        {
+            otbrLogDebug("AsyncGetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
+            isAsync = true;
+            (*asyncHandler)(aRequest);
+            ExitNow();
+        }
+    }
     {
         auto propertyIter = mGetPropertyHandlers.find(interfaceName);
 
@@ -211,7 +223,11 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
         }
     }
 exit:
-    if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
+    if (isAsync)
+    {
+        // The async handler is responsible for replying to the request.
+    }
+    else if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
     {
         if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
         {
@@ -318,17 +334,11 @@ void DBusObject::AsyncGetPropertyMethodHandler(DBusRequest &aRequest)
     SuccessOrExit(error = OtbrErrorToOtError(DBusMessageExtract(&iter, propertyName)));
 
     {
-        auto propertyIter = mAsyncGetPropertyHandlers.find(interfaceName);
+        const AsyncPropertyHandlerType *handler = FindAsyncGetPropertyHandler(interfaceName, propertyName);
 
         otbrLogDebug("AsyncGetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
-        VerifyOrExit(propertyIter != mAsyncGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        {
-            auto &interfaceHandlers = propertyIter->second;
-            auto  interfaceIter     = interfaceHandlers.find(propertyName);
-
-            VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
-            (interfaceIter->second)(aRequest);
-        }
+        VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+        (*handler)(aRequest);
     }
 
 exit:
@@ -340,6 +350,25 @@ exit:
     }
 }
 
+const DBusObject::AsyncPropertyHandlerType *DBusObject::FindAsyncGetPropertyHandler(
+    const std::string &aInterfaceName,
+    const std::string &aPropertyName) const
+{
+    const AsyncPropertyHandlerType *handler      = nullptr;
+    auto                            propertyIter = mAsyncGetPropertyHandlers.find(aInterfaceName);
+
+    VerifyOrExit(propertyIter != mAsyncGetPropertyHandlers.end());
+    {
+        auto interfaceIter = propertyIter->second.find(aPropertyName);
+
+        VerifyOrExit(interfaceIter != propertyIter->second.end());
+        handler = &interfaceIter->second;
+    }
+
+exit:
+    return handler;
+}
+
 DBusObject::~DBusObject(void)
 {
 }
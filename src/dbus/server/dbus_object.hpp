@@ -59,6 +59,11 @@
 #include "mdns/mdns.hpp"
 
 namespace otbr {
+
+namespace Utils {
+class InfraLinkSelector;
+}
+
 namespace DBus {
 
 class DependentComponents
@@ -69,6 +74,9 @@ public:
 #if OTBR_ENABLE_BORDER_AGENT
     otbr::BorderAgent &mBorderAgent;
 #endif
+#if __linux__
+    const Utils::InfraLinkSelector *mInfraLinkSelector; ///< May be nullptr.
+#endif
 };
 
 /**
@@ -150,6 +158,33 @@ public:
                                                  const std::string              &aPropertyName,
                                                  const AsyncPropertyHandlerType &aHandler);
 
+    /**
+     * This method replies to a get property request which is handled by an async get handler.
+     *
+     * @param[in] aRequest  The get property request.
+     * @param[in] aValue    The value of the property.
+     */
+    template <typename ValueType> static void ReplyAsyncGetProperty(DBusRequest &aRequest, const ValueType &aValue)
+    {
+        UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
+        DBusMessageIter   replyIter;
+        otError           error = OT_ERROR_NONE;
+
+        VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+        dbus_message_iter_init_append(reply.get(), &replyIter);
+        SuccessOrExit(error = OtbrErrorToOtError(DBusMessageEncodeToVariant(&replyIter, aValue)));
+
+    exit:
+        if (error == OT_ERROR_NONE)
+        {
+            dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        }
+        else
+        {
+            aRequest.ReplyOtResult(error);
+        }
+    }
+
     /**
      * This method sends a signal.
      *
@@ -250,6 +285,9 @@ private:
     void SetPropertyMethodHandler(DBusRequest &aRequest);
     void AsyncGetPropertyMethodHandler(DBusRequest &aRequest);
 
+    const AsyncPropertyHandlerType *FindAsyncGetPropertyHandler(const std::string &aInterfaceName,
+                                                                const std::string &aPropertyName) const;
+
     static DBusHandlerResult sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage);
 
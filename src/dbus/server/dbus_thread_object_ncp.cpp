@@ -33,6 +33,15 @@
 #include "common/code_utils.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "host/thread_helper.hpp"
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+#include "host/telemetry/telemetry_retriever_infra_if.hpp"
+#include "host/telemetry/telemetry_retriever_infra_link_selector.hpp"
+#include "host/telemetry/telemetry_retriever_multicast_routing.hpp"
+#include "host/telemetry/telemetry_retriever_netif.hpp"
+#include "host/telemetry/telemetry_retriever_spinel.hpp"
+#include "host/telemetry/telemetry_retriever_task_runner.hpp"
+#include "proto/thread_telemetry.pb.h"
+#endif
 
 using std::placeholders::_1;
 using std::placeholders::_2;
@@ -48,6 +57,9 @@ DBusThreadObjectNcp::DBusThreadObjectNcp(DBusConnection            &aConnection,
 #if OTBR_ENABLE_BORDER_AGENT
     , mBorderAgent(aDeps.mBorderAgent)
 #endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API && __linux__
+    , mInfraLinkSelector(aDeps.mInfraLinkSelector)
+#endif
 {
 }
 
@@ -59,6 +71,8 @@ otbrError DBusThreadObjectNcp::Init(void)
 
     RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                                     std::bind(&DBusThreadObjectNcp::AsyncGetDeviceRoleHandler, this, _1));
+    RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_DATA,
+                                    std::bind(&DBusThreadObjectNcp::AsyncGetTelemetryDataHandler, this, _1));
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOIN_METHOD,
                    std::bind(&DBusThreadObjectNcp::JoinHandler, this, _1));
@@ -89,24 +103,45 @@ void DBusThreadObjectNcp::AsyncGetDeviceRoleHandler(DBusRequest &aRequest)
     ReplyAsyncGetProperty(aRequest, GetDeviceRoleName(role));
 }
 
-void DBusThreadObjectNcp::ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent)
+void DBusThreadObjectNcp::AsyncGetTelemetryDataHandler(DBusRequest &aRequest)
 {
-    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
-    DBusMessageIter   replyIter;
-    otError           error = OT_ERROR_NONE;
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    // Only the data owned by otbr-agent is available in NCP mode, the Thread stack data is on the NCP.
+    threadnetwork::TelemetryData telemetryData;
+    std::string                  telemetryDataBytes;
 
-    dbus_message_iter_init_append(reply.get(), &replyIter);
-    SuccessOrExit(error = OtbrErrorToOtError(DBusMessageEncodeToVariant(&replyIter, aContent)));
-
-exit:
-    if (error == OT_ERROR_NONE)
+    if (mHost.GetNetif() != nullptr)
     {
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        TelemetryRetriever::RetrieveNetifInfo(*mHost.GetNetif(), telemetryData.mutable_netif_info());
     }
-    else
+    TelemetryRetriever::RetrieveSpinelCommandCounters(mHost.GetSpinelCommandCounters(),
+                                                      telemetryData.mutable_spinel_command_counters());
+    TelemetryRetriever::RetrieveTaskRunnerStats(mHost.GetTaskRunner(), telemetryData.mutable_task_runner_stats());
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    if (mHost.GetMulticastRoutingManager() != nullptr)
     {
-        aRequest.ReplyOtResult(error);
+        TelemetryRetriever::RetrieveMfcCounters(mHost.GetMulticastRoutingManager()->GetMfcCounters(),
+                                                telemetryData.mutable_mfc_counters());
     }
+#endif
+    if (mHost.GetInfraIf() != nullptr)
+    {
+        TelemetryRetriever::RetrieveInfraIfIcmp6Counters(mHost.GetInfraIf()->GetIcmp6Counters(),
+                                                         telemetryData.mutable_infra_if_icmp6_counters());
+    }
+#if __linux__
+    if (mInfraLinkSelector != nullptr)
+    {
+        TelemetryRetriever::RetrieveInfraLinkSelectorCounters(mInfraLinkSelector->GetCounters(),
+                                                              telemetryData.mutable_infra_link_selector_counters());
+    }
+#endif
+
+    telemetryDataBytes = telemetryData.SerializeAsString();
+    ReplyAsyncGetProperty(aRequest, std::vector<uint8_t>(telemetryDataBytes.begin(), telemetryDataBytes.end()));
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
 }
 
 void DBusThreadObjectNcp::JoinHandler(DBusRequest &aRequest)
@@ -81,7 +81,7 @@ public:
 
 private:
     void AsyncGetDeviceRoleHandler(DBusRequest &aRequest);
-    void ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent);
+    void AsyncGetTelemetryDataHandler(DBusRequest &aRequest);
 
     void JoinHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
@@ -96,6 +96,9 @@ private:
 #if OTBR_ENABLE_BORDER_AGENT
     otbr::BorderAgent &mBorderAgent;
 #endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API && __linux__
+    const Utils::InfraLinkSelector *mInfraLinkSelector;
+#endif
 };
 
 /**
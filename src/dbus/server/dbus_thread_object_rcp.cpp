@@ -52,6 +52,8 @@
 #include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
+#include "common/flight_recorder.hpp"
+#include "common/mainloop_manager.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
@@ -59,6 +61,8 @@
 #include "proto/feature_flag.pb.h"
 #endif
 #if OTBR_ENABLE_TELEMETRY_DATA_API
+#include "host/telemetry/telemetry_retriever_infra_link_selector.hpp"
+#include "host/telemetry/telemetry_retriever_task_runner.hpp"
 #include "proto/thread_telemetry.pb.h"
 #endif
 #include "proto/capabilities.pb.h"
@@ -106,6 +110,9 @@ DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection            &aConnection,
 #if OTBR_ENABLE_BORDER_AGENT
     , mBorderAgent(aDeps.mBorderAgent)
 #endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API && __linux__
+    , mInfraLinkSelector(aDeps.mInfraLinkSelector)
+#endif
 {
 }
 
@@ -272,6 +279,10 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetMdnsTelemetryInfoHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNSSD_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetDnssdCountersHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MAINLOOP_STATS,
+                               std::bind(&DBusThreadObjectRcp::GetMainloopStatsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_FLIGHT_RECORDER,
+                               std::bind(&DBusThreadObjectRcp::GetFlightRecorderHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OTBR_VERSION,
                                std::bind(&DBusThreadObjectRcp::GetOtbrVersionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_HOST_VERSION,
@@ -312,8 +323,11 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetMultiAilDetectedHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNS_UPSTREAM_QUERY_STATE,
                                std::bind(&DBusThreadObjectRcp::GetDnsUpstreamQueryState, this, _1));
+    // `GetAll` replies serialize the telemetry data inline, while `Get` requests use the async handler.
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_DATA,
                                std::bind(&DBusThreadObjectRcp::GetTelemetryDataHandler, this, _1));
+    RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_DATA,
+                                    std::bind(&DBusThreadObjectRcp::GetTelemetryDataAsyncHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
                                std::bind(&DBusThreadObjectRcp::GetCapabilitiesHandler, this, _1));
 
@@ -1494,6 +1508,46 @@ exit:
 #endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 }
 
+otError DBusThreadObjectRcp::GetMainloopStatsHandler(DBusMessageIter &aIter)
+{
+    otError                             error = OT_ERROR_NONE;
+    std::vector<MainloopProcessorStats> stats;
+
+    for (const otbr::MainloopProcessorStats &processorStats : MainloopManager::GetInstance().GetProcessorStats())
+    {
+        MainloopProcessorStats entry;
+
+        entry.mName             = processorStats.mName;
+        entry.mIterations       = processorStats.mIterations;
+        entry.mWakeups          = processorStats.mWakeups;
+        entry.mTasksRun         = processorStats.mTasksRun;
+        entry.mUpdateTimeUs     = processorStats.mUpdateTimeUs;
+        entry.mProcessTimeUs    = processorStats.mProcessTimeUs;
+        entry.mMaxProcessTimeUs = processorStats.mMaxProcessTimeUs;
+        entry.mFdCount          = processorStats.mFdCount;
+        entry.mProcessTimeHistogram.assign(processorStats.mProcessTimeHistogram.begin(),
+                                           processorStats.mProcessTimeHistogram.end());
+
+        stats.push_back(std::move(entry));
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, stats) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObjectRcp::GetFlightRecorderHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, FlightRecorder::GetInstance().Dump()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetTrelInfoHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_TREL
@@ -1537,23 +1591,48 @@ exit:
 #endif
 }
 
-otError DBusThreadObjectRcp::GetTelemetryDataHandler(DBusMessageIter &aIter)
-{
 #if OTBR_ENABLE_TELEMETRY_DATA_API
-    otError                      error = OT_ERROR_NONE;
-    threadnetwork::TelemetryData telemetryData;
-
-    if (mTelemetryRetriever.RetrieveTelemetryData(mPublisher, telemetryData) != OT_ERROR_NONE)
+void DBusThreadObjectRcp::RetrieveTelemetryData(threadnetwork::TelemetryData           &aTelemetryData,
+                                                Host::TelemetryRetriever::DeferredData &aDeferredData)
+{
+    if (mTelemetryRetriever.RetrieveTelemetryData(mPublisher, aTelemetryData, aDeferredData) != OT_ERROR_NONE)
     {
         otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
     }
-
+    TelemetryRetriever::RetrieveTaskRunnerStats(mHost.GetTaskRunner(), aTelemetryData.mutable_task_runner_stats());
+#if __linux__
+    if (mInfraLinkSelector != nullptr)
     {
-        const std::string    telemetryDataBytes = telemetryData.SerializeAsString();
-        std::vector<uint8_t> data(telemetryDataBytes.begin(), telemetryDataBytes.end());
-
-        VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+        TelemetryRetriever::RetrieveInfraLinkSelectorCounters(mInfraLinkSelector->GetCounters(),
+                                                              aTelemetryData.mutable_infra_link_selector_counters());
     }
+#endif
+}
+
+std::vector<uint8_t> DBusThreadObjectRcp::SerializeTelemetryData(
+    const Host::TelemetryRetriever::DeferredData &aDeferredData,
+    threadnetwork::TelemetryData                 &aTelemetryData)
+{
+    std::string telemetryDataBytes;
+
+    Host::TelemetryRetriever::CompleteTelemetryData(aDeferredData, aTelemetryData);
+    telemetryDataBytes = aTelemetryData.SerializeAsString();
+
+    return std::vector<uint8_t>(telemetryDataBytes.begin(), telemetryDataBytes.end());
+}
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
+otError DBusThreadObjectRcp::GetTelemetryDataHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError                                error = OT_ERROR_NONE;
+    threadnetwork::TelemetryData           telemetryData;
+    Host::TelemetryRetriever::DeferredData deferredData;
+
+    RetrieveTelemetryData(telemetryData, deferredData);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, SerializeTelemetryData(deferredData, telemetryData)) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1563,6 +1642,40 @@ exit:
 #endif
 }
 
+void DBusThreadObjectRcp::GetTelemetryDataAsyncHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    // The OpenThread instance and the mDNS publisher are only safe to access on the mainloop, so only
+    // a snapshot of them is taken here. The work which does not depend on them, hashing the NAT64
+    // addresses and PD prefix and serializing the message, is offloaded to the worker pool.
+    auto      telemetryData = std::make_shared<threadnetwork::TelemetryData>();
+    auto      deferredData  = std::make_shared<Host::TelemetryRetriever::DeferredData>();
+    otbrError error;
+
+    RetrieveTelemetryData(*telemetryData, *deferredData);
+
+    error = mHost.GetWorkerPool().Post<std::vector<uint8_t>>(
+        [telemetryData, deferredData]() { return SerializeTelemetryData(*deferredData, *telemetryData); },
+        [aRequest](otbrError aError, std::vector<uint8_t> aData) mutable {
+            if (aError == OTBR_ERROR_NONE)
+            {
+                ReplyAsyncGetProperty(aRequest, aData);
+            }
+            else
+            {
+                aRequest.ReplyOtResult(OT_ERROR_ABORT);
+            }
+        });
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        ReplyAsyncGetProperty(aRequest, SerializeTelemetryData(*deferredData, *telemetryData));
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
 otError DBusThreadObjectRcp::GetCapabilitiesHandler(DBusMessageIter &aIter)
 {
     otError            error = OT_ERROR_NONE;
@@ -164,6 +164,8 @@ private:
     otError GetSrpServerInfoHandler(DBusMessageIter &aIter);
     otError GetMdnsTelemetryInfoHandler(DBusMessageIter &aIter);
     otError GetDnssdCountersHandler(DBusMessageIter &aIter);
+    otError GetMainloopStatsHandler(DBusMessageIter &aIter);
+    otError GetFlightRecorderHandler(DBusMessageIter &aIter);
     otError GetOtbrVersionHandler(DBusMessageIter &aIter);
     otError GetOtHostVersionHandler(DBusMessageIter &aIter);
     otError GetOtRcpVersionHandler(DBusMessageIter &aIter);
@@ -186,8 +188,16 @@ private:
     otError GetInfraLinkInfo(DBusMessageIter &aIter);
     otError GetDnsUpstreamQueryState(DBusMessageIter &aIter);
     otError GetTelemetryDataHandler(DBusMessageIter &aIter);
+    void    GetTelemetryDataAsyncHandler(DBusRequest &aRequest);
     otError GetCapabilitiesHandler(DBusMessageIter &aIter);
 
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    void                        RetrieveTelemetryData(threadnetwork::TelemetryData           &aTelemetryData,
+                                                      Host::TelemetryRetriever::DeferredData &aDeferredData);
+    static std::vector<uint8_t> SerializeTelemetryData(const Host::TelemetryRetriever::DeferredData &aDeferredData,
+                                                       threadnetwork::TelemetryData                 &aTelemetryData);
+#endif
+
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
     void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
 
@@ -201,6 +211,9 @@ private:
 #if OTBR_ENABLE_BORDER_AGENT
     otbr::BorderAgent &mBorderAgent;
 #endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API && __linux__
+    const Utils::InfraLinkSelector *mInfraLinkSelector;
+#endif
 };
 
 /**
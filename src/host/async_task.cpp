@@ -36,63 +36,107 @@
 namespace otbr {
 namespace Host {
 
+constexpr size_t AsyncTask::kExpectedSteps;
+
 AsyncTask::AsyncTask(const ResultHandler &aResultHandler)
-    : mResultHandler(aResultHandler)
+    : mChain(nullptr)
+    , mStep(0)
+    , mNextStep(0)
+    , mResultHandler(aResultHandler)
+{
+    mSteps.reserve(kExpectedSteps);
+}
+
+AsyncTask::AsyncTask(void)
+    : mChain(nullptr)
+    , mStep(0)
+    , mNextStep(0)
 {
 }
 
 AsyncTask::~AsyncTask()
 {
-    if (!mNext)
+    if (mResultHandler)
     {
-        if (mResultHandler)
-        {
-            mResultHandler(OT_ERROR_FAILED, "AsyncTask ends without setting any result.");
-        }
+        mResultHandler(OT_ERROR_FAILED, "AsyncTask ends without setting any result.");
     }
 }
 
 void AsyncTask::Run(void)
 {
-    SetResult(OT_ERROR_NONE, "");
+    mStepTasks.reset(new AsyncTask[mSteps.size()]);
+    for (size_t i = 0; i < mSteps.size(); i++)
+    {
+        mStepTasks[i].mChain = this;
+        mStepTasks[i].mStep  = i;
+    }
+
+    HandleResult(OT_ERROR_NONE, "");
 }
 
 void AsyncTask::SetResult(otError aError, const std::string &aErrorInfo)
 {
-    if (mNext)
+    if (mChain != nullptr)
+    {
+        mChain->HandleStepResult(mStep, aError, aErrorInfo);
+    }
+    else
+    {
+        HandleResult(aError, aErrorInfo);
+    }
+}
+
+void AsyncTask::HandleStepResult(size_t aStep, otError aError, const std::string &aErrorInfo)
+{
+    // Only the step running now may complete, a late or repeated result of an earlier step is dropped.
+    VerifyOrExit(aStep + 1 == mNextStep);
+
+    HandleResult(aError, aErrorInfo);
+
+exit:
+    return;
+}
+
+void AsyncTask::HandleResult(otError aError, const std::string &aErrorInfo)
+{
+    VerifyOrExit(mResultHandler != nullptr);
+
+    if (aError == OT_ERROR_NONE && mNextStep < mSteps.size())
     {
-        if (aError == OT_ERROR_NONE)
-        {
-            mThen(std::move(mNext));
-        }
-        else
-        {
-            mNext->SetResult(aError, aErrorInfo);
-        }
-        mThen = nullptr;
+        // Releases the handler once it's invoked so that its captures don't outlive the step.
+        ThenHandler step  = std::move(mSteps[mNextStep]);
+        size_t      index = mNextStep++;
+
+        // The step shares the ownership of this task.
+        step(AsyncTaskPtr(shared_from_this(), &mStepTasks[index]));
     }
     else
     {
-        mResultHandler(aError, aErrorInfo);
+        ResultHandler resultHandler = std::move(mResultHandler);
+
         mResultHandler = nullptr;
+        mSteps.clear();
+        resultHandler(aError, aErrorInfo);
     }
+
+exit:
+    return;
 }
 
-AsyncTaskPtr &AsyncTask::First(const ThenHandler &aFirst)
+AsyncTask *AsyncTask::First(const ThenHandler &aFirst)
 {
-    assert(mNext == nullptr);
+    assert(mSteps.empty());
 
     return Then(aFirst);
 }
 
-AsyncTaskPtr &AsyncTask::Then(const ThenHandler &aThen)
+AsyncTask *AsyncTask::Then(const ThenHandler &aThen)
 {
-    assert(mNext == nullptr);
+    assert(mNextStep == 0);
 
-    mNext = std::make_shared<AsyncTask>(mResultHandler);
-    mThen = aThen;
+    mSteps.push_back(aThen);
 
-    return mNext;
+    return this;
 }
 
 } // namespace Host
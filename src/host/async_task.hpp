@@ -37,6 +37,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <openthread/error.h>
 
@@ -46,7 +48,15 @@ namespace Host {
 class AsyncTask;
 using AsyncTaskPtr = std::shared_ptr<AsyncTask>;
 
-class AsyncTask
+/**
+ * This class implements a chain of async operations.
+ *
+ * All the operations of a chain share the ownership of a single `AsyncTask` object, so building and
+ * running a chain doesn't allocate an object per operation. Each operation receives a pointer to its
+ * own step of the chain and reports its result by calling `SetResult()` on it. A result reported by
+ * a step which has already completed, e.g. reported late or twice, is ignored.
+ */
+class AsyncTask : public std::enable_shared_from_this<AsyncTask>
 {
 public:
     using ThenHandler   = std::function<void(AsyncTaskPtr)>;
@@ -77,6 +87,9 @@ public:
      * This method should be called when the result of the previous async operation is ready.
      * This method will pass the result to next operation.
      *
+     * The result is ignored if the chain has already completed, or if it's reported by a step which
+     * has already completed.
+     *
      * @param[in] aError  The result for the previous async operation.
      */
     void SetResult(otError aError, const std::string &aErrorInfo);
@@ -86,26 +99,33 @@ public:
      *
      * @param[in] aFirst  A reference to a function object for the initial action.
      *
-     * @returns  A shared pointer to a AsyncTask object created in this method.
+     * @returns  A pointer to this AsyncTask object for appending more operations.
      */
-    AsyncTaskPtr &First(const ThenHandler &aFirst);
+    AsyncTask *First(const ThenHandler &aFirst);
 
     /**
      * Set the next operation of the chained async operations.
      *
      * @param[in] aThen  A reference to a function object for the next action.
      *
-     * @returns A shared pointer to a AsyncTask object created in this method.
+     * @returns A pointer to this AsyncTask object for appending more operations.
      */
-    AsyncTaskPtr &Then(const ThenHandler &aThen);
+    AsyncTask *Then(const ThenHandler &aThen);
 
 private:
-    union
-    {
-        ThenHandler   mThen;          // Only valid when `mNext` is not nullptr
-        ResultHandler mResultHandler; // Only valid when `mNext` is nullptr
-    };
-    AsyncTaskPtr mNext;
+    static constexpr size_t kExpectedSteps = 4;
+
+    AsyncTask(void);
+
+    void HandleStepResult(size_t aStep, otError aError, const std::string &aErrorInfo);
+    void HandleResult(otError aError, const std::string &aErrorInfo);
+
+    AsyncTask                   *mChain;     // The task running the chain of this step, nullptr for that task.
+    size_t                       mStep;      // The index of this step in the chain.
+    std::unique_ptr<AsyncTask[]> mStepTasks; // The steps handed to the operations, created by `Run()`.
+    std::vector<ThenHandler>     mSteps;
+    size_t                       mNextStep;
+    ResultHandler                mResultHandler; // Cleared once the result has been delivered.
 };
 
 } // namespace Host
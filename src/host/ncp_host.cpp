@@ -119,6 +119,9 @@ NcpHost::NcpHost(const char *aInterfaceName, const char *aBackboneInterfaceName,
     : mIsInitialized(false)
     , mSpinelDriver(*static_cast<ot::Spinel::SpinelDriver *>(otSysGetSpinelDriver()))
     , mCliDaemon(mNcpSpinel)
+    , mNetif(nullptr)
+    , mMulticastRoutingManager(nullptr)
+    , mInfraIf(nullptr)
 {
     memset(&mConfig, 0, sizeof(mConfig));
     mConfig.mInterfaceName         = aInterfaceName;
@@ -411,9 +414,9 @@ otbrError NcpHost::UdpForward(const uint8_t      *aUdpPayload,
                               uint16_t            aLength,
                               const otIp6Address &aRemoteAddr,
                               uint16_t            aRemotePort,
-                              const UdpProxy     &aUdpProxy)
+                              uint16_t            aThreadPort)
 {
-    return mNcpSpinel.UdpForward(aUdpPayload, aLength, aRemoteAddr, aRemotePort, aUdpProxy.GetThreadPort());
+    return mNcpSpinel.UdpForward(aUdpPayload, aLength, aRemoteAddr, aRemotePort, aThreadPort);
 }
 
 void NcpHost::SetUdpForwardToHostCallback(UdpForwardToHostCallback aCallback)
@@ -428,6 +431,8 @@ const otMeshLocalPrefix *NcpHost::GetMeshLocalPrefix(void) const
 
 void NcpHost::InitNetifCallbacks(Netif &aNetif)
 {
+    mNetif = &aNetif;
+
     mNcpSpinel.Ip6SetAddressCallback(
         [&aNetif](const std::vector<Ip6AddressInfo> &aAddrInfos) { aNetif.UpdateIp6UnicastAddresses(aAddrInfos); });
     mNcpSpinel.Ip6SetAddressMulticastCallback(
@@ -439,6 +444,8 @@ void NcpHost::InitNetifCallbacks(Netif &aNetif)
 
 void NcpHost::InitInfraIfCallbacks(InfraIf &aInfraIf)
 {
+    mInfraIf = &aInfraIf;
+
     mNcpSpinel.InfraIfSetIcmp6NdSendCallback(
         [&aInfraIf](uint32_t aInfraIfIndex, const otIp6Address &aAddr, const uint8_t *aData, uint16_t aDataLen) {
             OTBR_UNUSED_VARIABLE(aInfraIf.SendIcmp6Nd(aInfraIfIndex, aAddr, aData, aDataLen));
@@ -450,6 +457,24 @@ otbrError NcpHost::Ip6Send(const uint8_t *aData, uint16_t aLength)
     return mNcpSpinel.Ip6Send(aData, aLength);
 }
 
+otbrError NcpHost::Ip6SendBatch(PacketBuffer *aPackets, size_t aCount, size_t &aSentCount)
+{
+    static_assert(Netif::kIp6SendHeadroom >= NcpSpinel::kStreamNetHeaderMaxSize,
+                  "The TUN packets must leave room for the STREAM_NET frame header");
+
+    otbrError error = OTBR_ERROR_NONE;
+
+    // Spinel carries one datagram per STREAM_NET frame, and each frame needs its own TID for the NCP to
+    // acknowledge it. So the packets are sent one by one; the batch only saves the per-packet TUN reads.
+    for (aSentCount = 0; aSentCount < aCount; aSentCount++)
+    {
+        SuccessOrExit(error = mNcpSpinel.Ip6Send(aPackets[aSentCount]));
+    }
+
+exit:
+    return error;
+}
+
 otbrError NcpHost::Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded)
 {
     return mNcpSpinel.Ip6MulAddrUpdateSubscription(aAddress, aIsAdded);
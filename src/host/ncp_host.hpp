@@ -45,6 +45,9 @@
 #include "posix/netif.hpp"
 
 namespace otbr {
+
+class MulticastRoutingManager;
+
 namespace Host {
 
 /**
@@ -146,15 +149,63 @@ public:
     bool            IsInitialized(void) const override { return mIsInitialized; }
 
     // MainloopProcessor methods
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "NcpHost"; }
 
 #if OTBR_ENABLE_MDNS
     void SetMdnsPublisher(Mdns::Publisher *aPublisher);
 #endif
 
     void InitNetifCallbacks(Netif &aNetif);
+
+    /**
+     * This method returns the Thread network interface set by `InitNetifCallbacks()`.
+     *
+     * @returns A pointer to the Thread network interface, nullptr if not initialized yet.
+     */
+    const Netif *GetNetif(void) const { return mNetif; }
+
+    /**
+     * This method returns the counters of the Spinel commands sent to the NCP.
+     *
+     * @returns The Spinel command counters.
+     */
+    NcpSpinel::CommandCounters GetSpinelCommandCounters(void) const { return mNcpSpinel.GetCommandCounters(); }
+
+    /**
+     * This method returns the task runner of the host.
+     *
+     * @returns A reference to the task runner.
+     */
+    const TaskRunner &GetTaskRunner(void) const { return mTaskRunner; }
+
+    /**
+     * This method sets the Multicast Routing Manager of the Backbone Router.
+     *
+     * @param[in] aMulticastRoutingManager  The Multicast Routing Manager.
+     */
+    void SetMulticastRoutingManager(const MulticastRoutingManager &aMulticastRoutingManager)
+    {
+        mMulticastRoutingManager = &aMulticastRoutingManager;
+    }
+
+    /**
+     * This method returns the Multicast Routing Manager set by `SetMulticastRoutingManager()`.
+     *
+     * @returns A pointer to the Multicast Routing Manager, nullptr if not set.
+     */
+    const MulticastRoutingManager *GetMulticastRoutingManager(void) const { return mMulticastRoutingManager; }
+
     void InitInfraIfCallbacks(InfraIf &aInfraIf);
+
+    /**
+     * This method returns the infrastructure interface passed to `InitInfraIfCallbacks()`.
+     *
+     * @returns A pointer to the infrastructure interface, nullptr if not initialized yet.
+     */
+    const InfraIf *GetInfraIf(void) const { return mInfraIf; }
+
     void SetHostPowerState(uint8_t aPowerState, const AsyncResultReceiver &aReceiver);
 
 #if OTBR_ENABLE_EPSKC
@@ -174,9 +225,10 @@ private:
                          uint16_t            aLength,
                          const otIp6Address &aRemoteAddr,
                          uint16_t            aRemotePort,
-                         const UdpProxy     &aUdpProxy) override;
+                         uint16_t            aThreadPort) override;
 
     otbrError Ip6Send(const uint8_t *aData, uint16_t aLength) override;
+    otbrError Ip6SendBatch(PacketBuffer *aPackets, size_t aCount, size_t &aSentCount) override;
     otbrError Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded) override;
     otbrError SetInfraIf(uint32_t                       aInfraIfIndex,
                          bool                           aIsRunning,
@@ -189,12 +241,15 @@ private:
     otbrError BorderRoutingProcessDhcp6PdPrefix(const otBorderRoutingPrefixTableEntry *aPrefixInfo) override;
 #endif
 
-    bool                      mIsInitialized;
-    ot::Spinel::SpinelDriver &mSpinelDriver;
-    otPlatformConfig          mConfig;
-    NcpSpinel                 mNcpSpinel;
-    TaskRunner                mTaskRunner;
-    CliDaemon                 mCliDaemon;
+    bool                           mIsInitialized;
+    ot::Spinel::SpinelDriver      &mSpinelDriver;
+    otPlatformConfig               mConfig;
+    NcpSpinel                      mNcpSpinel;
+    TaskRunner                     mTaskRunner{"NcpHost.TaskRunner"};
+    CliDaemon                      mCliDaemon;
+    Netif                         *mNetif;
+    const MulticastRoutingManager *mMulticastRoutingManager;
+    const InfraIf                 *mInfraIf;
 };
 
 } // namespace Host
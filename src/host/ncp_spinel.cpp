@@ -54,13 +54,22 @@ namespace Host {
 
 static constexpr char kSpinelDataUnpackFormat[] = "CiiD";
 
+constexpr Milliseconds NcpSpinel::kDefaultCommandTimeout;
+constexpr Milliseconds NcpSpinel::kStreamNetCommandTimeout;
+
 NcpSpinel::NcpSpinel(void)
     : mSpinelDriver(nullptr)
-    , mCmdTidsInUse(0)
-    , mCmdNextTid(1)
     , mNcpBuffer(mTxBuffer, kTxBufferSize)
     , mEncoder(mNcpBuffer)
     , mIid(SPINEL_HEADER_INVALID_IID)
+    , mCommandScheduler(
+          mTaskRunner,
+          [this](const uint8_t *aFrame, uint16_t aLength) {
+              return mSpinelDriver->GetSpinelInterface()->SendFrame(aFrame, aLength);
+          },
+          [this](spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError) {
+              HandleCommandFailure(aCmd, aKey, aError);
+          })
     , mPropsObserver(nullptr)
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     , mPublisher(nullptr)
@@ -69,8 +78,6 @@ NcpSpinel::NcpSpinel(void)
     , mDiscoveryProxyId(0)
 #endif
 {
-    std::fill_n(mWaitingKeyTable, SPINEL_PROP_LAST_STATUS, sizeof(mWaitingKeyTable));
-    memset(mCmdTable, 0, sizeof(mCmdTable));
 }
 
 void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aObserver)
@@ -96,6 +103,10 @@ void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aOb
 
 void NcpSpinel::Deinit(void)
 {
+    // No response will be received once the driver is detached, so the owners of the pending commands are completed
+    // here.
+    mCommandScheduler.Abort(OT_ERROR_ABORT);
+
     mSpinelDriver              = nullptr;
     mIp6AddressTableCallback   = nullptr;
     mNetifStateChangedCallback = nullptr;
@@ -130,13 +141,15 @@ void NcpSpinel::DatasetSetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDa
 
     VerifyOrExit(mDatasetSetActiveTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, encodingFunc, CommandPriority::kHigh));
     mDatasetSetActiveTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post([aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to set active dataset!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to set active dataset!");
+        });
     }
 }
 
@@ -150,13 +163,16 @@ void NcpSpinel::DatasetMgmtSetPending(std::shared_ptr<otOperationalDatasetTlvs>
 
     VerifyOrExit(mDatasetMgmtSetPendingTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS, encodingFunc,
+                                      CommandPriority::kHigh));
     mDatasetMgmtSetPendingTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post([aAsyncTask, error] { aAsyncTask->SetResult(error, "Failed to set pending dataset!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error] {
+            aAsyncTask->SetResult(error, "Failed to set pending dataset!");
+        });
     }
 }
 
@@ -167,14 +183,15 @@ void NcpSpinel::Ip6SetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
 
     VerifyOrExit(mIp6SetEnabledTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_IF_UP, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_IF_UP, encodingFunc, CommandPriority::kHigh));
     mIp6SetEnabledTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to enable the network interface!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to enable the network interface!");
+        });
     }
     return;
 }
@@ -186,12 +203,46 @@ otbrError NcpSpinel::Ip6Send(const uint8_t *aData, uint16_t aLength)
         return aEncoder.WriteDataWithLen(aData, aLength);
     };
 
-    SuccessOrExit(SetProperty(SPINEL_PROP_STREAM_NET, encodingFunc), error = OTBR_ERROR_OPENTHREAD);
+    SuccessOrExit(SetProperty(SPINEL_PROP_STREAM_NET, encodingFunc, CommandPriority::kLow, kStreamNetCommandTimeout),
+                  error = OTBR_ERROR_OPENTHREAD);
 
 exit:
     return error;
 }
 
+otbrError NcpSpinel::Ip6Send(PacketBuffer &aPacket)
+{
+    otbrError      error  = OTBR_ERROR_NONE;
+    spinel_tid_t   tid    = mCommandScheduler.AllocateTid();
+    uint8_t        header[kStreamNetHeaderMaxSize];
+    spinel_ssize_t headerLength;
+
+    VerifyOrExit(tid != 0, error = OTBR_ERROR_BUSY);
+
+    headerLength = spinel_datatype_pack(header, sizeof(header), SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT16_S,
+                                        SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid, SPINEL_CMD_PROP_VALUE_SET,
+                                        SPINEL_PROP_STREAM_NET, aPacket.GetLength());
+    VerifyOrExit(headerLength > 0, error = OTBR_ERROR_OPENTHREAD);
+    SuccessOrExit(error = aPacket.Prepend(header, static_cast<uint16_t>(headerLength)));
+
+    if (mSpinelDriver->GetSpinelInterface()->SendFrame(aPacket.GetData(), aPacket.GetLength()) != OT_ERROR_NONE)
+    {
+        error = OTBR_ERROR_OPENTHREAD;
+    }
+    aPacket.RemoveHeader(static_cast<uint16_t>(headerLength));
+    SuccessOrExit(error);
+
+    mCommandScheduler.StartTransaction(tid, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET,
+                                       Clock::now() + kStreamNetCommandTimeout);
+
+exit:
+    if (error != OTBR_ERROR_NONE && tid != 0)
+    {
+        mCommandScheduler.ReleaseTid(tid);
+    }
+    return error;
+}
+
 otbrError NcpSpinel::InputCommandLine(const char *aLine)
 {
     otbrError    error        = OTBR_ERROR_NONE;
@@ -210,14 +261,15 @@ void NcpSpinel::ThreadSetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
 
     VerifyOrExit(mThreadSetEnabledTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_STACK_UP, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_STACK_UP, encodingFunc, CommandPriority::kHigh));
     mThreadSetEnabledTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to enable the Thread network!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to enable the Thread network!");
+        });
     }
     return;
 }
@@ -229,36 +281,36 @@ void NcpSpinel::ThreadDetachGracefully(AsyncTaskPtr aAsyncTask)
 
     VerifyOrExit(mThreadDetachGracefullyTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_LEAVE_GRACEFULLY, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_LEAVE_GRACEFULLY, encodingFunc, CommandPriority::kHigh));
     mThreadDetachGracefullyTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post([aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to detach gracefully!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to detach gracefully!");
+        });
     }
     return;
 }
 
 void NcpSpinel::ThreadErasePersistentInfo(AsyncTaskPtr aAsyncTask)
 {
-    otError      error = OT_ERROR_NONE;
-    spinel_tid_t tid   = GetNextTid();
+    otError      error        = OT_ERROR_NONE;
+    EncodingFunc encodingFunc = [](ot::Spinel::Encoder &) { return OT_ERROR_NONE; };
 
     VerifyOrExit(mThreadErasePersistentInfoTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = mSpinelDriver->SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, tid));
-
-    mWaitingKeyTable[tid]          = SPINEL_PROP_LAST_STATUS;
-    mCmdTable[tid]                 = SPINEL_CMD_NET_CLEAR;
+    SuccessOrExit(error = SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, encodingFunc,
+                                      CommandPriority::kHigh));
     mThreadErasePersistentInfoTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        FreeTidTableItem(tid);
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to erase persistent info!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to erase persistent info!");
+        });
     }
 }
 
@@ -331,10 +383,14 @@ void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength, uin
     {
         HandleNotification(aFrame, aLength);
     }
-    else if (tid < kMaxTids)
+    else if (mCommandScheduler.IsWaitingResponse(tid))
     {
         HandleResponse(tid, aFrame, aLength);
     }
+    else if (mCommandScheduler.HandleLateResponse(tid))
+    {
+        otbrLogWarning("Dropped late response for timed out tid: %u", tid);
+    }
     else
     {
         otbrLogCrit("Received unexpected tid: %u", tid);
@@ -396,7 +452,7 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
 
     SuccessOrExit(error = SpinelDataUnpack(aFrame, aLength, kSpinelDataUnpackFormat, &header, &cmd, &key, &data, &len));
 
-    switch (mCmdTable[aTid])
+    switch (mCommandScheduler.GetCommand(aTid))
     {
     case SPINEL_CMD_PROP_VALUE_GET:
     {
@@ -434,13 +490,13 @@ exit:
     if (error == OTBR_ERROR_INVALID_STATE)
     {
         otbrLogCrit("Received unexpected response with (cmd:%u, key:%u), waiting (cmd:%u, key:%u) for tid:%u", cmd, key,
-                    mCmdTable[aTid], mWaitingKeyTable[aTid], aTid);
+                    mCommandScheduler.GetCommand(aTid), mCommandScheduler.GetWaitingKey(aTid), aTid);
     }
     else if (error == OTBR_ERROR_PARSE)
     {
         otbrLogCrit("Error parsing response with tid:%u", aTid);
     }
-    FreeTidTableItem(aTid);
+    mCommandScheduler.ReleaseTid(aTid);
 }
 
 void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
@@ -882,7 +938,7 @@ otbrError NcpSpinel::HandleResponseForPropGet(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mCommandScheduler.GetWaitingKey(aTid))
     {
     case SPINEL_PROP_BORDER_AGENT_MESHCOP_SERVICE_STATE:
     {
@@ -913,15 +969,15 @@ otbrError NcpSpinel::HandleResponseForPropGet(spinel_tid_t      aTid,
             spinel_status_t status = SPINEL_STATUS_OK;
 
             SuccessOrExit(error = SpinelDataUnpack(aData, aLength, SPINEL_DATATYPE_UINT_PACKED_S, &status));
-            otbrLogWarning("Failed to get dataset property %u: %s", mWaitingKeyTable[aTid],
+            otbrLogWarning("Failed to get dataset property %u: %s", mCommandScheduler.GetWaitingKey(aTid),
                            otThreadErrorToString(ot::Spinel::SpinelStatusToOtError(status)));
             ExitNow();
         }
-        VerifyOrExit(aKey == mWaitingKeyTable[aTid], error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(aKey == mCommandScheduler.GetWaitingKey(aTid), error = OTBR_ERROR_INVALID_STATE);
 
         VerifyOrExit(ParseOperationalDatasetTlvs(aData, aLength, datasetTlvs) == OT_ERROR_NONE,
                      error = OTBR_ERROR_PARSE);
-        if (mWaitingKeyTable[aTid] == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS)
+        if (mCommandScheduler.GetWaitingKey(aTid) == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS)
         {
             mPropsObserver->SetDatasetActiveTlvs(datasetTlvs);
         }
@@ -933,7 +989,7 @@ otbrError NcpSpinel::HandleResponseForPropGet(spinel_tid_t      aTid,
     }
 
     default:
-        VerifyOrExit(aKey == mWaitingKeyTable[aTid], error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(aKey == mCommandScheduler.GetWaitingKey(aTid), error = OTBR_ERROR_INVALID_STATE);
         break;
     }
 
@@ -952,7 +1008,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
     otbrError       error  = OTBR_ERROR_NONE;
     spinel_status_t status = SPINEL_STATUS_OK;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mCommandScheduler.GetWaitingKey(aTid))
     {
     case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
         if (aKey == SPINEL_PROP_LAST_STATUS)
@@ -1113,7 +1169,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
         break;
 
     default:
-        VerifyOrExit(aKey == mWaitingKeyTable[aTid], error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(aKey == mCommandScheduler.GetWaitingKey(aTid), error = OTBR_ERROR_INVALID_STATE);
         break;
     }
 
@@ -1129,7 +1185,7 @@ otbrError NcpSpinel::HandleResponseForPropInsert(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mCommandScheduler.GetWaitingKey(aTid))
     {
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
         if (aCmd == SPINEL_CMD_PROP_VALUE_IS)
@@ -1150,7 +1206,7 @@ otbrError NcpSpinel::HandleResponseForPropInsert(spinel_tid_t      aTid,
     }
 
 exit:
-    otbrLogResult(error, "HandleResponseForPropInsert, key:%u", mWaitingKeyTable[aTid]);
+    otbrLogResult(error, "HandleResponseForPropInsert, key:%u", mCommandScheduler.GetWaitingKey(aTid));
     return error;
 }
 
@@ -1162,7 +1218,7 @@ otbrError NcpSpinel::HandleResponseForPropRemove(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mCommandScheduler.GetWaitingKey(aTid))
     {
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
         if (aCmd == SPINEL_CMD_PROP_VALUE_IS)
@@ -1183,7 +1239,7 @@ otbrError NcpSpinel::HandleResponseForPropRemove(spinel_tid_t      aTid,
     }
 
 exit:
-    otbrLogResult(error, "HandleResponseForPropRemove, key:%u", mWaitingKeyTable[aTid]);
+    otbrLogResult(error, "HandleResponseForPropRemove, key:%u", mCommandScheduler.GetWaitingKey(aTid));
     return error;
 }
 
@@ -1216,56 +1272,41 @@ exit:
     return error;
 }
 
-spinel_tid_t NcpSpinel::GetNextTid(void)
+otError NcpSpinel::SendCommand(spinel_command_t    aCmd,
+                               spinel_prop_key_t   aKey,
+                               const EncodingFunc &aEncodingFunc,
+                               CommandPriority     aPriority,
+                               Milliseconds        aTimeout)
 {
-    spinel_tid_t tid = mCmdNextTid;
+    otError      error    = OT_ERROR_NONE;
+    Timepoint    deadline = Clock::now() + aTimeout;
+    spinel_tid_t tid      = mCommandScheduler.AllocateTid();
+    uint8_t      header   = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
 
-    while (((1 << tid) & mCmdTidsInUse) != 0)
+    // Commands without a free tid are encoded with tid 0, the tid is filled in when they are sent.
+    if (aKey == SPINEL_PROP_LAST_STATUS)
     {
-        tid = SPINEL_GET_NEXT_TID(tid);
-
-        if (tid == mCmdNextTid)
-        {
-            // We looped back to `mCmdNextTid` indicating that all
-            // TIDs are in-use.
-
-            ExitNow(tid = 0);
-        }
+        SuccessOrExit(error = mEncoder.BeginFrame(header, aCmd));
+    }
+    else
+    {
+        SuccessOrExit(error = mEncoder.BeginFrame(header, aCmd, aKey));
     }
-
-    mCmdTidsInUse |= (1 << tid);
-    mCmdNextTid = SPINEL_GET_NEXT_TID(tid);
-
-exit:
-    return tid;
-}
-
-void NcpSpinel::FreeTidTableItem(spinel_tid_t aTid)
-{
-    mCmdTidsInUse &= ~(1 << aTid);
-
-    mCmdTable[aTid]        = SPINEL_CMD_NOOP;
-    mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
-}
-
-otError NcpSpinel::SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
-{
-    otError      error  = OT_ERROR_NONE;
-    spinel_tid_t tid    = GetNextTid();
-    uint8_t      header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
-
-    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
-    SuccessOrExit(error = mEncoder.BeginFrame(header, aCmd, aKey));
     SuccessOrExit(error = aEncodingFunc(mEncoder));
     SuccessOrExit(error = mEncoder.EndFrame());
+
+    if (tid == 0)
+    {
+        ExitNow(error = QueueEncodedFrame(aCmd, aKey, aPriority, deadline));
+    }
+
     SuccessOrExit(error = SendEncodedFrame());
+    mCommandScheduler.StartTransaction(tid, aCmd, aKey, deadline);
 
-    mCmdTable[tid]        = aCmd;
-    mWaitingKeyTable[tid] = aKey;
 exit:
-    if (error != OT_ERROR_NONE)
+    if (error != OT_ERROR_NONE && tid != 0)
     {
-        FreeTidTableItem(tid);
+        mCommandScheduler.ReleaseTid(tid);
     }
 
     return error;
@@ -1279,9 +1320,12 @@ otError NcpSpinel::GetProperty(spinel_prop_key_t aKey)
     });
 }
 
-otError NcpSpinel::SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
+otError NcpSpinel::SetProperty(spinel_prop_key_t   aKey,
+                               const EncodingFunc &aEncodingFunc,
+                               CommandPriority     aPriority,
+                               Milliseconds        aTimeout)
 {
-    return SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, aEncodingFunc);
+    return SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, aEncodingFunc, aPriority, aTimeout);
 }
 
 otError NcpSpinel::InsertProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
@@ -1310,6 +1354,72 @@ exit:
     return error;
 }
 
+otError NcpSpinel::QueueEncodedFrame(spinel_command_t  aCmd,
+                                     spinel_prop_key_t aKey,
+                                     CommandPriority   aPriority,
+                                     Timepoint         aDeadline)
+{
+    otError              error = OT_ERROR_NONE;
+    std::vector<uint8_t> frame;
+    uint16_t             frameLength;
+
+    SuccessOrExit(error = mNcpBuffer.OutFrameBegin());
+
+    frameLength = mNcpBuffer.OutFrameGetLength();
+    frame.resize(frameLength);
+    VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, frame.data()) == frameLength, error = OT_ERROR_FAILED);
+
+    error = mCommandScheduler.Enqueue(std::move(frame), aCmd, aKey, aPriority, aDeadline);
+
+exit:
+    IgnoreError(mNcpBuffer.OutFrameRemove());
+    return error;
+}
+
+void NcpSpinel::HandleCommandFailure(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError)
+{
+    otbrLogWarning("Spinel command (cmd:%u, key:%u) failed: %s", aCmd, aKey, otThreadErrorToString(aError));
+
+    if (aCmd == SPINEL_CMD_NET_CLEAR)
+    {
+        CallAndClear(mThreadErasePersistentInfoTask, aError);
+    }
+
+    VerifyOrExit(aCmd == SPINEL_CMD_PROP_VALUE_SET);
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
+        CallAndClear(mDatasetSetActiveTask, aError);
+        break;
+    case SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS:
+        CallAndClear(mDatasetMgmtSetPendingTask, aError);
+        break;
+    case SPINEL_PROP_NET_IF_UP:
+        CallAndClear(mIp6SetEnabledTask, aError);
+        break;
+    case SPINEL_PROP_NET_STACK_UP:
+        CallAndClear(mThreadSetEnabledTask, aError);
+        break;
+    case SPINEL_PROP_NET_LEAVE_GRACEFULLY:
+        CallAndClear(mThreadDetachGracefullyTask, aError);
+        break;
+    case SPINEL_PROP_HOST_POWER_STATE:
+        CallAndClear(mSetHostPowerStateTask, aError);
+        break;
+    case SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_ENABLE:
+    case SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_ACTIVATE:
+    case SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_DEACTIVATE:
+        CallAndClear(mEphemeralKeyTask, aError);
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
 otError NcpSpinel::ParseIp6AddressTable(const uint8_t               *aBuf,
                                         uint16_t                     aLength,
                                         std::vector<Ip6AddressInfo> &aAddressTable)
@@ -1601,14 +1711,15 @@ void NcpSpinel::SetHostPowerState(uint8_t aState, AsyncTaskPtr aAsyncTask)
     VerifyOrExit(mSetHostPowerStateTask == nullptr, error = OT_ERROR_BUSY);
     VerifyOrExit(aState <= SPINEL_HOST_POWER_STATE_ONLINE, error = OT_ERROR_INVALID_ARGS);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_HOST_POWER_STATE, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_HOST_POWER_STATE, encodingFunc, CommandPriority::kHigh));
     mSetHostPowerStateTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to set host power state!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to set host power state!");
+        });
     }
 }
 
@@ -1620,15 +1731,17 @@ void NcpSpinel::EnableEphemeralKey(bool aEnable, AsyncTaskPtr aAsyncTask)
 
     VerifyOrExit(mEphemeralKeyTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_ENABLE, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_ENABLE, encodingFunc,
+                                      CommandPriority::kHigh));
     mEphemeralKeyTask = aAsyncTask;
 
 exit:
 
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to enable ephemeral key!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to enable ephemeral key!");
+        });
     }
 }
 
@@ -1651,14 +1764,16 @@ void NcpSpinel::ActivateEphemeralKey(const char  *aPskc,
 
     VerifyOrExit(mEphemeralKeyTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_ACTIVATE, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_ACTIVATE, encodingFunc,
+                                      CommandPriority::kHigh));
     mEphemeralKeyTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to activate ephemeral key!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to activate ephemeral key!");
+        });
     }
 }
 
@@ -1671,14 +1786,16 @@ void NcpSpinel::DeactivateEphemeralKey(bool aRetainActiveSession, AsyncTaskPtr a
 
     VerifyOrExit(mEphemeralKeyTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_DEACTIVATE, encodingFunc));
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_BORDER_AGENT_EPHEMERAL_KEY_DEACTIVATE, encodingFunc,
+                                      CommandPriority::kHigh));
     mEphemeralKeyTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to deactivate ephemeral key!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to deactivate ephemeral key!");
+        });
     }
 }
 #endif // OTBR_ENABLE_EPSKC
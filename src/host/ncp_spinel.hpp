@@ -36,7 +36,6 @@
 
 #include <functional>
 #include <memory>
-
 #include <vector>
 
 #include <openthread/backbone_router_ftd.h>
@@ -55,12 +54,15 @@
 #include "lib/spinel/spinel_driver.hpp"
 #include "lib/spinel/spinel_encoder.hpp"
 
+#include "common/packet_buffer.hpp"
 #include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "host/async_task.hpp"
 #include "host/posix/cli_daemon.hpp"
 #include "host/posix/infra_if.hpp"
 #include "host/posix/netif.hpp"
+#include "host/spinel_command_scheduler.hpp"
 #include "mdns/mdns.hpp"
 
 namespace otbr {
@@ -119,6 +121,13 @@ public:
     using InfraIfSendIcmp6NdCallback = std::function<void(uint32_t, const otIp6Address &, const uint8_t *, uint16_t)>;
     using BorderAgentMeshCoPServiceChangedCallback = std::function<void(bool, uint16_t, const uint8_t *, uint16_t)>;
     using CliDaemonOutputCallback                  = std::function<void(const char *)>;
+
+    // The Spinel header, the packed PROP_VALUE_SET command and STREAM_NET key and the datagram length.
+    static constexpr uint16_t kStreamNetHeaderMaxSize = 1 + 3 + 3 + sizeof(uint16_t);
+
+    using CommandPriority = SpinelCommandScheduler::Priority;
+    using CommandCounters = SpinelCommandScheduler::Counters;
+
     /**
      * Callback for forwarding UDP packets to the host.
      *
@@ -158,6 +167,13 @@ public:
      */
     const char *GetCoprocessorVersion(void) { return mSpinelDriver->GetVersion(); }
 
+    /**
+     * This method returns the counters of the Spinel command scheduler.
+     *
+     * @returns The command scheduler counters.
+     */
+    CommandCounters GetCommandCounters(void) const { return mCommandScheduler.GetCounters(); }
+
     /**
      * This method sets the active dataset on the NCP.
      *
@@ -235,6 +251,23 @@ public:
      */
     otbrError Ip6Send(const uint8_t *aData, uint16_t aLength);
 
+    /**
+     * This method sends an IP6 datagram held by a packet buffer through the NCP.
+     *
+     * The Spinel frame is encoded in place: the frame header is written into the headroom of @p aPacket
+     * and the frame is handed to the Spinel interface without copying the datagram into the tx buffer.
+     * The data start of @p aPacket is restored before returning.
+     *
+     * @param[in] aPacket  The packet buffer holding the IP6 datagram, with at least `kStreamNetHeaderMaxSize`
+     *                     bytes of headroom.
+     *
+     * @retval OTBR_ERROR_NONE          The datagram is sent to NCP successfully.
+     * @retval OTBR_ERROR_BUSY          NcpSpinel is busy with other requests.
+     * @retval OTBR_ERROR_INVALID_ARGS  The headroom of @p aPacket is too small.
+     * @retval OTBR_ERROR_OPENTHREAD    Failed to encode or send the frame.
+     */
+    otbrError Ip6Send(PacketBuffer &aPacket);
+
     /**
      * This method updates the multicast address subscription on NCP.
      *
@@ -499,10 +532,14 @@ public:
 private:
     using FailureHandler = std::function<void(otError)>;
 
-    static constexpr uint8_t  kMaxTids             = 16;
     static constexpr uint16_t kCallbackDataMaxSize = sizeof(uint64_t); // Maximum size of a function pointer.
     static constexpr uint16_t kMaxSubTypes         = 64;               // Maximum number of sub types in a MDNS service.
 
+    // The time a command may wait for a free transaction id and its response in total.
+    static constexpr Milliseconds kDefaultCommandTimeout = Milliseconds(10000);
+    // Queued datagrams are stale long before the default timeout.
+    static constexpr Milliseconds kStreamNetCommandTimeout = Milliseconds(2000);
+
     template <typename Function, typename... Args> static void SafeInvoke(Function &aFunc, Args &&...aArgs)
     {
         if (aFunc)
@@ -557,17 +594,26 @@ private:
                                           uint16_t          aLength);
     void      HandleNcpUnexpectedReset(spinel_status_t aStatus);
 
-    spinel_tid_t GetNextTid(void);
-    void         FreeTidTableItem(spinel_tid_t aTid);
-
     using EncodingFunc = std::function<otError(ot::Spinel::Encoder &aEncoder)>;
-    otError SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
+    otError SendCommand(spinel_command_t    aCmd,
+                        spinel_prop_key_t   aKey,
+                        const EncodingFunc &aEncodingFunc,
+                        CommandPriority     aPriority = CommandPriority::kNormal,
+                        Milliseconds        aTimeout  = kDefaultCommandTimeout);
     otError GetProperty(spinel_prop_key_t aKey);
-    otError SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
+    otError SetProperty(spinel_prop_key_t   aKey,
+                        const EncodingFunc &aEncodingFunc,
+                        CommandPriority     aPriority = CommandPriority::kNormal,
+                        Milliseconds        aTimeout  = kDefaultCommandTimeout);
     otError InsertProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
     otError RemoveProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
 
     otError SendEncodedFrame(void);
+    otError QueueEncodedFrame(spinel_command_t  aCmd,
+                              spinel_prop_key_t aKey,
+                              CommandPriority   aPriority,
+                              Timepoint         aDeadline);
+    void    HandleCommandFailure(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError);
 
     otError ParseIp6AddressTable(const uint8_t *aBuf, uint16_t aLength, std::vector<Ip6AddressInfo> &aAddressTable);
     otError ParseIp6MulticastAddresses(const uint8_t *aBuf, uint16_t aLen, std::vector<Ip6Address> &aAddressList);
@@ -593,12 +639,6 @@ private:
 #endif
 
     ot::Spinel::SpinelDriver *mSpinelDriver;
-    uint16_t                  mCmdTidsInUse; ///< Used transaction ids.
-    spinel_tid_t              mCmdNextTid;   ///< Next available transaction id.
-
-    spinel_prop_key_t mWaitingKeyTable[kMaxTids]; ///< The property keys of ongoing transactions.
-    spinel_command_t  mCmdTable[kMaxTids];        ///< The mapping of spinel command and tids when the response
-                                                  ///< is LAST_STATUS.
 
     static constexpr uint16_t kTxBufferSize = 2048;
     uint8_t                   mTxBuffer[kTxBufferSize];
@@ -606,7 +646,8 @@ private:
     ot::Spinel::Encoder       mEncoder;
     spinel_iid_t              mIid; /// < Interface Id used to in Spinel header
 
-    TaskRunner mTaskRunner;
+    TaskRunner             mTaskRunner{"NcpSpinel.TaskRunner"};
+    SpinelCommandScheduler mCommandScheduler;
 
     PropsObserver *mPropsObserver;
 #if OTBR_ENABLE_MDNS
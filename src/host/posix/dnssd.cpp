@@ -673,7 +673,7 @@ void DnssdPlatform::PostServiceSubscriptionUpdateTask(void)
 {
     if (!mServiceSubscriptionUpdateTaskPosted)
     {
-        mTaskRunner.Post([this](void) { this->ExecuteServiceSubscriptionUpdate(); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [this](void) { this->ExecuteServiceSubscriptionUpdate(); });
         mServiceSubscriptionUpdateTaskPosted = true;
     }
 }
@@ -715,7 +715,7 @@ void DnssdPlatform::PostHostSubscriptionUpdateTask(void)
 {
     if (!mHostSubscriptionUpdateTaskPosted)
     {
-        mTaskRunner.Post([this](void) { this->ExecuteHostSubscriptionUpdate(); });
+        mTaskRunner.Post(TaskRunner::Priority::kHigh, [this](void) { this->ExecuteHostSubscriptionUpdate(); });
         mHostSubscriptionUpdateTaskPosted = true;
     }
 }
@@ -402,7 +402,7 @@ private:
     Mdns::Publisher                                 &mPublisher;
     State                                            mState;
     bool                                             mRunning;
-    TaskRunner                                       mTaskRunner;
+    TaskRunner                                       mTaskRunner{"DnssdPlatform.TaskRunner"};
     bool                                             mServiceSubscriptionUpdateTaskPosted;
     bool                                             mHostSubscriptionUpdateTaskPosted;
     Mdns::Publisher::State                           mPublisherState;
@@ -36,6 +36,7 @@
 
 #include <ifaddrs.h>
 #ifdef __linux__
+#include <linux/filter.h>
 #include <linux/netlink.h>
 #include <linux/rtnetlink.h>
 #endif
@@ -46,6 +47,8 @@
 #include <errno.h>
 #include <sys/ioctl.h>
 
+#include <algorithm>
+
 #include "utils/socket_utils.hpp"
 
 namespace otbr {
@@ -69,10 +72,14 @@ otbrError InfraIf::Dependencies::HandleIcmp6Nd(uint32_t, const Ip6Address &, con
 InfraIf::InfraIf(Dependencies &aDependencies)
     : mDeps(aDependencies)
     , mInfraIfIndex(0)
+    , mFlags(0)
+    , mIsRunning(false)
 #ifdef __linux__
     , mNetlinkSocket(-1)
 #endif
     , mInfraIfIcmp6Socket(-1)
+    , mIoctlSocket(-1)
+    , mIcmp6Counters()
 {
 }
 
@@ -96,6 +103,45 @@ int CreateNetlinkSocket(void)
 
     return sock;
 }
+
+// Applies a RTM_NEWADDR/RTM_DELADDR message of the interface to the address list, returns whether it changed.
+static bool UpdateAddresses(nlmsghdr &aHeader, unsigned int aIfIndex, std::vector<Ip6Address> &aAddresses)
+{
+    bool       changed = false;
+    ifaddrmsg *ifAddr  = reinterpret_cast<ifaddrmsg *>(NLMSG_DATA(&aHeader));
+    int        len     = static_cast<int>(IFA_PAYLOAD(&aHeader));
+
+    VerifyOrExit(aHeader.nlmsg_len >= NLMSG_LENGTH(sizeof(ifaddrmsg)));
+    VerifyOrExit(ifAddr->ifa_family == AF_INET6 && ifAddr->ifa_index == aIfIndex);
+
+    for (rtattr *rta = IFA_RTA(ifAddr); RTA_OK(rta, len); rta = RTA_NEXT(rta, len))
+    {
+        Ip6Address                        address;
+        std::vector<Ip6Address>::iterator it;
+
+        if (rta->rta_type != IFA_ADDRESS || RTA_PAYLOAD(rta) != sizeof(otIp6Address))
+        {
+            continue;
+        }
+
+        address = Ip6Address(*reinterpret_cast<const otIp6Address *>(RTA_DATA(rta)));
+        it      = std::find(aAddresses.begin(), aAddresses.end(), address);
+
+        if (aHeader.nlmsg_type == RTM_NEWADDR && it == aAddresses.end())
+        {
+            aAddresses.push_back(address);
+            changed = true;
+        }
+        else if (aHeader.nlmsg_type == RTM_DELADDR && it != aAddresses.end())
+        {
+            aAddresses.erase(it);
+            changed = true;
+        }
+    }
+
+exit:
+    return changed;
+}
 #endif // __linux__
 
 void InfraIf::Init(void)
@@ -115,11 +161,20 @@ void InfraIf::Deinit(void)
     }
 #endif
     mInfraIfIndex = 0;
+    mAddresses.clear();
+    mFlags     = 0;
+    mIsRunning = false;
 
     if (mInfraIfIcmp6Socket != -1)
     {
         close(mInfraIfIcmp6Socket);
     }
+
+    if (mIoctlSocket != -1)
+    {
+        close(mIoctlSocket);
+        mIoctlSocket = -1;
+    }
 }
 
 void InfraIf::Process(const MainloopContext &aContext)
@@ -131,7 +186,7 @@ void InfraIf::Process(const MainloopContext &aContext)
 
     if (FD_ISSET(mInfraIfIcmp6Socket, &aContext.mReadFdSet))
     {
-        ReceiveIcmp6Message();
+        ReceiveIcmp6Messages();
     }
 #ifdef __linux__
     if (FD_ISSET(mNetlinkSocket, &aContext.mReadFdSet))
@@ -164,13 +219,18 @@ exit:
 
 otbrError InfraIf::SetInfraIf(std::string aInfraIfName)
 {
-    otbrError               error = OTBR_ERROR_NONE;
-    std::vector<Ip6Address> addresses;
+    otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(!aInfraIfName.empty(), error = OTBR_ERROR_INVALID_ARGS);
     VerifyOrExit(aInfraIfName.size() < IFNAMSIZ, error = OTBR_ERROR_INVALID_ARGS);
     mInfraIfName = std::move(aInfraIfName);
 
+    if (mIoctlSocket == -1)
+    {
+        mIoctlSocket = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketBlock);
+        VerifyOrDie(mIoctlSocket != -1, otbrErrorString(OTBR_ERROR_ERRNO));
+    }
+
     mInfraIfIndex = if_nametoindex(mInfraIfName.c_str());
     VerifyOrExit(mInfraIfIndex != 0, error = OTBR_ERROR_INVALID_STATE);
 
@@ -181,9 +241,12 @@ otbrError InfraIf::SetInfraIf(std::string aInfraIfName)
     mInfraIfIcmp6Socket = CreateIcmp6Socket(mInfraIfName.c_str());
     VerifyOrDie(mInfraIfIcmp6Socket != -1, "Failed to create Icmp6 socket!");
 
-    addresses = GetAddresses();
+    // The cache is built once here and then updated incrementally from the netlink events.
+    mAddresses = GetAddresses();
+    mFlags     = GetFlags();
+    mIsRunning = IsRunning();
 
-    SuccessOrExit(mDeps.SetInfraIf(mInfraIfIndex, IsRunning(addresses), addresses), error = OTBR_ERROR_OPENTHREAD);
+    SuccessOrExit(mDeps.SetInfraIf(mInfraIfIndex, mIsRunning, mAddresses), error = OTBR_ERROR_OPENTHREAD);
 exit:
     otbrLogResult(error, "SetInfraIf");
 
@@ -265,6 +328,41 @@ exit:
     return error;
 }
 
+#ifdef __linux__
+otbrError InfraIf::AttachIcmp6NdFilter(int aSocket)
+{
+    // The socket filter sees the ICMPv6 message without the IPv6 header. It further drops the ND messages with a
+    // non-zero code or a truncated header (RFC 4861), so they never wake up the mainloop.
+    static const struct sock_filter kNdFilterCode[] = {
+        BPF_STMT(BPF_LDX | BPF_W | BPF_LEN, 0),                                // 0:  X = length
+        BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 1),                                 // 1:  A = code
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 0, 0, 11),                         // 2:  code != 0 => 14
+        BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 0),                                 // 3:  A = type
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_ROUTER_SOLICIT, 3, 0),          // 4:  RS => 8
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_ROUTER_ADVERT, 4, 0),           // 5:  RA => 10
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_NEIGHBOR_ADVERT, 5, 0),         // 6:  NA => 12
+        BPF_STMT(BPF_RET | BPF_K, 0),                                          // 7:  drop
+        BPF_STMT(BPF_MISC | BPF_TXA, 0),                                       // 8:  A = length
+        BPF_JUMP(BPF_JMP | BPF_JGE | BPF_K, sizeof(nd_router_solicit), 5, 4),  // 9:  accept or drop
+        BPF_STMT(BPF_MISC | BPF_TXA, 0),                                       // 10: A = length
+        BPF_JUMP(BPF_JMP | BPF_JGE | BPF_K, sizeof(nd_router_advert), 3, 2),   // 11: accept or drop
+        BPF_STMT(BPF_MISC | BPF_TXA, 0),                                       // 12: A = length
+        BPF_JUMP(BPF_JMP | BPF_JGE | BPF_K, sizeof(nd_neighbor_advert), 1, 0), // 13: accept or drop
+        BPF_STMT(BPF_RET | BPF_K, 0),                                          // 14: drop
+        BPF_STMT(BPF_RET | BPF_K, 0xffffffff),                                 // 15: accept
+    };
+    const struct sock_fprog kNdFilter = {sizeof(kNdFilterCode) / sizeof(kNdFilterCode[0]),
+                                         const_cast<struct sock_filter *>(kNdFilterCode)};
+    otbrError               error     = OTBR_ERROR_NONE;
+
+    VerifyOrExit(setsockopt(aSocket, SOL_SOCKET, SO_ATTACH_FILTER, &kNdFilter, sizeof(kNdFilter)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+#endif
+
 int InfraIf::CreateIcmp6Socket(const char *aInfraIfName)
 {
     int                 sock;
@@ -287,6 +385,14 @@ int InfraIf::CreateIcmp6Socket(const char *aInfraIfName)
     rval = setsockopt(sock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter));
     VerifyOrDie(rval == 0, strerror(errno));
 
+#ifdef __linux__
+    // Not fatal, the ICMP6_FILTER above still limits the message types.
+    if (AttachIcmp6NdFilter(sock) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to attach ICMPv6 ND socket filter: %s", strerror(errno));
+    }
+#endif
+
     // We want a source address and interface index.
     rval = setsockopt(sock, IPPROTO_IPV6, IPV6_RECVPKTINFO, &kEnable, sizeof(kEnable));
     VerifyOrDie(rval == 0, strerror(errno));
@@ -318,30 +424,24 @@ int InfraIf::CreateIcmp6Socket(const char *aInfraIfName)
     return sock;
 }
 
-bool InfraIf::IsRunning(const std::vector<Ip6Address> &aAddrs) const
+bool InfraIf::IsRunning(void) const
 {
-    return mInfraIfIndex ? ((GetFlags() & IFF_RUNNING) && HasLinkLocalAddress(aAddrs)) : false;
+    return mInfraIfIndex ? ((mFlags & IFF_RUNNING) && HasLinkLocalAddress(mAddresses)) : false;
 }
 
 short InfraIf::GetFlags(void) const
 {
-    int          sock;
     struct ifreq ifReq;
 
-    sock = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketBlock);
-    VerifyOrDie(sock != -1, otbrErrorString(OTBR_ERROR_ERRNO));
-
     memset(&ifReq, 0, sizeof(ifReq));
     strcpy(ifReq.ifr_name, mInfraIfName.c_str());
 
-    if (ioctl(sock, SIOCGIFFLAGS, &ifReq) == -1)
+    if (ioctl(mIoctlSocket, SIOCGIFFLAGS, &ifReq) == -1)
     {
         otbrLogCrit("The infra link %s may be lost. Exiting.", mInfraIfName.c_str());
         DieNow(otbrErrorString(OTBR_ERROR_ERRNO));
     }
 
-    close(sock);
-
     return ifReq.ifr_flags;
 }
 
@@ -391,11 +491,37 @@ bool InfraIf::HasLinkLocalAddress(const std::vector<Ip6Address> &aAddrs)
     return hasLla;
 }
 
-void InfraIf::ReceiveIcmp6Message(void)
+void InfraIf::ReportInfraIfState(bool aAddressesChanged)
+{
+    bool isRunning = IsRunning();
+
+    VerifyOrExit(aAddressesChanged || isRunning != mIsRunning);
+
+    mIsRunning = isRunning;
+    mDeps.SetInfraIf(mInfraIfIndex, mIsRunning, mAddresses);
+
+exit:
+    return;
+}
+
+void InfraIf::ReceiveIcmp6Messages(void)
+{
+    // Drain the messages which arrived together, e.g. the RAs from multiple routers on the infrastructure link.
+    for (uint16_t i = 0; i < kMaxIcmp6MessagesPerWakeup; i++)
+    {
+        if (!ReceiveIcmp6Message())
+        {
+            break;
+        }
+    }
+}
+
+bool InfraIf::ReceiveIcmp6Message(void)
 {
     static constexpr size_t kIp6Mtu = 1280;
 
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError error    = OTBR_ERROR_NONE;
+    bool      received = false;
     uint8_t   buffer[kIp6Mtu];
     uint16_t  bufferLength;
 
@@ -422,13 +548,18 @@ void InfraIf::ReceiveIcmp6Message(void)
     msg.msg_control    = cmsgbuf;
     msg.msg_controllen = sizeof(cmsgbuf);
 
-    rval = recvmsg(mInfraIfIcmp6Socket, &msg, 0);
+    rval = recvmsg(mInfraIfIcmp6Socket, &msg, MSG_DONTWAIT);
     if (rval < 0)
     {
-        otbrLogWarning("Failed to receive ICMPv6 message: %s", strerror(errno));
-        ExitNow(error = OTBR_ERROR_DROPPED);
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            otbrLogWarning("Failed to receive ICMPv6 message: %s", strerror(errno));
+            mIcmp6Counters.mRxErrors++;
+        }
+        ExitNow();
     }
 
+    received     = true;
     bufferLength = static_cast<uint16_t>(rval);
 
     for (cmh = CMSG_FIRSTHDR(&msg); cmh; cmh = CMSG_NXTHDR(&msg, cmh))
@@ -453,11 +584,20 @@ void InfraIf::ReceiveIcmp6Message(void)
     // the hoplimit must be 255 and the source address must be a link-local address.
     VerifyOrExit(hopLimit == 255 && IN6_IS_ADDR_LINKLOCAL(&srcAddr.sin6_addr), error = OTBR_ERROR_DROPPED);
 
+    mIcmp6Counters.mAccepted++;
     mDeps.HandleIcmp6Nd(mInfraIfIndex, Ip6Address(reinterpret_cast<otIp6Address &>(srcAddr.sin6_addr)), buffer,
                         bufferLength);
 
 exit:
-    otbrLogResult(error, "InfraIf: %s", __FUNCTION__);
+    if (received)
+    {
+        if (error != OTBR_ERROR_NONE)
+        {
+            mIcmp6Counters.mFiltered++;
+        }
+        otbrLogResult(error, "InfraIf: %s", __FUNCTION__);
+    }
+    return received;
 }
 
 #ifdef __linux__
@@ -465,52 +605,85 @@ void InfraIf::ReceiveNetlinkMessage(void)
 {
     const size_t kMaxNetlinkBufSize = 8192;
     ssize_t      len;
+    bool         stateChanged     = false;
+    bool         addressesChanged = false;
     union
     {
         nlmsghdr mHeader;
         uint8_t  mBuffer[kMaxNetlinkBufSize];
     } msgBuffer;
 
-    len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), /* flags */ 0);
-    if (len < 0)
+    // Drain all the pending events, so that a burst of changes is reported to the dependencies at once.
+    while (true)
     {
-        otbrLogCrit("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
-    }
-
-    for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
-         header                  = NLMSG_NEXT(header, len))
-    {
-        switch (header->nlmsg_type)
-        {
-        // There are no effective netlink message types to get us notified
-        // of interface RUNNING state changes. But addresses events are
-        // usually associated with interface state changes.
-        case RTM_NEWADDR:
-        case RTM_DELADDR:
-        case RTM_NEWLINK:
-        case RTM_DELLINK:
+        len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), MSG_DONTWAIT);
+        if (len < 0)
         {
-            std::vector<Ip6Address> addresses = GetAddresses();
-
-            mDeps.SetInfraIf(mInfraIfIndex, IsRunning(addresses), addresses);
-            break;
+            VerifyOrExit(errno != EAGAIN && errno != EWOULDBLOCK);
+
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // Some events were dropped, so the cache can only be rebuilt from scratch.
+            if (errno == ENOBUFS)
+            {
+                otbrLogWarning("Netlink events of the infra link were dropped, reloading the addresses");
+                if (mInfraIfIndex != 0)
+                {
+                    mAddresses       = GetAddresses();
+                    stateChanged     = true;
+                    addressesChanged = true;
+                }
+                continue;
+            }
+
+            otbrLogCrit("Failed to receive netlink message: %s", strerror(errno));
+            ExitNow();
         }
-        case NLMSG_ERROR:
-        {
-            struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
 
-            OTBR_UNUSED_VARIABLE(errMsg);
-            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
-            break;
-        }
-        default:
-            break;
+        for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+             header                  = NLMSG_NEXT(header, len))
+        {
+            switch (header->nlmsg_type)
+            {
+            // There are no effective netlink message types to get us notified
+            // of interface RUNNING state changes. But addresses events are
+            // usually associated with interface state changes.
+            case RTM_NEWADDR:
+            case RTM_DELADDR:
+                if (UpdateAddresses(*header, mInfraIfIndex, mAddresses))
+                {
+                    addressesChanged = true;
+                }
+                stateChanged = true;
+                break;
+            case RTM_NEWLINK:
+            case RTM_DELLINK:
+                stateChanged = true;
+                break;
+            case NLMSG_ERROR:
+            {
+                struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+
+                OTBR_UNUSED_VARIABLE(errMsg);
+                otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
+                break;
+            }
+            default:
+                break;
+            }
         }
     }
 
 exit:
-    return;
+    // The flags are read once for the whole batch of events.
+    if (stateChanged && mInfraIfIndex != 0)
+    {
+        mFlags = GetFlags();
+        ReportInfraIfState(addressesChanged);
+    }
 }
 #endif // __linux__
 
@@ -68,6 +68,18 @@ public:
                                         uint16_t          aDataLen);
     };
 
+    /**
+     * This structure represents the counters of the ICMPv6 ND messages received on the infrastructure interface.
+     *
+     * Messages dropped by the socket filters in the kernel are never seen by user space and are not counted.
+     */
+    struct Icmp6Counters
+    {
+        uint64_t mAccepted; ///< The number of messages passed to the dependencies.
+        uint64_t mFiltered; ///< The number of messages dropped for the interface, hop limit or source address.
+        uint64_t mRxErrors; ///< The number of failed receives.
+    };
+
     InfraIf(Dependencies &aDependencies);
 
     void      Init(void);
@@ -80,27 +92,59 @@ public:
 
     unsigned int GetIfIndex(void) const { return mInfraIfIndex; }
 
+    /**
+     * This method returns the counters of the received ICMPv6 ND messages.
+     *
+     * @returns The ICMPv6 ND counters.
+     */
+    const Icmp6Counters &GetIcmp6Counters(void) const { return mIcmp6Counters; }
+
+#ifdef __linux__
+    /**
+     * This method attaches the socket filter which drops the ICMPv6 ND messages with a non-zero code or
+     * a truncated header.
+     *
+     * The filter expects the ICMPv6 message at the start of the packet, as received by an ICMPv6 raw socket.
+     *
+     * @param[in] aSocket  The socket to attach the filter to.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully attached the filter.
+     * @retval OTBR_ERROR_ERRNO  Failed to attach the filter, see errno.
+     */
+    static otbrError AttachIcmp6NdFilter(int aSocket);
+#endif
+
 private:
+    static constexpr uint16_t kMaxIcmp6MessagesPerWakeup = 16; ///< Max ICMPv6 messages received per mainloop wakeup.
+
     static int              CreateIcmp6Socket(const char *aInfraIfName);
-    bool                    IsRunning(const std::vector<Ip6Address> &aAddrs) const;
+    bool                    IsRunning(void) const;
     short                   GetFlags(void) const;
     std::vector<Ip6Address> GetAddresses(void);
     static bool             HasLinkLocalAddress(const std::vector<Ip6Address> &aAddrs);
-    void                    ReceiveIcmp6Message(void);
+    void                    ReportInfraIfState(bool aAddressesChanged);
+    void                    ReceiveIcmp6Messages(void);
+    bool                    ReceiveIcmp6Message(void);
 #ifdef __linux__
     void ReceiveNetlinkMessage(void);
 #endif
 
-    void Process(const MainloopContext &aContext) override;
-    void Update(MainloopContext &aContext) override;
+    void        Process(const MainloopContext &aContext) override;
+    void        Update(MainloopContext &aContext) override;
+    const char *GetName(void) const override { return "InfraIf"; }
 
-    Dependencies &mDeps;
-    std::string   mInfraIfName;
-    unsigned int  mInfraIfIndex;
+    Dependencies           &mDeps;
+    std::string             mInfraIfName;
+    unsigned int            mInfraIfIndex;
+    std::vector<Ip6Address> mAddresses; ///< The cached IPv6 addresses of the infrastructure interface.
+    short                   mFlags;     ///< The cached flags of the infrastructure interface.
+    bool                    mIsRunning; ///< The running state last reported to the dependencies.
 #ifdef __linux__
     int mNetlinkSocket;
 #endif
-    int mInfraIfIcmp6Socket;
+    int           mInfraIfIcmp6Socket;
+    int           mIoctlSocket;
+    Icmp6Counters mIcmp6Counters;
 };
 
 } // namespace otbr
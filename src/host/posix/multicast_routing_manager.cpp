@@ -31,6 +31,8 @@
 #include <algorithm>
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <iterator>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/in.h>
@@ -43,11 +45,14 @@
 #include <unistd.h>
 #ifdef __linux__
 #include <linux/mroute6.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
 #endif
 
 #include <openthread/ip6.h>
 
 #include "common/code_utils.hpp"
+#include "common/log_rate_limiter.hpp"
 #include "common/logging.hpp"
 #include "common/time.hpp"
 #include "common/types.hpp"
@@ -58,14 +63,70 @@
 
 namespace otbr {
 
+constexpr uint32_t MulticastRoutingManager::kDefaultMfcCapacity;
+constexpr uint32_t MulticastRoutingManager::kNetlinkDumpTimeout;
+
+static bool ParseMulticastRouteStats(nlmsghdr      &aHeader,
+                                     Ip6Address    &aSrcAddr,
+                                     Ip6Address    &aGroupAddr,
+                                     unsigned long &aValidPktCnt)
+{
+    bool          parsed   = false;
+    bool          hasSrc   = false;
+    bool          hasGroup = false;
+    bool          hasStats = false;
+    rtmsg        *rtMsg    = reinterpret_cast<rtmsg *>(NLMSG_DATA(&aHeader));
+    int           len      = static_cast<int>(RTM_PAYLOAD(&aHeader));
+    rta_mfc_stats stats;
+
+    VerifyOrExit(aHeader.nlmsg_len >= NLMSG_LENGTH(sizeof(rtmsg)));
+    VerifyOrExit(rtMsg->rtm_family == RTNL_FAMILY_IP6MR);
+
+    for (rtattr *rta = RTM_RTA(rtMsg); RTA_OK(rta, len); rta = RTA_NEXT(rta, len))
+    {
+        switch (rta->rta_type)
+        {
+        case RTA_SRC:
+            VerifyOrExit(RTA_PAYLOAD(rta) == sizeof(in6_addr));
+            aSrcAddr.CopyFrom(*reinterpret_cast<const in6_addr *>(RTA_DATA(rta)));
+            hasSrc = true;
+            break;
+        case RTA_DST:
+            VerifyOrExit(RTA_PAYLOAD(rta) == sizeof(in6_addr));
+            aGroupAddr.CopyFrom(*reinterpret_cast<const in6_addr *>(RTA_DATA(rta)));
+            hasGroup = true;
+            break;
+        case RTA_MFC_STATS:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(stats));
+            memcpy(&stats, RTA_DATA(rta), sizeof(stats));
+            hasStats = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    VerifyOrExit(hasSrc && hasGroup && hasStats);
+
+    aValidPktCnt = static_cast<unsigned long>(stats.mfcs_packets - stats.mfcs_wrong_if);
+    parsed       = true;
+
+exit:
+    return parsed;
+}
+
 MulticastRoutingManager::MulticastRoutingManager(const Netif                   &aNetif,
                                                  const InfraIf                 &aInfraIf,
                                                  const Host::NetworkProperties &aNetworkProperties)
     : mNetif(aNetif)
     , mInfraIf(aInfraIf)
     , mNetworkProperties(aNetworkProperties)
+    , mMfcCapacity(kDefaultMfcCapacity)
+    , mMfcCounters()
     , mLastExpireTime(otbr::Timepoint::min())
     , mMulticastRouterSock(-1)
+    , mStatsDumpSock(-1)
+    , mStatsDumpDeadline(otbr::Timepoint::min())
     , mState(kStateDisabled)
     , mRetryIntervalUs(kMinRetryIntervalUs)
     , mNextRetryTime(otbr::Timepoint::min())
@@ -104,6 +165,35 @@ void MulticastRoutingManager::HandleBackboneMulticastListenerEvent(otBackboneRou
     }
 }
 
+otbrError MulticastRoutingManager::SetMfcCapacity(uint32_t aCapacity)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aCapacity > 0, error = OTBR_ERROR_INVALID_ARGS);
+
+    mMfcCapacity = aCapacity;
+
+    while (mMfcList.size() > mMfcCapacity)
+    {
+        RemoveMulticastForwardingCache(std::prev(mMfcList.end()));
+        mMfcCounters.mEvictions++;
+    }
+
+exit:
+    otbrLogResult(error, "%s: %u", __FUNCTION__, aCapacity);
+    return error;
+}
+
+MulticastRoutingManager::MfcCounters MulticastRoutingManager::GetMfcCounters(void) const
+{
+    MfcCounters counters = mMfcCounters;
+
+    counters.mEntries  = static_cast<uint32_t>(mMfcList.size());
+    counters.mCapacity = mMfcCapacity;
+
+    return counters;
+}
+
 void MulticastRoutingManager::Update(MainloopContext &aContext)
 {
     if (mState == kStateEnabling)
@@ -122,6 +212,19 @@ void MulticastRoutingManager::Update(MainloopContext &aContext)
 
     aContext.AddFdToReadSet(mMulticastRouterSock);
 
+    if (mStatsDumpSock >= 0)
+    {
+        otbr::Timepoint now     = Clock::now();
+        auto            delay   = (mStatsDumpDeadline > now) ? (mStatsDumpDeadline - now) : Clock::duration::zero();
+        struct timeval  timeout = ToTimeval(delay);
+
+        aContext.AddFdToReadSet(mStatsDumpSock);
+        if (timercmp(&timeout, &aContext.mTimeout, <))
+        {
+            aContext.mTimeout = timeout;
+        }
+    }
+
 exit:
     return;
 }
@@ -154,6 +257,11 @@ void MulticastRoutingManager::Process(const MainloopContext &aContext)
 
     VerifyOrExit(IsEnabled());
 
+    if (mStatsDumpSock >= 0)
+    {
+        ProcessMulticastRouteStatsDump(FD_ISSET(mStatsDumpSock, &aContext.mReadFdSet));
+    }
+
     ExpireMulticastForwardingCache();
 
     if (FD_ISSET(mMulticastRouterSock, &aContext.mReadFdSet))
@@ -254,10 +362,7 @@ otbrError MulticastRoutingManager::InitMulticastRouterSock(void)
     struct icmp6_filter filter;
     struct mif6ctl      mif6ctl;
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
-    {
-        mfc.Erase();
-    }
+    ClearMulticastForwardingCache();
 
     // Create a Multicast Routing socket
     mMulticastRouterSock = SocketWithCloseExec(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6, kSocketBlock);
@@ -311,6 +416,9 @@ void MulticastRoutingManager::FinalizeMulticastRouterSock(void)
 {
     VerifyOrExit(mMulticastRouterSock >= 0);
 
+    // The kernel flushes all MFC entries when the multicast router socket is closed.
+    StopMulticastRouteStatsDump();
+    ClearMulticastForwardingCache();
     close(mMulticastRouterSock);
     mMulticastRouterSock = -1;
 
@@ -414,12 +522,13 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6Ad
     mf6cctl.mf6cc_parent = kMifIndexBackbone;
     IF_SET(kMifIndexThread, &mf6cctl.mf6cc_ifset);
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    for (auto it = mMfcIndex.lower_bound(MfcKey(aGroupAddr, Ip6Address()));
+         it != mMfcIndex.end() && it->first.first == aGroupAddr; ++it)
     {
-        otbrError error;
+        otbrError                 error;
+        MulticastForwardingCache &mfc = *it->second;
 
-        if (!mfc.IsValid() || mfc.mIif != kMifIndexBackbone || mfc.mOif == kMifIndexThread ||
-            mfc.mGroupAddr != aGroupAddr)
+        if (mfc.mIif != kMifIndexBackbone || mfc.mOif == kMifIndexThread)
         {
             continue;
         }
@@ -432,6 +541,7 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6Ad
                     : OTBR_ERROR_ERRNO;
 
         mfc.Set(kMifIndexBackbone, kMifIndexThread);
+        TouchMulticastForwardingCache(it->second);
 
         otbrLogResult(error, "%s: %s %s => %s %s", __FUNCTION__, MifIndexToString(mfc.mIif),
                       mfc.mSrcAddr.ToString().c_str(), mfc.mGroupAddr.ToString().c_str(),
@@ -441,9 +551,13 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6Ad
 
 void MulticastRoutingManager::RemoveInboundMulticastForwardingCache(const Ip6Address &aGroupAddr)
 {
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    auto it = mMfcIndex.lower_bound(MfcKey(aGroupAddr, Ip6Address()));
+
+    while (it != mMfcIndex.end() && it->first.first == aGroupAddr)
     {
-        if (mfc.IsValid() && mfc.mIif == kMifIndexBackbone && mfc.mGroupAddr == aGroupAddr)
+        MfcList::iterator mfc = (it++)->second;
+
+        if (mfc->mIif == kMifIndexBackbone)
         {
             RemoveMulticastForwardingCache(mfc);
         }
@@ -452,30 +566,55 @@ void MulticastRoutingManager::RemoveInboundMulticastForwardingCache(const Ip6Add
 
 void MulticastRoutingManager::ExpireMulticastForwardingCache(void)
 {
-    struct sioc_sg_req6 sioc_sg_req6;
-    Timepoint           now = Clock::now();
-    struct mf6cctl      mf6cctl;
+    Timepoint now        = Clock::now();
+    Timepoint expireTime = now - Microseconds(kMulticastForwardingCacheExpireTimeout * kUsPerSecond);
 
+    // The idle entries are expired once the ongoing stats dump completes.
+    VerifyOrExit(mStatsDumpSock < 0);
     VerifyOrExit(now >= mLastExpireTime + Microseconds(kMulticastForwardingCacheExpiringInterval * kUsPerSecond));
 
     mLastExpireTime = now;
 
-    memset(&mf6cctl, 0, sizeof(mf6cctl));
-    memset(&sioc_sg_req6, 0, sizeof(sioc_sg_req6));
+    // The list is ordered by last use time, so only the idle entries at its tail need to be checked.
+    VerifyOrExit(!mMfcList.empty() && mMfcList.back().mLastUseTime < expireTime);
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    if (StartMulticastRouteStatsDump() != OTBR_ERROR_NONE)
     {
-        if (mfc.IsValid() &&
-            mfc.mLastUseTime + Microseconds(kMulticastForwardingCacheExpireTimeout * kUsPerSecond) < now)
+        otbrLogRateLimited(OTBR_LOG_INFO, "%s: failed to dump multicast route stats: %s, fall back to ioctl",
+                           __FUNCTION__, strerror(errno));
+        ExpireIdleMulticastForwardingCache(nullptr);
+    }
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::ExpireIdleMulticastForwardingCache(const MfcStats *aStats)
+{
+    Timepoint expireTime = Clock::now() - Microseconds(kMulticastForwardingCacheExpireTimeout * kUsPerSecond);
+    uint32_t  expired    = 0;
+
+    // An entry which still has traffic is moved to the head and therefore visited at most once.
+    while (!mMfcList.empty() && mMfcList.back().mLastUseTime < expireTime)
+    {
+        MfcList::iterator mfc = std::prev(mMfcList.end());
+
+        if (aStats != nullptr ? UpdateMulticastRouteInfo(*mfc, *aStats) : UpdateMulticastRouteInfo(*mfc))
         {
-            if (!UpdateMulticastRouteInfo(mfc))
-            {
-                // The multicast route is expired
-                RemoveMulticastForwardingCache(mfc);
-            }
+            TouchMulticastForwardingCache(mfc);
+        }
+        else
+        {
+            // The multicast route is expired
+            RemoveMulticastForwardingCache(mfc);
+            mMfcCounters.mExpirations++;
+            expired++;
         }
     }
 
+    VerifyOrExit(expired > 0);
+
+    otbrLogInfo("%s: removed %u idle entries", __FUNCTION__, expired);
     DumpMulticastForwardingCache();
 
 exit:
@@ -496,9 +635,9 @@ bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache
     {
         unsigned long validPktCnt;
 
-        otbrLogDebug("%s: SIOCGETSGCNT_IN6 %s => %s: bytecnt=%lu, pktcnt=%lu, wrong_if=%lu", __FUNCTION__,
-                     aMfc.mSrcAddr.ToString().c_str(), aMfc.mGroupAddr.ToString().c_str(), sioc_sg_req6.bytecnt,
-                     sioc_sg_req6.pktcnt, sioc_sg_req6.wrong_if);
+        otbrLogRateLimited(OTBR_LOG_DEBUG, "%s: SIOCGETSGCNT_IN6 %s => %s: bytecnt=%lu, pktcnt=%lu, wrong_if=%lu",
+                           __FUNCTION__, aMfc.mSrcAddr.ToString().c_str(), aMfc.mGroupAddr.ToString().c_str(),
+                           sioc_sg_req6.bytecnt, sioc_sg_req6.pktcnt, sioc_sg_req6.wrong_if);
 
         validPktCnt = sioc_sg_req6.pktcnt - sioc_sg_req6.wrong_if;
         if (validPktCnt != aMfc.mValidPktCnt)
@@ -510,13 +649,166 @@ bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache
     }
     else
     {
-        otbrLogDebug("%s: SIOCGETSGCNT_IN6 %s => %s failed: %s", __FUNCTION__, aMfc.mSrcAddr.ToString().c_str(),
-                     aMfc.mGroupAddr.ToString().c_str(), strerror(errno));
+        otbrLogRateLimited(OTBR_LOG_DEBUG, "%s: SIOCGETSGCNT_IN6 %s => %s failed: %s", __FUNCTION__,
+                           aMfc.mSrcAddr.ToString().c_str(), aMfc.mGroupAddr.ToString().c_str(), strerror(errno));
     }
 
     return updated;
 }
 
+bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc, const MfcStats &aStats) const
+{
+    bool                     updated = false;
+    MfcStats::const_iterator it      = aStats.find(MfcKey(aMfc.mGroupAddr, aMfc.mSrcAddr));
+
+    // A route missing from the dump has been removed by the kernel.
+    VerifyOrExit(it != aStats.end());
+    VerifyOrExit(it->second != aMfc.mValidPktCnt);
+
+    aMfc.SetValidPktCnt(it->second);
+    updated = true;
+
+exit:
+    return updated;
+}
+
+otbrError MulticastRoutingManager::StartMulticastRouteStatsDump(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    struct
+    {
+        nlmsghdr mHeader;
+        rtmsg    mRtMsg;
+    } request;
+
+    mStatsDumpSock = SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE, kSocketNonBlock);
+    VerifyOrExit(mStatsDumpSock != -1, error = OTBR_ERROR_ERRNO);
+
+    memset(&request, 0, sizeof(request));
+    request.mHeader.nlmsg_len   = NLMSG_LENGTH(sizeof(rtmsg));
+    request.mHeader.nlmsg_type  = RTM_GETROUTE;
+    request.mHeader.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.mHeader.nlmsg_seq   = 1;
+    request.mRtMsg.rtm_family   = RTNL_FAMILY_IP6MR;
+
+    VerifyOrExit(send(mStatsDumpSock, &request, request.mHeader.nlmsg_len, 0) != -1, error = OTBR_ERROR_ERRNO);
+
+    mStatsDumpDeadline = Clock::now() + Milliseconds(kNetlinkDumpTimeout);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        StopMulticastRouteStatsDump();
+    }
+    return error;
+}
+
+void MulticastRoutingManager::StopMulticastRouteStatsDump(void)
+{
+    int savedErrno = errno;
+
+    VerifyOrExit(mStatsDumpSock >= 0);
+
+    close(mStatsDumpSock);
+    mStatsDumpSock = -1;
+    mStatsDump.clear();
+
+exit:
+    errno = savedErrno;
+}
+
+void MulticastRoutingManager::ProcessMulticastRouteStatsDump(bool aReadable)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    bool      done  = false;
+    MfcStats  stats;
+
+    if (aReadable)
+    {
+        error = ReceiveMulticastRouteStats(done);
+    }
+
+    if (error == OTBR_ERROR_NONE && !done && Clock::now() >= mStatsDumpDeadline)
+    {
+        errno = ETIMEDOUT;
+        error = OTBR_ERROR_ERRNO;
+    }
+
+    VerifyOrExit(error != OTBR_ERROR_NONE || done);
+
+    stats.swap(mStatsDump);
+    StopMulticastRouteStatsDump();
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogRateLimited(OTBR_LOG_INFO, "%s: failed to dump multicast route stats: %s, fall back to ioctl",
+                           __FUNCTION__, strerror(errno));
+    }
+
+    ExpireIdleMulticastForwardingCache(error == OTBR_ERROR_NONE ? &stats : nullptr);
+
+exit:
+    return;
+}
+
+otbrError MulticastRoutingManager::ReceiveMulticastRouteStats(bool &aDone)
+{
+    const size_t kMaxNetlinkBufSize = 8192;
+    otbrError    error              = OTBR_ERROR_NONE;
+    union
+    {
+        nlmsghdr mHeader;
+        uint8_t  mBuffer[kMaxNetlinkBufSize];
+    } msgBuffer;
+
+    // Reads the parts of the dump received so far, the rest is read in the following mainloop iterations.
+    while (!aDone)
+    {
+        ssize_t len = recv(mStatsDumpSock, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), 0);
+
+        if (len < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            break;
+        }
+
+        for (nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+             header           = NLMSG_NEXT(header, len))
+        {
+            Ip6Address    srcAddr;
+            Ip6Address    groupAddr;
+            unsigned long validPktCnt;
+
+            if (header->nlmsg_type == NLMSG_DONE)
+            {
+                aDone = true;
+                break;
+            }
+
+            if (header->nlmsg_type == NLMSG_ERROR)
+            {
+                errno = -reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header))->error;
+                ExitNow(error = OTBR_ERROR_ERRNO);
+            }
+
+            // Only the routes in the cache are of interest.
+            if (header->nlmsg_type == RTM_NEWROUTE &&
+                ParseMulticastRouteStats(*header, srcAddr, groupAddr, validPktCnt) &&
+                mMfcIndex.count(MfcKey(groupAddr, srcAddr)) > 0)
+            {
+                mStatsDump[MfcKey(groupAddr, srcAddr)] = validPktCnt;
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
 const char *MulticastRoutingManager::MifIndexToString(MifIndex aMif)
 {
     const char *string = "Unknown";
@@ -539,19 +831,31 @@ const char *MulticastRoutingManager::MifIndexToString(MifIndex aMif)
 
 void MulticastRoutingManager::DumpMulticastForwardingCache(void) const
 {
+    // The whole dump is rate limited as a single message.
+    static LogRateLimiter sRateLimiter(__FILE__, __LINE__);
+    uint32_t              suppressed = 0;
+    bool                  allowed;
+
     VerifyOrExit(otbrLogGetLevel() == OTBR_LOG_DEBUG);
 
+    allowed = sRateLimiter.Allow(suppressed);
+    if (suppressed > 0)
+    {
+        otbrLogDebug("Suppressed %u MFC dumps", suppressed);
+    }
+    VerifyOrExit(allowed);
+
     otbrLogDebug("==================== MFC ENTRIES ====================");
 
-    for (const MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    for (const MulticastForwardingCache &mfc : mMfcList)
     {
-        if (mfc.IsValid())
-        {
-            otbrLogDebug("%s %s => %s %s", MifIndexToString(mfc.mIif), mfc.mSrcAddr.ToString().c_str(),
-                         mfc.mGroupAddr.ToString().c_str(), MifIndexToString(mfc.mOif));
-        }
+        otbrLogDebug("%s %s => %s %s", MifIndexToString(mfc.mIif), mfc.mSrcAddr.ToString().c_str(),
+                     mfc.mGroupAddr.ToString().c_str(), MifIndexToString(mfc.mOif));
     }
 
+    otbrLogDebug("%zu/%u entries, %" PRIu64 " evicted, %" PRIu64 " expired", mMfcList.size(), mMfcCapacity,
+                 mMfcCounters.mEvictions, mMfcCounters.mExpirations);
+
     otbrLogDebug("=====================================================");
 
 exit:
@@ -567,16 +871,6 @@ void MulticastRoutingManager::MulticastForwardingCache::Set(MulticastRoutingMana
     mLastUseTime = Clock::now();
 }
 
-void MulticastRoutingManager::MulticastForwardingCache::Set(const Ip6Address &aSrcAddr,
-                                                            const Ip6Address &aGroupAddr,
-                                                            MifIndex          aIif,
-                                                            MifIndex          aOif)
-{
-    mSrcAddr   = aSrcAddr;
-    mGroupAddr = aGroupAddr;
-    Set(aIif, aOif);
-}
-
 void MulticastRoutingManager::MulticastForwardingCache::SetValidPktCnt(unsigned long aValidPktCnt)
 {
     mValidPktCnt = aValidPktCnt;
@@ -588,65 +882,63 @@ void MulticastRoutingManager::SaveMulticastForwardingCache(const Ip6Address
                                                            MulticastRoutingManager::MifIndex aIif,
                                                            MulticastRoutingManager::MifIndex aOif)
 {
-    MulticastForwardingCache *invalid = nullptr;
-    MulticastForwardingCache *oldest  = nullptr;
+    MfcKey             key(aGroupAddr, aSrcAddr);
+    MfcIndex::iterator it = mMfcIndex.find(key);
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    if (it != mMfcIndex.end())
     {
-        if (mfc.IsValid())
-        {
-            if (mfc.mSrcAddr == aSrcAddr && mfc.mGroupAddr == aGroupAddr)
-            {
-                mfc.Set(aIif, aOif);
-                ExitNow();
-            }
-
-            if (oldest == nullptr || mfc.mLastUseTime < oldest->mLastUseTime)
-            {
-                oldest = &mfc;
-            }
-        }
-        else if (invalid == nullptr)
-        {
-            invalid = &mfc;
-        }
+        it->second->Set(aIif, aOif);
+        TouchMulticastForwardingCache(it->second);
+        ExitNow();
     }
 
-    if (invalid != nullptr)
+    if (mMfcList.size() >= mMfcCapacity)
     {
-        invalid->Set(aSrcAddr, aGroupAddr, aIif, aOif);
-    }
-    else
-    {
-        RemoveMulticastForwardingCache(*oldest);
-        oldest->Set(aSrcAddr, aGroupAddr, aIif, aOif);
+        RemoveMulticastForwardingCache(std::prev(mMfcList.end()));
+        mMfcCounters.mEvictions++;
     }
 
+    mMfcList.push_front(MulticastForwardingCache(aSrcAddr, aGroupAddr, aIif, aOif));
+    mMfcIndex.emplace(key, mMfcList.begin());
+    mMfcCounters.mAdditions++;
+
 exit:
     return;
 }
 
-void MulticastRoutingManager::RemoveMulticastForwardingCache(
-    MulticastRoutingManager::MulticastForwardingCache &aMfc) const
+void MulticastRoutingManager::TouchMulticastForwardingCache(MfcList::iterator aIter)
 {
-    otbrError      error;
-    struct mf6cctl mf6cctl;
+    mMfcList.splice(mMfcList.begin(), mMfcList, aIter);
+}
+
+void MulticastRoutingManager::RemoveMulticastForwardingCache(MfcList::iterator aIter)
+{
+    otbrError                       error;
+    struct mf6cctl                  mf6cctl;
+    const MulticastForwardingCache &mfc = *aIter;
 
     memset(&mf6cctl, 0, sizeof(mf6cctl));
 
-    aMfc.mSrcAddr.CopyTo(mf6cctl.mf6cc_origin.sin6_addr);
-    aMfc.mGroupAddr.CopyTo(mf6cctl.mf6cc_mcastgrp.sin6_addr);
+    mfc.mSrcAddr.CopyTo(mf6cctl.mf6cc_origin.sin6_addr);
+    mfc.mGroupAddr.CopyTo(mf6cctl.mf6cc_mcastgrp.sin6_addr);
 
-    mf6cctl.mf6cc_parent = aMfc.mIif;
+    mf6cctl.mf6cc_parent = mfc.mIif;
 
     error = (0 == setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_DEL_MFC, &mf6cctl, sizeof(mf6cctl)))
                 ? OTBR_ERROR_NONE
                 : OTBR_ERROR_ERRNO;
 
-    otbrLogResult(error, "%s: %s %s => %s %s", __FUNCTION__, MifIndexToString(aMfc.mIif),
-                  aMfc.mSrcAddr.ToString().c_str(), aMfc.mGroupAddr.ToString().c_str(), MifIndexToString(aMfc.mOif));
+    otbrLogResult(error, "%s: %s %s => %s %s", __FUNCTION__, MifIndexToString(mfc.mIif),
+                  mfc.mSrcAddr.ToString().c_str(), mfc.mGroupAddr.ToString().c_str(), MifIndexToString(mfc.mOif));
 
-    aMfc.Erase();
+    mMfcIndex.erase(MfcKey(mfc.mGroupAddr, mfc.mSrcAddr));
+    mMfcList.erase(aIter);
+}
+
+void MulticastRoutingManager::ClearMulticastForwardingCache(void)
+{
+    mMfcIndex.clear();
+    mMfcList.clear();
 }
 
 bool MulticastRoutingManager::MatchesMeshLocalPrefix(const Ip6Address        &aAddress,
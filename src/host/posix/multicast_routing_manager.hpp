@@ -31,7 +31,10 @@
 
 #include "openthread-br/config.h"
 
+#include <list>
+#include <map>
 #include <set>
+#include <utility>
 
 #include <openthread/backbone_router_ftd.h>
 #include <openthread/dataset.h>
@@ -53,12 +56,45 @@ public:
                                      const InfraIf                 &aInfraIf,
                                      const Host::NetworkProperties &aNetworkProperties);
 
+    /**
+     * This structure represents the Multicast Forwarding Cache (MFC) counters.
+     */
+    struct MfcCounters
+    {
+        uint32_t mEntries;     ///< The number of MFC entries in use.
+        uint32_t mCapacity;    ///< The max number of MFC entries.
+        uint64_t mAdditions;   ///< The number of MFC entries added.
+        uint64_t mEvictions;   ///< The number of least recently used MFC entries evicted to make room.
+        uint64_t mExpirations; ///< The number of MFC entries removed for being idle.
+    };
+
+    static constexpr uint32_t kDefaultMfcCapacity = 750; ///< The default max number of MFC entries.
+
     void Deinit(void) { FinalizeMulticastRouterSock(); }
     bool IsEnabled(void) const { return mState == kStateEnabled; }
     void HandleStateChange(otBackboneRouterState aState);
     void HandleBackboneMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
                                               const Ip6Address                      &aAddress);
 
+    /**
+     * This method sets the max number of Multicast Forwarding Cache entries.
+     *
+     * The least recently used entries are evicted if there are more entries than @p aCapacity.
+     *
+     * @param[in] aCapacity  The max number of MFC entries.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully set the capacity.
+     * @retval OTBR_ERROR_INVALID_ARGS  @p aCapacity is zero.
+     */
+    otbrError SetMfcCapacity(uint32_t aCapacity);
+
+    /**
+     * This method returns the Multicast Forwarding Cache counters.
+     *
+     * @returns The MFC counters.
+     */
+    MfcCounters GetMfcCounters(void) const;
+
 private:
     static constexpr uint32_t kUsPerSecond        = 1000000; //< Microseconds per second.
     static constexpr uint32_t kMinRetryIntervalUs = 100000;  //< Minimum retry interval (100 ms) in microseconds.
@@ -67,9 +103,7 @@ private:
         300; //< Expire timeout of Multicast Forwarding Cache (in seconds)
     static constexpr uint32_t kMulticastForwardingCacheExpiringInterval =
         60; //< Expire interval of Multicast Forwarding Cache (in seconds)
-    static constexpr uint32_t kMulticastMaxListeners = 75; //< The max number of Multicast listeners
-    static constexpr uint32_t kMulticastForwardingCacheTableSize =
-        kMulticastMaxListeners * 10; //< The max size of MFC table.
+    static constexpr uint32_t kNetlinkDumpTimeout = 500; //< Max time (in milliseconds) to receive the MFC stats dump.
 
     enum State : uint8_t
     {
@@ -90,15 +124,14 @@ private:
         friend class MulticastRoutingManager;
 
     private:
-        MulticastForwardingCache()
-            : mIif(kMifIndexNone)
+        MulticastForwardingCache(const Ip6Address &aSrcAddr, const Ip6Address &aGroupAddr, MifIndex aIif, MifIndex aOif)
+            : mSrcAddr(aSrcAddr)
+            , mGroupAddr(aGroupAddr)
         {
+            Set(aIif, aOif);
         }
 
-        bool IsValid() const { return mIif != kMifIndexNone; }
         void Set(MifIndex aIif, MifIndex aOif);
-        void Set(const Ip6Address &aSrcAddr, const Ip6Address &aGroupAddr, MifIndex aIif, MifIndex aOif);
-        void Erase(void) { mIif = kMifIndexNone; }
         void SetValidPktCnt(unsigned long aValidPktCnt);
 
         Ip6Address    mSrcAddr;
@@ -109,8 +142,18 @@ private:
         MifIndex      mOif;
     };
 
-    void Update(MainloopContext &aContext) override;
-    void Process(const MainloopContext &aContext) override;
+    // The MFC entries are kept from the most to the least recently used, and indexed by (group, source) so that
+    // the entries of a group are adjacent in the index. The incoming interface isn't part of the key since the
+    // kernel keeps a single MFC entry per (source, group) as well: `MRT6_ADD_MFC` replaces the incoming interface
+    // of an existing entry instead of adding another one.
+    using MfcList  = std::list<MulticastForwardingCache>;
+    using MfcKey   = std::pair<Ip6Address, Ip6Address>;
+    using MfcIndex = std::map<MfcKey, MfcList::iterator>;
+    using MfcStats = std::map<MfcKey, unsigned long>; // The valid packet counts of the dumped multicast routes.
+
+    void        Update(MainloopContext &aContext) override;
+    void        Process(const MainloopContext &aContext) override;
+    const char *GetName(void) const override { return "MulticastRoutingManager"; }
 
     void      Enable(void);
     void      Disable(void);
@@ -129,8 +172,16 @@ private:
     void      UnblockInboundMulticastForwardingCache(const Ip6Address &aGroupAddr);
     void      RemoveInboundMulticastForwardingCache(const Ip6Address &aGroupAddr);
     void      ExpireMulticastForwardingCache(void);
+    void      ExpireIdleMulticastForwardingCache(const MfcStats *aStats);
     bool      UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc) const;
-    void      RemoveMulticastForwardingCache(MulticastForwardingCache &aMfc) const;
+    bool      UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc, const MfcStats &aStats) const;
+    otbrError StartMulticastRouteStatsDump(void);
+    void      StopMulticastRouteStatsDump(void);
+    void      ProcessMulticastRouteStatsDump(bool aReadable);
+    otbrError ReceiveMulticastRouteStats(bool &aDone);
+    void      TouchMulticastForwardingCache(MfcList::iterator aIter);
+    void      RemoveMulticastForwardingCache(MfcList::iterator aIter);
+    void      ClearMulticastForwardingCache(void);
     static const char *MifIndexToString(MifIndex aMif);
     void               DumpMulticastForwardingCache(void) const;
 
@@ -139,9 +190,15 @@ private:
     const Netif                   &mNetif;
     const InfraIf                 &mInfraIf;
     const Host::NetworkProperties &mNetworkProperties;
-    MulticastForwardingCache       mMulticastForwardingCacheTable[kMulticastForwardingCacheTableSize];
+    MfcList                        mMfcList;
+    MfcIndex                       mMfcIndex;
+    uint32_t                       mMfcCapacity;
+    MfcCounters                    mMfcCounters;
     otbr::Timepoint                mLastExpireTime;
     int                            mMulticastRouterSock;
+    int                            mStatsDumpSock; ///< The netlink socket of the ongoing MFC stats dump.
+    MfcStats                       mStatsDump;     ///< The stats received so far by the ongoing dump.
+    otbr::Timepoint                mStatsDumpDeadline;
     std::set<Ip6Address>           mMulticastListeners;
     State                          mState;
     uint32_t                       mRetryIntervalUs;
@@ -39,6 +39,10 @@
 #include <netinet/in.h>
 #include <stdio.h>
 #include <string.h>
+#include <poll.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -51,12 +55,20 @@
 #endif
 
 #include "common/code_utils.hpp"
+#include "common/log_rate_limiter.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
 #include "utils/socket_utils.hpp"
 
 namespace otbr {
 
+constexpr size_t   Netif::kDefaultIp6SendBatchSize;
+constexpr size_t   Netif::kMaxIp6SendBatchSize;
+constexpr uint16_t Netif::kIp6SendHeadroom;
+constexpr size_t   Netif::kIp6ReceivePoolSize;
+constexpr int      Netif::kDatapathRetryInterval;
+constexpr uint8_t  Netif::kNumLatencyBuckets;
+
 otbrError Netif::Dependencies::Ip6Send(const uint8_t *aData, uint16_t aLength)
 {
     OTBR_UNUSED_VARIABLE(aData);
@@ -65,6 +77,19 @@ otbrError Netif::Dependencies::Ip6Send(const uint8_t *aData, uint16_t aLength)
     return OTBR_ERROR_NONE;
 }
 
+otbrError Netif::Dependencies::Ip6SendBatch(PacketBuffer *aPackets, size_t aCount, size_t &aSentCount)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    for (aSentCount = 0; aSentCount < aCount; aSentCount++)
+    {
+        SuccessOrExit(error = Ip6Send(aPackets[aSentCount].GetData(), aPackets[aSentCount].GetLength()));
+    }
+
+exit:
+    return error;
+}
+
 otbrError Netif::Dependencies::Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdd)
 {
     OTBR_UNUSED_VARIABLE(aAddress);
@@ -110,6 +135,25 @@ enum
     kIcmpv6Mldv2RecordChangeToExcludeType = 4,
 };
 
+static void SignalEventFd(int aFd)
+{
+    static const uint64_t kOne = 1;
+
+    // The counter only overflows after 2^64 - 1 pending signals, EAGAIN can be ignored.
+    while (write(aFd, &kOne, sizeof(kOne)) == -1 && errno == EINTR)
+    {
+    }
+}
+
+static void DrainEventFd(int aFd)
+{
+    uint64_t counter;
+
+    while (read(aFd, &counter, sizeof(counter)) == -1 && errno == EINTR)
+    {
+    }
+}
+
 Netif::Netif(const std::string &aInterfaceName, Dependencies &aDependencies)
     : mTunFd(-1)
     , mIpFd(-1)
@@ -119,7 +163,46 @@ Netif::Netif(const std::string &aInterfaceName, Dependencies &aDependencies)
     , mNetifIndex(0)
     , mNetifName(aInterfaceName)
     , mDeps(aDependencies)
+    , mIp6SendPool(kIp6SendPoolSize, kIp6Mtu, kIp6SendHeadroom)
+    , mDatapathThreadEnabled(false)
+    , mDatapathEventFd(-1)
+    , mDatapathWakeupFd(-1)
+    , mDatapathStopping(false)
+    , mDatapathThrottled(false)
+    , mDatapathError(nullptr)
+    , mIp6ReceivePool(kIp6ReceivePoolSize, kIp6Mtu, 0)
+    , mOversizeDrops(0)
+    , mTunWriteDrops(0)
+    , mNoBufferDrops(0)
+    , mSendDrops(0)
+    , mRaIntercepted(0)
+    , mThrottles(0)
+{
+    memset(&mIp6SendBatchCounters, 0, sizeof(mIp6SendBatchCounters));
+    ResetCounters(mToThreadCounters);
+    ResetCounters(mFromThreadCounters);
+    SetIp6SendBatchSize(kDefaultIp6SendBatchSize);
+}
+
+void Netif::SetIp6SendBatchSize(size_t aBatchSize)
 {
+    mIp6SendBatchSize = std::min(std::max(aBatchSize, static_cast<size_t>(1)), kMaxIp6SendBatchSize);
+    mIp6SendBatch.reserve(mIp6SendBatchSize);
+}
+
+void Netif::SetDatapathThreadEnabled(bool aEnabled)
+{
+    assert(mTunFd == -1);
+
+#ifdef __linux__
+    mDatapathThreadEnabled = aEnabled;
+#else
+    // The datapath thread relies on the eventfd of Linux.
+    if (aEnabled)
+    {
+        otbrLogWarning("The datapath thread is only supported on Linux");
+    }
+#endif
 }
 
 otbrError Netif::Init(void)
@@ -139,6 +222,11 @@ otbrError Netif::Init(void)
 
     PlatformSpecificInit();
 
+    if (mDatapathThreadEnabled)
+    {
+        SuccessOrExit(error = StartDatapath());
+    }
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -154,39 +242,47 @@ void Netif::Deinit(void)
 
 void Netif::UpdateIp6UnicastAddresses(const std::vector<Ip6AddressInfo> &aAddrInfos)
 {
+    Ip6AddressInfoSet                 addrInfos(aAddrInfos.begin(), aAddrInfos.end());
+    std::vector<UnicastAddressChange> changes;
+
     // Remove stale addresses
     for (const Ip6AddressInfo &addrInfo : mIp6UnicastAddresses)
     {
-        if (std::find(aAddrInfos.begin(), aAddrInfos.end(), addrInfo) == aAddrInfos.end())
+        if (addrInfos.count(addrInfo) == 0)
         {
             otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, false);
+            changes.push_back({addrInfo, /* mIsAdded */ false});
         }
     }
 
     // Add new addresses
-    for (const Ip6AddressInfo &addrInfo : aAddrInfos)
+    for (const Ip6AddressInfo &addrInfo : addrInfos)
     {
-        if (std::find(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), addrInfo) == mIp6UnicastAddresses.end())
+        if (mIp6UnicastAddresses.count(addrInfo) == 0)
         {
             otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, true);
+            changes.push_back({addrInfo, /* mIsAdded */ true});
         }
     }
 
-    mIp6UnicastAddresses.assign(aAddrInfos.begin(), aAddrInfos.end());
+    mIp6UnicastAddresses = std::move(addrInfos);
+
+    if (!changes.empty())
+    {
+        // Addresses which fail to be added are dropped from `mIp6UnicastAddresses` so the next update retries them.
+        ProcessUnicastAddressChanges(changes);
+    }
 }
 
 otbrError Netif::UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAddrs)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError     error = OTBR_ERROR_NONE;
+    Ip6AddressSet addrs(aAddrs.begin(), aAddrs.end());
 
     // Remove stale addresses
     for (const Ip6Address &address : mIp6MulticastAddresses)
     {
-        if (std::find(aAddrs.begin(), aAddrs.end(), address) == aAddrs.end())
+        if (addrs.count(address) == 0)
         {
             otbrLogInfo("Remove address: %s", Ip6Address(address).ToString().c_str());
             SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
@@ -194,17 +290,16 @@ otbrError Netif::UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAdd
     }
 
     // Add new addresses
-    for (const Ip6Address &address : aAddrs)
+    for (const Ip6Address &address : addrs)
     {
-        if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), address) ==
-            mIp6MulticastAddresses.end())
+        if (mIp6MulticastAddresses.count(address) == 0)
         {
             otbrLogInfo("Add address: %s", Ip6Address(address).ToString().c_str());
             SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
         }
     }
 
-    mIp6MulticastAddresses.assign(aAddrs.begin(), aAddrs.end());
+    mIp6MulticastAddresses = std::move(addrs);
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -269,45 +364,363 @@ exit:
 
 void Netif::Ip6Receive(const uint8_t *aBuf, uint16_t aLen)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError    error = OTBR_ERROR_NONE;
+    Timepoint    now   = Clock::now();
+    PacketBuffer packet;
 
-    VerifyOrExit(aLen <= kIp6Mtu, error = OTBR_ERROR_DROPPED);
+    VerifyOrExit(aLen <= kIp6Mtu, mOversizeDrops++, error = OTBR_ERROR_DROPPED);
     VerifyOrExit(mTunFd > 0, error = OTBR_ERROR_INVALID_STATE);
 
-    otbrLogInfo("Packet from NCP (%u bytes)", aLen);
-    VerifyOrExit(write(mTunFd, aBuf, aLen) == aLen, error = OTBR_ERROR_ERRNO);
+    otbrLogRateLimited(OTBR_LOG_INFO, "Packet from NCP (%u bytes)", aLen);
+
+    if (!mDatapathThreadEnabled)
+    {
+        WriteIp6Packet(aBuf, aLen, now);
+        ExitNow();
+    }
+
+    // The datapath thread owns the TUN, hand the packet over instead of blocking the mainloop.
+    packet = mIp6ReceivePool.Allocate();
+    VerifyOrExit(!packet.IsNull(), mNoBufferDrops++, error = OTBR_ERROR_DROPPED);
+    memcpy(packet.GetData(), aBuf, aLen);
+    packet.SetLength(aLen);
+    packet.SetTimestamp(now);
+    mIp6ReceiveQueue.Push(std::move(packet));
+    SignalEventFd(mDatapathWakeupFd);
 
 exit:
     if (error != OTBR_ERROR_NONE)
     {
-        otbrLogWarning("Failed to receive, error:%s", otbrErrorString(error));
+        otbrLogRateLimited(OTBR_LOG_WARNING, "Failed to receive, error:%s", otbrErrorString(error));
     }
 }
 
 void Netif::ProcessIp6Send(void)
 {
-    ssize_t   rval;
-    uint8_t   packet[kIp6Mtu];
-    otbrError error = OTBR_ERROR_NONE;
+    SendIp6Batch(ReadIp6Packets(mTunFd, mIp6SendBatchSize, mIp6SendBatch));
+}
+
+size_t Netif::ReadIp6Packets(int aFd, size_t aMaxPackets, std::vector<PacketBuffer> &aPackets)
+{
+    size_t numReads = 0;
+
+    // Drains the TUN queue until EAGAIN or the budget is used up, the remaining packets keep the fd
+    // readable so that they are read in the next iteration.
+    while (numReads < aMaxPackets)
+    {
+        PacketBuffer packet = mIp6SendPool.Allocate();
+        ssize_t      rval;
+
+        if (packet.IsNull())
+        {
+            // The dependencies still hold the buffers of previous batches, leave the packets in the TUN.
+            otbrLogRateLimited(OTBR_LOG_WARNING, "No buffer to read from Tun Fd");
+            break;
+        }
+
+        rval = read(aFd, packet.GetData(), kIp6Mtu);
+
+        if (rval <= 0)
+        {
+            if (rval < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogRateLimited(OTBR_LOG_INFO, "Error reading from Tun Fd: %s", strerror(errno));
+            }
+            break;
+        }
+
+        numReads++;
+        packet.SetLength(static_cast<uint16_t>(rval));
+        packet.SetTimestamp(Clock::now());
+        aPackets.push_back(std::move(packet));
+    }
 
-    rval = read(mTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
+    return numReads;
+}
+
+void Netif::SendIp6Batch(size_t aNumReads)
+{
+    size_t    numSent   = 0;
+    size_t    sentCount = 0;
+    size_t    numBytes  = 0;
+    otbrError error     = OTBR_ERROR_NONE;
 
 #if OTBR_ENABLE_DHCP6_PD && OTBR_ENABLE_BORDER_ROUTING
-    // Try to process as RA message for DHCP6 PD prefix processing
-    if (TryProcessIcmp6RaMessage(packet, static_cast<uint16_t>(rval)) == OTBR_ERROR_NONE)
     {
-        ExitNow();
+        size_t numPackets = mIp6SendBatch.size();
+
+        // Try to process as RA message for DHCP6 PD prefix processing
+        mIp6SendBatch.erase(std::remove_if(mIp6SendBatch.begin(), mIp6SendBatch.end(),
+                                           [this](const PacketBuffer &aPacket) {
+                                               return TryProcessIcmp6RaMessage(aPacket.GetData(),
+                                                                               aPacket.GetLength()) == OTBR_ERROR_NONE;
+                                           }),
+                            mIp6SendBatch.end());
+        mRaIntercepted += numPackets - mIp6SendBatch.size();
     }
 #endif
 
-    otbrLogInfo("Send packet (%hu bytes)", static_cast<uint16_t>(rval));
+    VerifyOrExit(!mIp6SendBatch.empty());
+
+    numSent = mIp6SendBatch.size();
+    for (const PacketBuffer &packet : mIp6SendBatch)
+    {
+        numBytes += packet.GetLength();
+    }
+    otbrLogRateLimited(OTBR_LOG_INFO, "Send %zu packets (%zu bytes)", numSent, numBytes);
+
+    error = mDeps.Ip6SendBatch(mIp6SendBatch.data(), numSent, sentCount);
+
+    // Packets not taken by the dependencies are counted as send drops rather than forwarded.
+    for (size_t i = 0; i < sentCount && i < numSent; i++)
+    {
+        RecordForwarded(mToThreadCounters, mIp6SendBatch[i].GetLength(), mIp6SendBatch[i].GetTimestamp());
+    }
+
+    mIp6SendBatchCounters.mBatches++;
+    mIp6SendBatchCounters.mPackets += numSent;
+    mIp6SendBatchCounters.mSendFailures += numSent - sentCount;
+    mSendDrops += numSent - sentCount;
+    mIp6SendBatchCounters.mMaxBatchSize = std::max(mIp6SendBatchCounters.mMaxBatchSize, static_cast<uint32_t>(numSent));
 
-    error = mDeps.Ip6Send(packet, rval);
 exit:
-    if (error == OTBR_ERROR_ERRNO)
+    // Releases the references of the Netif, the buffers return to the pool unless the dependencies keep them.
+    mIp6SendBatch.clear();
+
+    if (aNumReads == mIp6SendBatchSize)
+    {
+        mIp6SendBatchCounters.mFullBatches++;
+    }
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogRateLimited(OTBR_LOG_WARNING, "Failed to send %zu of %zu packets: %s", numSent - sentCount, numSent,
+                           otbrErrorString(error));
+    }
+}
+
+void Netif::WriteIp6Packet(const uint8_t *aBuf, uint16_t aLen, Timepoint aQueuedTime)
+{
+    if (write(mTunFd, aBuf, aLen) != aLen)
+    {
+        mTunWriteDrops++;
+        otbrLogRateLimited(OTBR_LOG_WARNING, "Failed to write to Tun Fd: %s", strerror(errno));
+    }
+    else
     {
-        otbrLogInfo("Error reading from Tun Fd: %s", strerror(errno));
+        RecordForwarded(mFromThreadCounters, aLen, aQueuedTime);
+    }
+}
+
+Netif::Counters Netif::GetCounters(void) const
+{
+    Counters counters;
+
+    ReadCounters(mToThreadCounters, counters.mToThread);
+    ReadCounters(mFromThreadCounters, counters.mFromThread);
+    counters.mOversizeDrops = mOversizeDrops.load(std::memory_order_relaxed);
+    counters.mTunWriteDrops = mTunWriteDrops.load(std::memory_order_relaxed);
+    counters.mNoBufferDrops = mNoBufferDrops.load(std::memory_order_relaxed);
+    counters.mSendDrops     = mSendDrops.load(std::memory_order_relaxed);
+    counters.mRaIntercepted = mRaIntercepted.load(std::memory_order_relaxed);
+    counters.mThrottles     = mThrottles.load(std::memory_order_relaxed);
+
+    return counters;
+}
+
+void Netif::ResetCounters(AtomicDirectionCounters &aCounters)
+{
+    aCounters.mPackets.store(0);
+    aCounters.mBytes.store(0);
+    for (std::atomic<uint32_t> &bucket : aCounters.mLatencyHistogram)
+    {
+        bucket.store(0);
+    }
+}
+
+void Netif::RecordForwarded(AtomicDirectionCounters &aCounters, uint16_t aLength, Timepoint aQueuedTime)
+{
+    uint64_t latencyUs = std::chrono::duration_cast<Microseconds>(Clock::now() - aQueuedTime).count();
+
+    aCounters.mPackets.fetch_add(1, std::memory_order_relaxed);
+    aCounters.mBytes.fetch_add(aLength, std::memory_order_relaxed);
+    aCounters.mLatencyHistogram[GetLatencyBucket(latencyUs)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void Netif::ReadCounters(const AtomicDirectionCounters &aCounters, DirectionCounters &aSnapshot)
+{
+    aSnapshot.mPackets = aCounters.mPackets.load(std::memory_order_relaxed);
+    aSnapshot.mBytes   = aCounters.mBytes.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < kNumLatencyBuckets; i++)
+    {
+        aSnapshot.mLatencyHistogram[i] = aCounters.mLatencyHistogram[i].load(std::memory_order_relaxed);
+    }
+}
+
+uint8_t Netif::GetLatencyBucket(uint64_t aLatencyUs)
+{
+    uint8_t bucket = 0;
+
+    while (aLatencyUs != 0 && bucket < kNumLatencyBuckets - 1)
+    {
+        aLatencyUs >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+otbrError Netif::StartDatapath(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+#ifdef __linux__
+    mDatapathEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrExit(mDatapathEventFd != -1, error = OTBR_ERROR_ERRNO);
+    mDatapathWakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrExit(mDatapathWakeupFd != -1, error = OTBR_ERROR_ERRNO);
+#else
+    ExitNow(error = OTBR_ERROR_NOT_IMPLEMENTED);
+#endif
+
+    mDatapathStopping.store(false);
+    mDatapathThrottled.store(false);
+    mDatapathError.store(nullptr);
+    mDatapathThread = std::thread(&Netif::RunDatapath, this);
+    otbrLogInfo("Datapath thread started");
+
+exit:
+    return error;
+}
+
+void Netif::StopDatapath(void)
+{
+    PacketBuffer packet;
+
+    if (mDatapathThread.joinable())
+    {
+        mDatapathStopping.store(true);
+        SignalEventFd(mDatapathWakeupFd);
+        mDatapathThread.join();
+    }
+
+    if (mDatapathEventFd != -1)
+    {
+        close(mDatapathEventFd);
+        mDatapathEventFd = -1;
+    }
+
+    if (mDatapathWakeupFd != -1)
+    {
+        close(mDatapathWakeupFd);
+        mDatapathWakeupFd = -1;
+    }
+
+    while (mIp6SendQueue.Pop(packet) || mIp6ReceiveQueue.Pop(packet))
+    {
+    }
+}
+
+void Netif::ProcessDatapathEvent(void)
+{
+    PacketBuffer packet;
+
+    DrainEventFd(mDatapathEventFd);
+
+    while (mIp6SendBatch.size() < mIp6SendBatchSize && mIp6SendQueue.Pop(packet))
+    {
+        mIp6SendBatch.push_back(std::move(packet));
+    }
+
+    if (mIp6SendBatch.size() == mIp6SendBatchSize)
+    {
+        // More packets may be queued, come back in the next mainloop iteration so other processors can run.
+        SignalEventFd(mDatapathEventFd);
+    }
+
+    SendIp6Batch(mIp6SendBatch.size());
+
+    // The sent packets may have returned their buffers to the pool, resume reading the TUN.
+    if (mDatapathThrottled.exchange(false))
+    {
+        SignalEventFd(mDatapathWakeupFd);
+    }
+}
+
+void Netif::RunDatapath(void)
+{
+    pollfd                    fds[2];
+    std::vector<PacketBuffer> packets;
+    PacketBuffer              packet;
+    int                       timeout = -1;
+    const char               *error   = nullptr;
+
+    fds[0] = {mDatapathWakeupFd, POLLIN, 0};
+    fds[1] = {mTunFd, POLLIN, 0};
+
+    while (!mDatapathStopping.load())
+    {
+        bool throttled;
+
+        if (poll(fds, 2, timeout) < 0)
+        {
+            VerifyOrExit(errno == EINTR, otbrLogCrit("Failed to poll Tun Fd: %s", strerror(errno)),
+                         error = "Failed to poll Tun Fd!");
+            continue;
+        }
+
+        if (fds[0].revents & POLLIN)
+        {
+            DrainEventFd(mDatapathWakeupFd);
+        }
+
+        while (mIp6ReceiveQueue.Pop(packet))
+        {
+            WriteIp6Packet(packet.GetData(), packet.GetLength(), packet.GetTimestamp());
+            packet.Reset();
+        }
+
+        VerifyOrExit((fds[1].revents & (POLLERR | POLLNVAL)) == 0, error = "Error on Tun Fd!");
+        if (fds[1].revents & POLLIN)
+        {
+            ReadIp6Packets(mTunFd, kMaxIp6SendBatchSize, packets);
+        }
+
+        if (!packets.empty())
+        {
+            for (PacketBuffer &readPacket : packets)
+            {
+                mIp6SendQueue.Push(std::move(readPacket));
+            }
+            packets.clear();
+            SignalEventFd(mDatapathEventFd);
+        }
+
+        // The readable TUN would wake up the poll immediately while there is no buffer to read it,
+        // so it is left out until the mainloop signals that buffers are freed. The pool is checked
+        // again after publishing the flag so that buffers freed in between aren't missed. The retry
+        // interval covers buffers freed by the dependencies outside of the mainloop sending.
+        throttled = IsIp6SendPoolExhausted();
+        if (throttled)
+        {
+            mDatapathThrottled.store(true);
+            throttled = IsIp6SendPoolExhausted();
+        }
+
+        if (throttled && timeout < 0)
+        {
+            mThrottles.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        fds[1].events = throttled ? 0 : POLLIN;
+        timeout = throttled ? kDatapathRetryInterval : -1;
+    }
+
+exit:
+    if (error != nullptr)
+    {
+        // The failure is handled on the mainloop, as when the TUN is serviced there.
+        mDatapathError.store(error);
+        SignalEventFd(mDatapathEventFd);
     }
 }
 
@@ -420,6 +833,8 @@ exit:
 
 void Netif::Clear(void)
 {
+    StopDatapath();
+
     if (mTunFd != -1)
     {
         close(mTunFd);
@@ -447,6 +862,9 @@ void Netif::Clear(void)
     mNetifIndex = 0;
     mIp6UnicastAddresses.clear();
     mIp6MulticastAddresses.clear();
+#ifdef __linux__
+    mPendingAddressChanges.clear();
+#endif
 }
 
 static const otIp6Address kMldv2MulticastAddress = {
@@ -552,8 +970,7 @@ void Netif::ProcessMldEvent(void)
             case kIcmpv6Mldv2RecordChangeToIncludeType:
                 if (record->mNumSources == 0)
                 {
-                    if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), Ip6Address(address)) !=
-                        mIp6MulticastAddresses.end())
+                    if (mIp6MulticastAddresses.count(Ip6Address(address)) != 0)
                     {
                         error = mDeps.Ip6MulAddrUpdateSubscription(address, /* isAdd */ false);
                     }
@@ -564,8 +981,7 @@ void Netif::ProcessMldEvent(void)
                 }
                 break;
             case kIcmpv6Mldv2RecordChangeToExcludeType:
-                if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), Ip6Address(address)) ==
-                    mIp6MulticastAddresses.end())
+                if (mIp6MulticastAddresses.count(Ip6Address(address)) == 0)
                 {
                     error = mDeps.Ip6MulAddrUpdateSubscription(address, /* isAdd */ true);
                 }
@@ -598,25 +1014,45 @@ void Netif::Update(MainloopContext &aContext)
     assert(mIpFd >= 0);
     assert(mMldFd >= 0);
 
-    aContext.AddFdToSet(mTunFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+    if (mDatapathThreadEnabled)
+    {
+        aContext.AddFdToSet(mDatapathEventFd, MainloopContext::kReadFdSet);
+    }
+    else
+    {
+        aContext.AddFdToSet(mTunFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+    }
     aContext.AddFdToSet(mMldFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+    UpdateNetlink(aContext);
 }
 
 void Netif::Process(const MainloopContext &aContext)
 {
-    if (FD_ISSET(mTunFd, &aContext.mErrorFdSet))
+    if (!mDatapathThreadEnabled && FD_ISSET(mTunFd, &aContext.mErrorFdSet))
     {
         close(mTunFd);
         DieNow("Error on Tun Fd!");
     }
 
+    if (mDatapathThreadEnabled && mDatapathError.load() != nullptr)
+    {
+        DieNow(mDatapathError.load());
+    }
+
     if (FD_ISSET(mMldFd, &aContext.mErrorFdSet))
     {
         close(mMldFd);
         DieNow("Error on MLD Fd!");
     }
 
-    if (FD_ISSET(mTunFd, &aContext.mReadFdSet))
+    if (mDatapathThreadEnabled)
+    {
+        if (FD_ISSET(mDatapathEventFd, &aContext.mReadFdSet))
+        {
+            ProcessDatapathEvent();
+        }
+    }
+    else if (FD_ISSET(mTunFd, &aContext.mReadFdSet))
     {
         ProcessIp6Send();
     }
@@ -625,6 +1061,8 @@ void Netif::Process(const MainloopContext &aContext)
     {
         ProcessMldEvent();
     }
+
+    ProcessNetlink(aContext);
 }
 
 } // namespace otbr
@@ -36,7 +36,12 @@
 
 #include <net/if.h>
 
+#include <array>
+#include <atomic>
 #include <functional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #if OTBR_ENABLE_DHCP6_PD && OTBR_ENABLE_BORDER_ROUTING
@@ -46,6 +51,9 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/mpsc_queue.hpp"
+#include "common/packet_buffer.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
@@ -53,12 +61,83 @@ namespace otbr {
 class Netif : public MainloopProcessor, private NonCopyable
 {
 public:
+    static constexpr size_t   kDefaultIp6SendBatchSize = 16; ///< Default max packets read from the TUN per wakeup.
+    static constexpr size_t   kMaxIp6SendBatchSize     = 64; ///< Max value of the TUN read budget.
+    static constexpr uint16_t kIp6SendHeadroom         = 16; ///< Bytes reserved in front of each packet read.
+
+    /**
+     * This structure represents the counters of the batched TUN reads.
+     */
+    struct Ip6SendBatchCounters
+    {
+        uint64_t mBatches;      ///< The number of wakeups which read at least one packet.
+        uint64_t mPackets;      ///< The number of packets forwarded to `Dependencies::Ip6SendBatch()`.
+        uint64_t mFullBatches;  ///< The number of wakeups which stopped at the budget before draining the TUN.
+        uint64_t mSendFailures; ///< The number of packets which failed to be sent.
+        uint32_t mMaxBatchSize; ///< The largest number of packets forwarded at once.
+    };
+
+    /**
+     * The number of buckets of the queueing latency histograms.
+     *
+     * Bucket 0 counts packets queued shorter than 1 us, bucket i (0 < i < kNumLatencyBuckets - 1) counts packets
+     * queued in [2^(i-1), 2^i) us, and the last bucket counts packets queued 2^(kNumLatencyBuckets - 2) us (~262 ms)
+     * or longer.
+     */
+    static constexpr uint8_t kNumLatencyBuckets = 20;
+
+    /**
+     * This structure represents the counters of one forwarding direction.
+     */
+    struct DirectionCounters
+    {
+        uint64_t                                 mPackets;          ///< The number of packets forwarded.
+        uint64_t                                 mBytes;            ///< The number of bytes forwarded.
+        std::array<uint32_t, kNumLatencyBuckets> mLatencyHistogram; ///< The queueing latency histogram.
+    };
+
+    /**
+     * This structure represents the packet counters of the Thread network interface.
+     *
+     * The latency of a packet to the Thread network is measured from the TUN read to the handoff to
+     * `Dependencies::Ip6SendBatch()`, the latency of a packet from the Thread network from `Ip6Receive()` to
+     * the completion of the TUN write.
+     */
+    struct Counters
+    {
+        DirectionCounters mToThread;      ///< Packets read from the TUN and sent to the Thread network.
+        DirectionCounters mFromThread;    ///< Packets received from the Thread network and written to the TUN.
+        uint64_t          mOversizeDrops; ///< Packets from the Thread network larger than the MTU.
+        uint64_t          mTunWriteDrops; ///< Packets from the Thread network which failed to be written.
+        uint64_t          mNoBufferDrops; ///< Packets from the Thread network dropped for lack of buffers.
+        uint64_t          mSendDrops;     ///< Packets to the Thread network which failed to be sent.
+        uint64_t          mRaIntercepted; ///< RAs read from the TUN consumed for DHCPv6 PD instead of sent.
+        uint64_t          mThrottles;     ///< Times the datapath thread stopped reading the TUN for lack of buffers.
+    };
+
     class Dependencies
     {
     public:
         virtual ~Dependencies(void) = default;
 
         virtual otbrError Ip6Send(const uint8_t *aData, uint16_t aLength);
+
+        /**
+         * This method sends a batch of IPv6 packets read from the TUN device in one wakeup.
+         *
+         * The default implementation sends the packets one by one with `Ip6Send()` and stops at the
+         * first failure. Each packet has `kIp6SendHeadroom` bytes in front of its data, so that an
+         * implementation may prepend its framing in place. An implementation may keep a reference to a
+         * packet beyond the call, the buffer returns to the pool of the Netif when the last reference
+         * is released.
+         *
+         * @param[in]  aPackets    A pointer to the packets.
+         * @param[in]  aCount      The number of packets.
+         * @param[out] aSentCount  The number of packets sent.
+         *
+         * @returns The error of the first packet which failed to be sent, or OTBR_ERROR_NONE.
+         */
+        virtual otbrError Ip6SendBatch(PacketBuffer *aPackets, size_t aCount, size_t &aSentCount);
         virtual otbrError Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded);
 #if OTBR_ENABLE_DHCP6_PD && OTBR_ENABLE_BORDER_ROUTING
         virtual otbrError BorderRoutingProcessDhcp6PdPrefix(const otBorderRoutingPrefixTableEntry *aPrefixInfo);
@@ -78,28 +157,131 @@ public:
 
     unsigned int GetIfIndex(void) const { return mNetifIndex; }
 
+    /**
+     * This method sets the maximum number of packets read from the TUN device per mainloop wakeup.
+     *
+     * A larger budget amortizes the mainloop round trip over bursts of outgoing packets, a smaller one
+     * bounds the time spent before other processors run. The TUN device is drained until EAGAIN when
+     * there are fewer pending packets.
+     *
+     * @param[in] aBatchSize  The budget, clamped to [1, kMaxIp6SendBatchSize].
+     */
+    void SetIp6SendBatchSize(size_t aBatchSize);
+
+    /**
+     * This method returns the counters of the batched TUN reads.
+     *
+     * @returns The counters of the batched TUN reads.
+     */
+    const Ip6SendBatchCounters &GetIp6SendBatchCounters(void) const { return mIp6SendBatchCounters; }
+
+    /**
+     * This method returns the counters of the buffer pool used to read packets from the TUN device.
+     *
+     * @returns The counters of the buffer pool.
+     */
+    PacketBufferPool::Counters GetIp6SendPoolCounters(void) const { return mIp6SendPool.GetCounters(); }
+
+    /**
+     * This method returns the counters of the buffer pool used to queue packets to the datapath thread.
+     *
+     * @returns The counters of the buffer pool.
+     */
+    PacketBufferPool::Counters GetIp6ReceivePoolCounters(void) const { return mIp6ReceivePool.GetCounters(); }
+
+    /**
+     * This method enables or disables the datapath thread, it must be called before `Init()`.
+     *
+     * When enabled, the TUN device is serviced by a dedicated thread, so that the packet I/O isn't delayed by
+     * the other mainloop processors. Packets read from the TUN are handed to the mainloop through a lock-free
+     * queue and sent with `Dependencies::Ip6SendBatch()` there, packets passed to `Ip6Receive()` are queued to
+     * the datapath thread and written to the TUN by it. The datapath thread is only supported on Linux.
+     *
+     * @param[in] aEnabled  TRUE to enable the datapath thread, FALSE to service the TUN in the mainloop.
+     */
+    void SetDatapathThreadEnabled(bool aEnabled);
+
+    /**
+     * This method indicates whether the datapath thread is enabled.
+     *
+     * @retval TRUE   The datapath thread is enabled.
+     * @retval FALSE  The TUN is serviced in the mainloop.
+     */
+    bool IsDatapathThreadEnabled(void) const { return mDatapathThreadEnabled; }
+
+    /**
+     * This method returns a snapshot of the packet counters.
+     *
+     * It is safe to call this method while the datapath thread is running.
+     *
+     * @returns The packet counters.
+     */
+    Counters GetCounters(void) const;
+
 private:
     // TODO: Retrieve the Maximum Ip6 size from the coprocessor.
     static constexpr size_t kIp6Mtu = 1280;
 
+    // Leaves room for the dependencies to hold a full batch while the next one is read.
+    static constexpr size_t kIp6SendPoolSize = 2 * kMaxIp6SendBatchSize;
+
+    static constexpr size_t kIp6ReceivePoolSize    = kMaxIp6SendBatchSize; ///< Packets queued to the datapath thread.
+    static constexpr int    kDatapathRetryInterval = 10;                   ///< Poll interval (ms) if out of buffers.
+
     void Clear(void);
 
     otbrError CreateTunDevice(const std::string &aInterfaceName);
     otbrError InitNetlink(void);
     otbrError InitMldListener(void);
 
+    struct UnicastAddressChange
+    {
+        Ip6AddressInfo mAddressInfo;
+        bool           mIsAdded;
+    };
+
+    using Ip6AddressInfoSet = std::unordered_set<Ip6AddressInfo, Ip6AddressInfoHash>;
+    using Ip6AddressSet     = std::unordered_set<Ip6Address, Ip6AddressHash>;
+
     void      PlatformSpecificInit(void);
     void      SetAddrGenModeToNone(void);
-    void      ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded);
+    void      ProcessUnicastAddressChanges(const std::vector<UnicastAddressChange> &aChanges);
     otbrError ProcessMulticastAddressChange(const Ip6Address &aAddress, bool aIsAdded);
+    void      UpdateNetlink(MainloopContext &aContext);
+    void      ProcessNetlink(const MainloopContext &aContext);
+#ifdef __linux__
+    void ReceiveNetlinkMessages(void);
+    void HandleAddressChangeAck(uint32_t aSequence, int aError);
+#endif
+    struct AtomicDirectionCounters
+    {
+        std::atomic<uint64_t>                                 mPackets;
+        std::atomic<uint64_t>                                 mBytes;
+        std::array<std::atomic<uint32_t>, kNumLatencyBuckets> mLatencyHistogram;
+    };
+
+    static void    ResetCounters(AtomicDirectionCounters &aCounters);
+    static void    RecordForwarded(AtomicDirectionCounters &aCounters, uint16_t aLength, Timepoint aQueuedTime);
+    static void    ReadCounters(const AtomicDirectionCounters &aCounters, DirectionCounters &aSnapshot);
+    static uint8_t GetLatencyBucket(uint64_t aLatencyUs);
+
     void      ProcessIp6Send(void);
+    size_t    ReadIp6Packets(int aFd, size_t aMaxPackets, std::vector<PacketBuffer> &aPackets);
+    void      SendIp6Batch(size_t aNumReads);
+    void      WriteIp6Packet(const uint8_t *aBuf, uint16_t aLen, Timepoint aQueuedTime);
+    otbrError StartDatapath(void);
+    void      StopDatapath(void);
+    void      ProcessDatapathEvent(void);
+    void      RunDatapath(void);
+    bool      IsIp6SendPoolExhausted(void) const { return mIp6SendPool.GetCounters().mInUse == kIp6SendPoolSize; }
     void      ProcessMldEvent(void);
 #if OTBR_ENABLE_DHCP6_PD && OTBR_ENABLE_BORDER_ROUTING
     otbrError TryProcessIcmp6RaMessage(const uint8_t *aData, uint16_t aLength);
 #endif
 
-    void Update(MainloopContext &aContext) override;
-    void Process(const MainloopContext &aContext) override;
+    void        Update(MainloopContext &aContext) override;
+    void        Process(const MainloopContext &aContext) override;
+    const char *GetName(void) const override { return "Netif"; }
 
     int      mTunFd;           ///< Used to exchange IPv6 packets.
     int      mIpFd;            ///< Used to manage IPv6 stack on the network interface.
@@ -110,9 +292,41 @@ private:
     unsigned int mNetifIndex;
     std::string  mNetifName;
 
-    std::vector<Ip6AddressInfo> mIp6UnicastAddresses;
-    std::vector<Ip6Address>     mIp6MulticastAddresses;
-    Dependencies               &mDeps;
+    Ip6AddressInfoSet mIp6UnicastAddresses;
+    Ip6AddressSet     mIp6MulticastAddresses;
+    Dependencies     &mDeps;
+
+#ifdef __linux__
+    // The address changes waiting for their acknowledgements, keyed by the netlink sequence, until the deadline.
+    std::unordered_map<uint32_t, UnicastAddressChange> mPendingAddressChanges;
+    Timepoint                                          mAddressChangeDeadline;
+#endif
+
+    size_t                    mIp6SendBatchSize;
+    PacketBufferPool          mIp6SendPool;
+    std::vector<PacketBuffer> mIp6SendBatch;
+    Ip6SendBatchCounters      mIp6SendBatchCounters;
+
+    bool                      mDatapathThreadEnabled;
+    int                       mDatapathEventFd;  ///< Signals the mainloop that packets are read from the TUN.
+    int                       mDatapathWakeupFd; ///< Signals the datapath thread to write packets or to stop.
+    std::atomic<bool>         mDatapathStopping;
+    std::atomic<bool>         mDatapathThrottled; ///< The datapath thread waits for buffers to read the TUN.
+    std::atomic<const char *> mDatapathError;     ///< The failure of the datapath thread, handled by the mainloop.
+    std::thread               mDatapathThread;
+    PacketBufferPool          mIp6ReceivePool;
+    MpscQueue<PacketBuffer>   mIp6SendQueue;    ///< Packets read by the datapath thread.
+    MpscQueue<PacketBuffer>   mIp6ReceiveQueue; ///< Packets to be written by the datapath thread.
+
+    // The counters are updated by both the mainloop and the datapath thread.
+    AtomicDirectionCounters mToThreadCounters;
+    AtomicDirectionCounters mFromThreadCounters;
+    std::atomic<uint64_t>   mOversizeDrops;
+    std::atomic<uint64_t>   mTunWriteDrops;
+    std::atomic<uint64_t>   mNoBufferDrops;
+    std::atomic<uint64_t>   mSendDrops;
+    std::atomic<uint64_t>   mRaIntercepted;
+    std::atomic<uint64_t>   mThrottles;
 };
 
 } // namespace otbr
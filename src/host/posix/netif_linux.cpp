@@ -32,6 +32,8 @@
 
 #include "netif.hpp"
 
+#include <algorithm>
+
 #include <assert.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -196,31 +198,38 @@ void Netif::SetAddrGenModeToNone(void)
     }
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
+// Big enough for a RTM_NEWADDR/RTM_DELADDR request carrying the IFA_LOCAL and IFA_CACHEINFO attributes.
+static constexpr size_t kMaxAddressRequestSize =
+    NLMSG_SPACE(sizeof(ifaddrmsg)) + RTA_SPACE(sizeof(in6_addr)) + RTA_SPACE(sizeof(ifa_cacheinfo));
+static constexpr size_t kMaxAddressRequestsPerBatch = 32;  ///< Bounds the size of a multi-part request.
+static constexpr int    kNetlinkAckTimeout          = 500; ///< Max time (ms) waiting for the acknowledgements.
+
+static size_t AppendAddressRequest(uint8_t              *aBuffer,
+                                   size_t                aMaxLen,
+                                   unsigned int          aNetifIndex,
+                                   uint32_t              aSequence,
+                                   const Ip6AddressInfo &aAddressInfo,
+                                   bool                  aIsAdded)
 {
-    struct
-    {
-        nlmsghdr  nh;
-        ifaddrmsg ifa;
-        char      buf[512];
-    } req;
+    nlmsghdr  *nh  = reinterpret_cast<nlmsghdr *>(aBuffer);
+    ifaddrmsg *ifa = reinterpret_cast<ifaddrmsg *>(NLMSG_DATA(nh));
 
-    assert(mIpFd >= 0);
-    memset(&req, 0, sizeof(req));
+    assert(aMaxLen >= kMaxAddressRequestSize);
+    memset(aBuffer, 0, kMaxAddressRequestSize);
 
-    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
-    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
-    req.nh.nlmsg_type  = aIsAdded ? RTM_NEWADDR : RTM_DELADDR;
-    req.nh.nlmsg_pid   = 0;
-    req.nh.nlmsg_seq   = ++mNetlinkSequence;
+    nh->nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
+    nh->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+    nh->nlmsg_type  = aIsAdded ? RTM_NEWADDR : RTM_DELADDR;
+    nh->nlmsg_pid   = 0;
+    nh->nlmsg_seq   = aSequence;
 
-    req.ifa.ifa_family    = AF_INET6;
-    req.ifa.ifa_prefixlen = aAddressInfo.mPrefixLength;
-    req.ifa.ifa_flags     = IFA_F_NODAD;
-    req.ifa.ifa_scope     = aAddressInfo.mScope;
-    req.ifa.ifa_index     = mNetifIndex;
+    ifa->ifa_family    = AF_INET6;
+    ifa->ifa_prefixlen = aAddressInfo.mPrefixLength;
+    ifa->ifa_flags     = IFA_F_NODAD;
+    ifa->ifa_scope     = aAddressInfo.mScope;
+    ifa->ifa_index     = aNetifIndex;
 
-    AddRtAttr(&req.nh, sizeof(req), IFA_LOCAL, &aAddressInfo.mAddress, sizeof(aAddressInfo.mAddress));
+    AddRtAttr(nh, aMaxLen, IFA_LOCAL, &aAddressInfo.mAddress, sizeof(aAddressInfo.mAddress));
 
     if (!aAddressInfo.mPreferred || aAddressInfo.mMeshLocal)
     {
@@ -229,19 +238,180 @@ void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool
         memset(&cacheinfo, 0, sizeof(cacheinfo));
         cacheinfo.ifa_valid = UINT32_MAX;
 
-        AddRtAttr(&req.nh, sizeof(req), IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
+        AddRtAttr(nh, aMaxLen, IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
     }
 
-    if (send(mNetlinkFd, &req, req.nh.nlmsg_len, 0) != -1)
+    return NLMSG_ALIGN(nh->nlmsg_len);
+}
+
+void Netif::ProcessUnicastAddressChanges(const std::vector<UnicastAddressChange> &aChanges)
+{
+    size_t begin = 0;
+
+    assert(mIpFd >= 0);
+
+    // The requests are packed into multi-part netlink messages, the kernel handles them in order and acknowledges
+    // each of them with a NLMSG_ERROR message carrying the request sequence. The acknowledgements are received
+    // by the mainloop, so that a slow kernel doesn't hold back the other processors.
+    while (begin < aChanges.size())
+    {
+        union
+        {
+            nlmsghdr mHeader;
+            uint8_t  mBuffer[kMaxAddressRequestsPerBatch * kMaxAddressRequestSize];
+        } req;
+
+        size_t   length        = 0;
+        size_t   end           = begin;
+        uint32_t firstSequence = mNetlinkSequence + 1;
+
+        while (end < aChanges.size() && end - begin < kMaxAddressRequestsPerBatch)
+        {
+            length += AppendAddressRequest(&req.mBuffer[length], sizeof(req.mBuffer) - length, mNetifIndex,
+                                           ++mNetlinkSequence, aChanges[end].mAddressInfo, aChanges[end].mIsAdded);
+            end++;
+        }
+
+        if (send(mNetlinkFd, req.mBuffer, length, 0) != -1)
+        {
+            otbrLogInfo("Sent request#%u-#%u to change %zu addresses", firstSequence, mNetlinkSequence, end - begin);
+
+            for (size_t i = begin; i < end; i++)
+            {
+                mPendingAddressChanges[firstSequence + static_cast<uint32_t>(i - begin)] = aChanges[i];
+            }
+            mAddressChangeDeadline = Clock::now() + Milliseconds(kNetlinkAckTimeout);
+        }
+        else
+        {
+            otbrLogWarning("Failed to send request#%u-#%u to change %zu addresses: %s", firstSequence,
+                           mNetlinkSequence, end - begin, strerror(errno));
+
+            for (size_t i = begin; i < end; i++)
+            {
+                if (aChanges[i].mIsAdded)
+                {
+                    mIp6UnicastAddresses.erase(aChanges[i].mAddressInfo);
+                }
+            }
+        }
+
+        begin = end;
+    }
+}
+
+void Netif::UpdateNetlink(MainloopContext &aContext)
+{
+    VerifyOrExit(mNetlinkFd >= 0);
+
+    // The address notifications are read as well, so that they don't fill up the receive buffer.
+    aContext.AddFdToReadSet(mNetlinkFd);
+
+    if (!mPendingAddressChanges.empty())
     {
-        otbrLogInfo("Sent request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                    Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        Timepoint      now     = Clock::now();
+        struct timeval timeout = ToTimeval(std::max(mAddressChangeDeadline - now, Clock::duration::zero()));
+
+        if (timercmp(&timeout, &aContext.mTimeout, <))
+        {
+            aContext.mTimeout = timeout;
+        }
     }
-    else
+
+exit:
+    return;
+}
+
+void Netif::ProcessNetlink(const MainloopContext &aContext)
+{
+    VerifyOrExit(mNetlinkFd >= 0);
+
+    if (FD_ISSET(mNetlinkFd, &aContext.mReadFdSet))
+    {
+        ReceiveNetlinkMessages();
+    }
+
+    if (!mPendingAddressChanges.empty() && Clock::now() >= mAddressChangeDeadline)
+    {
+        otbrLogWarning("Missing acknowledgements of %zu address requests", mPendingAddressChanges.size());
+        mPendingAddressChanges.clear();
+    }
+
+exit:
+    return;
+}
+
+void Netif::ReceiveNetlinkMessages(void)
+{
+    const size_t kMaxNetlinkBufSize = 8192;
+    union
+    {
+        nlmsghdr mHeader;
+        uint8_t  mBuffer[kMaxNetlinkBufSize];
+    } msgBuffer;
+
+    while (true)
+    {
+        ssize_t len = recv(mNetlinkFd, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), MSG_DONTWAIT);
+
+        if (len < 0)
+        {
+            // ENOBUFS means some messages were dropped, the lost acknowledgements expire at the deadline.
+            if (errno == EINTR || errno == ENOBUFS)
+            {
+                continue;
+            }
+
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to receive netlink messages: %s", strerror(errno));
+            }
+            ExitNow();
+        }
+
+        for (nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+             header           = NLMSG_NEXT(header, len))
+        {
+            if (header->nlmsg_type == NLMSG_ERROR)
+            {
+                const nlmsgerr *errMsg = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header));
+
+                HandleAddressChangeAck(header->nlmsg_seq, errMsg->error);
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+void Netif::HandleAddressChangeAck(uint32_t aSequence, int aError)
+{
+    auto                        it = mPendingAddressChanges.find(aSequence);
+    const UnicastAddressChange *change;
+
+    // The acknowledgements of the other requests, e.g. the one setting addr_gen_mode, are ignored.
+    VerifyOrExit(it != mPendingAddressChanges.end());
+    change = &it->second;
+
+    // An address which is already there is as good as a successful addition.
+    if (aError != 0 && !(change->mIsAdded && aError == -EEXIST))
     {
-        otbrLogWarning("Failed to send request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                       Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        otbrLogWarning("Failed to %s %s/%u: %s", (change->mIsAdded ? "add" : "remove"),
+                       Ip6Address(change->mAddressInfo.mAddress).ToString().c_str(),
+                       change->mAddressInfo.mPrefixLength, strerror(-aError));
+
+        // Drops the address so that the next update retries it.
+        if (change->mIsAdded)
+        {
+            mIp6UnicastAddresses.erase(change->mAddressInfo);
+        }
     }
+
+    mPendingAddressChanges.erase(it);
+
+exit:
+    return;
 }
 
 } // namespace otbr
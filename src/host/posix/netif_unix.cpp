@@ -58,10 +58,19 @@ void Netif::PlatformSpecificInit(void)
     /* Empty */
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
+void Netif::ProcessUnicastAddressChanges(const std::vector<UnicastAddressChange> &aChanges)
 {
-    OTBR_UNUSED_VARIABLE(aAddressInfo);
-    OTBR_UNUSED_VARIABLE(aIsAdded);
+    OTBR_UNUSED_VARIABLE(aChanges);
+}
+
+void Netif::UpdateNetlink(MainloopContext &aContext)
+{
+    OTBR_UNUSED_VARIABLE(aContext);
+}
+
+void Netif::ProcessNetlink(const MainloopContext &aContext)
+{
+    OTBR_UNUSED_VARIABLE(aContext);
 }
 
 } // namespace otbr
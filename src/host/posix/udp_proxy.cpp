@@ -37,10 +37,13 @@
 #include <assert.h>
 #include <errno.h>
 #include <netinet/in.h>
+#include <string.h>
 #include <sys/select.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
+#include "common/log_rate_limiter.hpp"
 #include "common/logging.hpp"
 #include "host/posix/dnssd.hpp"
 #include "utils/socket_utils.hpp"
@@ -51,155 +54,178 @@ otbrError UdpProxy::Dependencies::UdpForward(const uint8_t      *aUdpPayload,
                                              uint16_t            aLength,
                                              const otIp6Address &aRemoteAddr,
                                              uint16_t            aRemotePort,
-                                             const UdpProxy     &aUdpProxy)
+                                             uint16_t            aThreadPort)
 {
     OTBR_UNUSED_VARIABLE(aUdpPayload);
     OTBR_UNUSED_VARIABLE(aLength);
     OTBR_UNUSED_VARIABLE(aRemoteAddr);
     OTBR_UNUSED_VARIABLE(aRemotePort);
-    OTBR_UNUSED_VARIABLE(aUdpProxy);
+    OTBR_UNUSED_VARIABLE(aThreadPort);
 
     return OTBR_ERROR_NONE;
 }
 
 UdpProxy::UdpProxy(Dependencies &aDeps)
-    : mFd(-1)
-    , mHostPort(0)
-    , mThreadPort(0)
-    , mDeps(aDeps)
+    : mDeps(aDeps)
 {
 }
 
-void UdpProxy::Start(uint16_t aPort)
+otbrError UdpProxy::Start(uint16_t aThreadPort)
 {
-    VerifyOrExit(!IsStarted());
+    otbrError             error = OTBR_ERROR_NONE;
+    auto                  it    = mPorts.find(aThreadPort);
+    std::unique_ptr<Port> port;
 
-    BindToEphemeralPort();
-    mThreadPort = aPort;
+    if (it != mPorts.end())
+    {
+        it->second->mRefCount++;
+        ExitNow();
+    }
+
+    port.reset(new Port());
+    port->mFd       = -1;
+    port->mRefCount = 1;
+    SuccessOrExit(error = BindToEphemeralPort(*port));
+
+    otbrLogInfo("Proxy Thread port %u on host port %u", aThreadPort, port->mHostPort);
+    mPorts[aThreadPort] = std::move(port);
 
 exit:
-    return;
+    return error;
 }
 
-void UdpProxy::Stop(void)
+void UdpProxy::Stop(uint16_t aThreadPort)
 {
-    VerifyOrExit(IsStarted());
+    auto it = mPorts.find(aThreadPort);
 
-    mHostPort = 0;
+    VerifyOrExit(it != mPorts.end());
+    VerifyOrExit(--it->second->mRefCount == 0);
 
-    if (mFd >= 0)
-    {
-        close(mFd);
-        mFd = -1;
-    }
+    close(it->second->mFd);
+    mPorts.erase(it);
 
 exit:
     return;
 }
 
-void UdpProxy::Process(const MainloopContext &aContext)
+void UdpProxy::Stop(void)
 {
-    constexpr size_t kMaxUdpSize = 1280;
+    for (auto &entry : mPorts)
+    {
+        close(entry.second->mFd);
+    }
+    mPorts.clear();
+}
 
-    uint8_t      payload[kMaxUdpSize];
-    uint16_t     length = sizeof(payload);
-    otIp6Address remoteAddr;
-    uint16_t     remotePort;
+uint16_t UdpProxy::GetHostPort(uint16_t aThreadPort) const
+{
+    auto it = mPorts.find(aThreadPort);
 
-    VerifyOrExit(mFd != -1 && IsStarted());
-    VerifyOrExit(FD_ISSET(mFd, &aContext.mReadFdSet));
+    return it != mPorts.end() ? it->second->mHostPort : 0;
+}
 
-    SuccessOrExit(ReceivePacket(payload, length, remoteAddr, remotePort));
+const UdpProxy::Counters *UdpProxy::GetCounters(uint16_t aThreadPort) const
+{
+    auto it = mPorts.find(aThreadPort);
 
-    // UDP Forward to NCPq
-    mDeps.UdpForward(payload, length, remoteAddr, remotePort, *this);
+    return it != mPorts.end() ? &it->second->mCounters : nullptr;
+}
 
-exit:
-    return;
+void UdpProxy::Process(const MainloopContext &aContext)
+{
+    // Each ready port gets at most one batch per pass, so that a busy port can't starve the others.
+    for (auto &entry : mPorts)
+    {
+        Port  &port  = *entry.second;
+        size_t count = 0;
+
+        if (port.mTxQueueLength > 0 && FD_ISSET(port.mFd, &aContext.mWriteFdSet))
+        {
+            SendQueuedPackets(port);
+        }
+
+        if (FD_ISSET(port.mFd, &aContext.mReadFdSet))
+        {
+            count = ReceivePackets(port);
+        }
+
+        // UDP Forward to NCP
+        for (size_t i = 0; i < count; i++)
+        {
+            const Datagram &datagram = mRxArena[i];
+            otIp6Address    remoteAddr;
+            uint16_t        remotePort = ntohs(datagram.mPeerAddr.sin6_port);
+
+            memcpy(&remoteAddr, &datagram.mPeerAddr.sin6_addr, sizeof(remoteAddr));
+            otbrLogRateLimited(OTBR_LOG_DEBUG, "Receive a packet, remote address:%s, remote port:%d",
+                               Ip6Address(remoteAddr).ToString().c_str(), remotePort);
+
+            if (mDeps.UdpForward(datagram.mPayload, datagram.mLength, remoteAddr, remotePort, entry.first) !=
+                OTBR_ERROR_NONE)
+            {
+                port.mCounters.mForwardFailures++;
+            }
+        }
+    }
 }
 
 void UdpProxy::Update(MainloopContext &aContext)
 {
-    VerifyOrExit(mFd != -1);
-    VerifyOrExit(IsStarted());
+    for (const auto &entry : mPorts)
+    {
+        const Port &port = *entry.second;
 
-    aContext.AddFdToReadSet(mFd);
+        aContext.AddFdToReadSet(port.mFd);
 
-exit:
-    return;
+        if (port.mTxQueueLength > 0)
+        {
+            aContext.AddFdToSet(port.mFd, MainloopContext::kWriteFdSet);
+        }
+    }
 }
 
 void UdpProxy::SendToPeer(const uint8_t      *aUdpPayload,
                           uint16_t            aLength,
                           const otIp6Address &aPeerAddr,
-                          uint16_t            aPeerPort)
+                          uint16_t            aPeerPort,
+                          uint16_t            aThreadPort)
 {
-#ifdef __APPLE__
-    // use fixed value for CMSG_SPACE is not a constant expression on macOS
-    constexpr size_t kBufferSize = 128;
-#else
-    constexpr size_t kBufferSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
-#endif
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kBufferSize];
-    size_t              controlLength = 0;
-    struct iovec        iov;
-    struct msghdr       msg;
-    struct cmsghdr     *cmsg;
-    ssize_t             rval;
-
-    memset(&peerAddr, 0, sizeof(peerAddr));
-    peerAddr.sin6_port   = htons(aPeerPort);
-    peerAddr.sin6_family = AF_INET6;
-    memcpy(&peerAddr.sin6_addr, &aPeerAddr, sizeof(aPeerAddr));
-    memset(control, 0, sizeof(control));
-
-    iov.iov_base = reinterpret_cast<void *>(const_cast<uint8_t *>(aUdpPayload));
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(sizeof(control));
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
-
-    {
-        constexpr int kIp6HopLimit = 64;
-
-        int hopLimit = kIp6HopLimit;
-
-        cmsg             = CMSG_FIRSTHDR(&msg);
-        cmsg->cmsg_level = IPPROTO_IPV6;
-        cmsg->cmsg_type  = IPV6_HOPLIMIT;
-        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+    auto      it = mPorts.find(aThreadPort);
+    Port     *port;
+    Datagram *datagram;
 
-        memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
+    VerifyOrExit(it != mPorts.end(), otbrLogDebug("Drop a packet from unproxied Thread port %u", aThreadPort));
+    port = it->second.get();
 
-        controlLength += CMSG_SPACE(sizeof(int));
+    if (aLength > kMaxUdpSize || port->mTxQueueLength == kMaxBatchSize)
+    {
+        otbrLogRateLimited(OTBR_LOG_WARNING, "Failed to queue a %u-byte packet to peer", aLength);
+        port->mCounters.mTxDrops++;
+        ExitNow();
     }
 
-#ifdef __APPLE__
-    msg.msg_controllen = static_cast<socklen_t>(controlLength);
-#else
-    msg.msg_controllen = controlLength;
-#endif
+    datagram = &port->mTxQueue[port->mTxQueueLength++];
 
-    rval = sendmsg(mFd, &msg, 0);
+    memset(&datagram->mPeerAddr, 0, sizeof(datagram->mPeerAddr));
+    datagram->mPeerAddr.sin6_port   = htons(aPeerPort);
+    datagram->mPeerAddr.sin6_family = AF_INET6;
+    memcpy(&datagram->mPeerAddr.sin6_addr, &aPeerAddr, sizeof(aPeerAddr));
+    memcpy(datagram->mPayload, aUdpPayload, aLength);
+    datagram->mLength = aLength;
 
-    if (rval == -1)
-    {
-        otbrLogWarning("Failed to sendmsg: %s", strerror(errno));
-    }
+    // Packets queued earlier go first, so that the peer receives them in order.
+    SendQueuedPackets(*port);
+
+exit:
+    return;
 }
 
-otbrError UdpProxy::BindToEphemeralPort(void)
+otbrError UdpProxy::BindToEphemeralPort(Port &aPort)
 {
     otbrError error = OTBR_ERROR_NONE;
-    mFd             = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, kSocketNonBlock);
+    aPort.mFd       = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, kSocketNonBlock);
 
-    VerifyOrExit(mFd != 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(aPort.mFd >= 0, error = OTBR_ERROR_ERRNO);
 
     {
         struct sockaddr_in6 sin6;
@@ -209,70 +235,175 @@ otbrError UdpProxy::BindToEphemeralPort(void)
         sin6.sin6_addr   = in6addr_any;
         sin6.sin6_port   = 0;
 
-        VerifyOrExit(0 == bind(mFd, reinterpret_cast<struct sockaddr *>(&sin6), sizeof(sin6)),
+        VerifyOrExit(0 == bind(aPort.mFd, reinterpret_cast<struct sockaddr *>(&sin6), sizeof(sin6)),
                      error = OTBR_ERROR_ERRNO);
     }
 
     {
         int on = 1;
-        VerifyOrExit(0 == setsockopt(mFd, IPPROTO_IPV6, IPV6_RECVHOPLIMIT, &on, sizeof(on)), error = OTBR_ERROR_ERRNO);
-        VerifyOrExit(0 == setsockopt(mFd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &on, sizeof(on)), error = OTBR_ERROR_ERRNO);
+        VerifyOrExit(0 == setsockopt(aPort.mFd, IPPROTO_IPV6, IPV6_RECVHOPLIMIT, &on, sizeof(on)),
+                     error = OTBR_ERROR_ERRNO);
+        VerifyOrExit(0 == setsockopt(aPort.mFd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &on, sizeof(on)),
+                     error = OTBR_ERROR_ERRNO);
     }
 
     {
         struct sockaddr_in bound_addr;
         socklen_t          addr_len = sizeof(bound_addr);
-        getsockname(mFd, (struct sockaddr *)&bound_addr, &addr_len);
+        getsockname(aPort.mFd, (struct sockaddr *)&bound_addr, &addr_len);
 
-        mHostPort = ntohs(bound_addr.sin_port);
-        otbrLogInfo("Ephemeral port: %u", mHostPort);
+        aPort.mHostPort = ntohs(bound_addr.sin_port);
+        otbrLogInfo("Ephemeral port: %u", aPort.mHostPort);
     }
 
 exit:
     otbrLogResult(error, "Bind to ephemeral port");
-    if (error != OTBR_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE && aPort.mFd >= 0)
     {
-        Stop();
+        close(aPort.mFd);
+        aPort.mFd = -1;
     }
     return error;
 }
 
-otbrError UdpProxy::ReceivePacket(uint8_t      *aPayload,
-                                  uint16_t     &aLength,
-                                  otIp6Address &aRemoteAddr,
-                                  uint16_t     &aRemotePort)
+static void PrepareMessage(struct msghdr &aMsg, struct iovec &aIov, void *aPeerAddr, void *aControl)
+{
+    aMsg.msg_name       = aPeerAddr;
+    aMsg.msg_namelen    = sizeof(struct sockaddr_in6);
+    aMsg.msg_control    = aControl;
+    aMsg.msg_controllen = 0;
+    aMsg.msg_iov        = &aIov;
+    aMsg.msg_iovlen     = 1;
+    aMsg.msg_flags      = 0;
+}
+
+size_t UdpProxy::ReceivePackets(Port &aPort)
 {
-    constexpr size_t kMaxUdpSize = 1280;
+    struct iovec iovs[kMaxBatchSize];
+    size_t       count = 0;
 
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
+#ifdef __linux__
+    struct mmsghdr msgs[kMaxBatchSize];
+    int            rval;
 
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
+    for (size_t i = 0; i < kMaxBatchSize; i++)
+    {
+        iovs[i].iov_base = mRxArena[i].mPayload;
+        iovs[i].iov_len  = sizeof(mRxArena[i].mPayload);
+        PrepareMessage(msgs[i].msg_hdr, iovs[i], &mRxArena[i].mPeerAddr, mRxArena[i].mControl);
+        msgs[i].msg_hdr.msg_controllen = sizeof(mRxArena[i].mControl);
+    }
+
+    rval = recvmmsg(aPort.mFd, msgs, kMaxBatchSize, MSG_DONTWAIT, nullptr);
+    if (rval <= 0)
+    {
+        VerifyOrExit(errno != EAGAIN && errno != EWOULDBLOCK);
+        ExitNow(otbrLogRateLimited(OTBR_LOG_WARNING, "Failed to recvmmsg: %s", strerror(errno)));
+    }
 
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+    count = static_cast<size_t>(rval);
+    for (size_t i = 0; i < count; i++)
+    {
+        mRxArena[i].mLength = static_cast<uint16_t>(msgs[i].msg_len);
+    }
+#else
+    for (; count < kMaxBatchSize; count++)
+    {
+        struct msghdr msg;
+        ssize_t       rval;
+
+        iovs[count].iov_base = mRxArena[count].mPayload;
+        iovs[count].iov_len  = sizeof(mRxArena[count].mPayload);
+        PrepareMessage(msg, iovs[count], &mRxArena[count].mPeerAddr, mRxArena[count].mControl);
+        msg.msg_controllen = sizeof(mRxArena[count].mControl);
+
+        rval = recvmsg(aPort.mFd, &msg, MSG_DONTWAIT);
+        if (rval <= 0)
+        {
+            VerifyOrExit(count == 0 && errno != EAGAIN && errno != EWOULDBLOCK);
+            ExitNow(otbrLogRateLimited(OTBR_LOG_WARNING, "Failed to recvmsg: %s", strerror(errno)));
+        }
+        mRxArena[count].mLength = static_cast<uint16_t>(rval);
+    }
+#endif
 
-    rval = recvmsg(mFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
+exit:
+    if (count > 0)
+    {
+        aPort.mCounters.mRxPackets += count;
+        aPort.mCounters.mRxBatchSizes[count - 1]++;
+    }
+    return count;
+}
 
-    aRemotePort = ntohs(peerAddr.sin6_port);
-    memcpy(&aRemoteAddr, &peerAddr.sin6_addr, sizeof(otIp6Address));
+void UdpProxy::SendQueuedPackets(Port &aPort)
+{
+    constexpr int kIp6HopLimit = 64;
 
-    otbrLogDebug("Receive a packet, remote address:%s, remote port:%d", Ip6Address(aRemoteAddr).ToString().c_str(),
-                 aRemotePort);
+    int          hopLimit = kIp6HopLimit;
+    struct iovec iovs[kMaxBatchSize];
+    size_t       sent = 0;
+
+#ifdef __linux__
+    struct mmsghdr msgs[kMaxBatchSize];
+#else
+    struct msghdr msgs[kMaxBatchSize];
+#endif
+
+    for (size_t i = 0; i < aPort.mTxQueueLength; i++)
+    {
+#ifdef __linux__
+        struct msghdr &msg = msgs[i].msg_hdr;
+#else
+        struct msghdr &msg = msgs[i];
+#endif
+        struct cmsghdr *cmsg;
+
+        iovs[i].iov_base = aPort.mTxQueue[i].mPayload;
+        iovs[i].iov_len  = aPort.mTxQueue[i].mLength;
+        PrepareMessage(msg, iovs[i], &aPort.mTxQueue[i].mPeerAddr, aPort.mTxQueue[i].mControl);
+        memset(aPort.mTxQueue[i].mControl, 0, sizeof(aPort.mTxQueue[i].mControl));
+        msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(CMSG_SPACE(sizeof(int)));
+
+        cmsg             = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = IPPROTO_IPV6;
+        cmsg->cmsg_type  = IPV6_HOPLIMIT;
+        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
+    }
+
+    while (sent < aPort.mTxQueueLength)
+    {
+#ifdef __linux__
+        int rval =
+            sendmmsg(aPort.mFd, &msgs[sent], static_cast<unsigned int>(aPort.mTxQueueLength - sent), MSG_DONTWAIT);
+#else
+        int rval = sendmsg(aPort.mFd, &msgs[sent], MSG_DONTWAIT) >= 0 ? 1 : -1;
+#endif
+
+        if (rval > 0)
+        {
+            sent += static_cast<size_t>(rval);
+            aPort.mCounters.mTxPackets += static_cast<uint64_t>(rval);
+            aPort.mCounters.mTxBatchSizes[rval - 1]++;
+            continue;
+        }
+
+        // Keeps the rest of the packets until the socket becomes writable again.
+        VerifyOrExit(errno != EAGAIN && errno != EWOULDBLOCK);
+
+        otbrLogRateLimited(OTBR_LOG_WARNING, "Failed to sendmsg: %s", strerror(errno));
+        aPort.mCounters.mTxDrops++;
+        sent++;
+    }
 
 exit:
-    return rval > 0 ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO;
+    // Moves the unsent packets to the front of the queue.
+    for (size_t i = sent; i < aPort.mTxQueueLength; i++)
+    {
+        aPort.mTxQueue[i - sent] = aPort.mTxQueue[i];
+    }
+    aPort.mTxQueueLength -= sent;
 }
 
 } // namespace otbr
@@ -34,6 +34,10 @@
 #ifndef OTBR_AGENT_POSIX_UDP_PROXY_HPP_
 #define OTBR_AGENT_POSIX_UDP_PROXY_HPP_
 
+#include <array>
+#include <map>
+#include <memory>
+
 #include <openthread/error.h>
 #include <openthread/ip6.h>
 
@@ -42,9 +46,33 @@
 
 namespace otbr {
 
+/**
+ * This class proxies UDP ports of the Thread stack to the host.
+ *
+ * Each proxied Thread port is served by its own host socket bound to an ephemeral port, with its own send queue and
+ * counters, so that a congested port doesn't hold back the others.
+ */
 class UdpProxy : public MainloopProcessor
 {
 public:
+    static constexpr uint16_t kMaxUdpSize   = 1280; ///< The max size of a proxied UDP payload.
+    static constexpr size_t   kMaxBatchSize = 16;   ///< The max number of datagrams per recvmmsg/sendmmsg.
+
+    /**
+     * This structure represents the counters of a proxied port.
+     *
+     * `mRxBatchSizes[n - 1]` and `mTxBatchSizes[n - 1]` count the system calls which received or sent n datagrams.
+     */
+    struct Counters
+    {
+        uint64_t                            mRxPackets;       ///< Datagrams received from peers.
+        uint64_t                            mTxPackets;       ///< Datagrams sent to peers.
+        uint64_t                            mTxDrops;         ///< Datagrams failed to be sent or queued.
+        uint64_t                            mForwardFailures; ///< Datagrams failed to be forwarded to Thread.
+        std::array<uint32_t, kMaxBatchSize> mRxBatchSizes;    ///< Histogram of the receive batch sizes.
+        std::array<uint32_t, kMaxBatchSize> mTxBatchSizes;    ///< Histogram of the send batch sizes.
+    };
+
     class Dependencies
     {
     public:
@@ -54,7 +82,7 @@ public:
                                      uint16_t            aLength,
                                      const otIp6Address &aRemoteAddr,
                                      uint16_t            aRemotePort,
-                                     const UdpProxy     &aUdpProxy);
+                                     uint16_t            aThreadPort);
     };
 
     /**
@@ -62,58 +90,104 @@ public:
      */
     explicit UdpProxy(Dependencies &aDeps);
 
-    ~UdpProxy(void) = default;
+    ~UdpProxy(void) { Stop(); }
 
     /**
-     * Start the UDP Proxy for Thread UDP port @p aPort.
+     * Start proxying Thread UDP port @p aThreadPort.
+     *
+     * The UDP Proxy will bind to an ephemeral port and set a mapping between the ephemeral port and @p aThreadPort.
+     * If @p aThreadPort is already proxied, e.g. the Border Agent and ePSKc sessions share the same port, the existing
+     * host port is reused and must be stopped as many times as it was started.
      *
-     * The UDP Proxy will bind to an ephemeral port and set a mapping between the ephemeral port and @p aPort.
+     * @param[in] aThreadPort  The UDP port to be proxied in Thread stack.
      *
-     * @param[in] aPort  The UDP port to be proxied in Thread stack.
+     * @retval OTBR_ERROR_NONE   Successfully started proxying the port.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the host socket.
      */
-    void Start(uint16_t aPort);
+    otbrError Start(uint16_t aThreadPort);
 
     /**
-     * Stop the UDP Proxy if started.
+     * Stop proxying Thread UDP port @p aThreadPort if started.
+     *
+     * The host socket is closed once every `Start()` of @p aThreadPort is matched by a `Stop()`.
+     *
+     * @param[in] aThreadPort  The proxied UDP port in Thread stack.
      */
-    void Stop(void);
+    void Stop(uint16_t aThreadPort);
 
     /**
-     * Get the ephemeral UDP port bound on host.
-     *
-     * @returns The UDP port bound on the host. If the proxy isn't running, `0` will be returned.
+     * Stop proxying all the Thread UDP ports.
      */
-    uint16_t GetHostPort(void) const { return mHostPort; }
+    void Stop(void);
 
     /**
-     * Get the UDP port on the Thread side.
+     * Get the ephemeral UDP port bound on host for Thread UDP port @p aThreadPort.
+     *
+     * @param[in] aThreadPort  The proxied UDP port in Thread stack.
      *
-     * @returns The UDP port on the Thread side. If the proxy isn't running, `0` will be returned.
+     * @returns The UDP port bound on the host. If @p aThreadPort isn't proxied, `0` will be returned.
      */
-    uint16_t GetThreadPort(void) const { return mThreadPort; }
+    uint16_t GetHostPort(uint16_t aThreadPort) const;
 
     /**
      * Sends a UDP packet to the peer.
      *
+     * The packet is sent right away if possible. When the socket is congested, it is queued and the queued packets
+     * are sent with a single `sendmmsg()` once the socket becomes writable.
+     *
      * @param[in] aUdpPlayload  The UDP payload.
      * @param[in] aLength       Then length of the UDP payload.
      * @param[in] aPeerAddr     The address of the peer.
      * @param[in] aPeerPort     The UDP of the peer.
+     * @param[in] aThreadPort   The UDP port in Thread stack which sends the packet.
+     */
+    void SendToPeer(const uint8_t      *aUdpPayload,
+                    uint16_t            aLength,
+                    const otIp6Address &aPeerAddr,
+                    uint16_t            aPeerPort,
+                    uint16_t            aThreadPort);
+
+    /**
+     * Returns the counters of Thread UDP port @p aThreadPort.
+     *
+     * @param[in] aThreadPort  The proxied UDP port in Thread stack.
+     *
+     * @returns A pointer to the counters, or `nullptr` if @p aThreadPort isn't proxied.
      */
-    void SendToPeer(const uint8_t *aUdpPayload, uint16_t aLength, const otIp6Address &aPeerAddr, uint16_t aPeerPort);
+    const Counters *GetCounters(uint16_t aThreadPort) const;
 
 private:
+    static constexpr size_t kControlSize = 128; ///< Big enough for the IPV6_PKTINFO and IPV6_HOPLIMIT messages.
+
+    struct Datagram
+    {
+        struct sockaddr_in6 mPeerAddr;
+        uint16_t            mLength;
+        uint8_t             mControl[kControlSize];
+        uint8_t             mPayload[kMaxUdpSize];
+    };
+
+    struct Port
+    {
+        int      mFd;                     ///< Used to proxy UDP packets in Thread network.
+        uint16_t mHostPort;               ///< The ephemeral port bound on host.
+        Datagram mTxQueue[kMaxBatchSize]; ///< Packets waiting to be sent in a sendmmsg() batch.
+        size_t   mTxQueueLength;          ///< The number of packets in `mTxQueue`.
+        uint32_t mRefCount;               ///< The number of `Start()` calls not yet matched by a `Stop()`.
+        Counters mCounters;
+    };
+
     // MainloopProcessor methods
-    void Process(const MainloopContext &aMainloop) override;
-    void Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "UdpProxy"; }
 
-    bool      IsStarted(void) const { return mHostPort != 0; }
-    otbrError BindToEphemeralPort(void);
-    otbrError ReceivePacket(uint8_t *aPayload, uint16_t &aLength, otIp6Address &aRemoteAddr, uint16_t &aRemotePort);
+    static otbrError BindToEphemeralPort(Port &aPort);
+    size_t           ReceivePackets(Port &aPort);
+    static void      SendQueuedPackets(Port &aPort);
 
-    int      mFd; ///< Used to proxy UDP packets in Thread network.
-    uint16_t mHostPort;
-    uint16_t mThreadPort;
+    std::map<uint16_t, std::unique_ptr<Port>> mPorts;                  ///< The proxied ports, keyed by the Thread port.
+    Datagram                                  mRxArena[kMaxBatchSize]; ///< Receive buffers of a recvmmsg() batch.
 
     Dependencies &mDeps;
 };
@@ -132,6 +132,7 @@ RcpHost::RcpHost(const char                      *aInterfaceName,
                  bool                             aEnableAutoAttach,
                  const char                      *aDataPath)
     : mInstance(nullptr)
+    , mWorkerPool(mTaskRunner)
     , mEnableAutoAttach(aEnableAutoAttach)
     , mThreadEnabledState(ThreadEnabledState::kStateDisabled)
 {
@@ -906,13 +907,13 @@ otbrError RcpHost::UdpForward(const uint8_t      *aUdpPayload,
                               uint16_t            aLength,
                               const otIp6Address &aRemoteAddr,
                               uint16_t            aRemotePort,
-                              const UdpProxy     &aUdpProxy)
+                              uint16_t            aThreadPort)
 {
     OTBR_UNUSED_VARIABLE(aUdpPayload);
     OTBR_UNUSED_VARIABLE(aLength);
     OTBR_UNUSED_VARIABLE(aRemoteAddr);
     OTBR_UNUSED_VARIABLE(aRemotePort);
-    OTBR_UNUSED_VARIABLE(aUdpProxy);
+    OTBR_UNUSED_VARIABLE(aThreadPort);
 
     return OTBR_ERROR_NOT_IMPLEMENTED;
 }
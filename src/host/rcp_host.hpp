@@ -49,6 +49,7 @@
 #include "common/mainloop.hpp"
 #include "common/task_runner.hpp"
 #include "common/types.hpp"
+#include "common/worker_pool.hpp"
 #include "host/thread_helper.hpp"
 #include "host/thread_host.hpp"
 
@@ -138,9 +139,10 @@ public:
         return mThreadHelper.get();
     }
 
-    bool IsInitialized(void) const override { return mInstance != nullptr; }
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    bool        IsInitialized(void) const override { return mInstance != nullptr; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "RcpHost"; }
 
     /**
      * This method posts a task to the timer
@@ -152,6 +154,15 @@ public:
 
     TaskRunner &GetTaskRunner(void) { return mTaskRunner; };
 
+    /**
+     * This method returns the worker pool for CPU-heavy jobs which shouldn't run on the mainloop.
+     *
+     * The completion handlers of the jobs are executed on the mainloop.
+     *
+     * @returns A reference to the worker pool.
+     */
+    WorkerPool &GetWorkerPool(void) { return mWorkerPool; }
+
     /**
      * This method registers a reset handler.
      *
@@ -273,7 +284,7 @@ private:
                          uint16_t            aLength,
                          const otIp6Address &aRemoteAddr,
                          uint16_t            aRemotePort,
-                         const UdpProxy     &aUdpProxy) override;
+                         uint16_t            aThreadPort) override;
 
     bool IsAutoAttachEnabled(void);
     void DisableAutoAttach(void);
@@ -287,7 +298,8 @@ private:
     otPlatformConfig                       mConfig;
     std::unique_ptr<ThreadHelper>          mThreadHelper;
     std::vector<std::function<void(void)>> mResetHandlers;
-    TaskRunner                             mTaskRunner;
+    TaskRunner                             mTaskRunner{"RcpHost.TaskRunner"};
+    WorkerPool                             mWorkerPool;
 
     std::vector<ThreadStateChangedCallback>       mThreadStateChangedCallbacks;
     std::vector<ThreadEnabledStateCallback>       mThreadEnabledStateChangedCallbacks;
@@ -0,0 +1,363 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the scheduler of Spinel commands sent to the NCP.
+ */
+
+#define OTBR_LOG_TAG "NcpSpinel"
+
+#include "host/spinel_command_scheduler.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Host {
+
+constexpr spinel_tid_t SpinelCommandScheduler::kMaxTids;
+constexpr uint16_t     SpinelCommandScheduler::kMaxQueuedCommands;
+constexpr Milliseconds SpinelCommandScheduler::kLateResponseTimeout;
+
+SpinelCommandScheduler::SpinelCommandScheduler(TaskRunner      &aTaskRunner,
+                                               SendFrameHandler aSendFrameHandler,
+                                               FailureHandler   aFailureHandler)
+    : mTaskRunner(aTaskRunner)
+    , mSendFrameHandler(std::move(aSendFrameHandler))
+    , mFailureHandler(std::move(aFailureHandler))
+    , mTidsInUse(0)
+    , mTidsTimedOut(0)
+    , mNextTid(1)
+    , mQueuedCommandCount(0)
+    , mTimerId(0)
+{
+    std::fill_n(mWaitingKeyTable, kMaxTids, SPINEL_PROP_LAST_STATUS);
+    std::fill_n(mCmdTable, kMaxTids, SPINEL_CMD_NOOP);
+    memset(&mCounters, 0, sizeof(mCounters));
+}
+
+SpinelCommandScheduler::~SpinelCommandScheduler(void)
+{
+    if (mTimerId != 0)
+    {
+        mTaskRunner.Cancel(mTimerId);
+    }
+}
+
+spinel_tid_t SpinelCommandScheduler::AllocateTid(void)
+{
+    spinel_tid_t tid = mNextTid;
+
+    while (IsTidInUse(tid))
+    {
+        tid = SPINEL_GET_NEXT_TID(tid);
+
+        if (tid == mNextTid)
+        {
+            // We looped back to `mNextTid` indicating that all
+            // TIDs are in-use.
+
+            ExitNow(tid = 0);
+        }
+    }
+
+    mTidsInUse |= (1 << tid);
+    mNextTid = SPINEL_GET_NEXT_TID(tid);
+
+exit:
+    return tid;
+}
+
+void SpinelCommandScheduler::StartTransaction(spinel_tid_t      aTid,
+                                              spinel_command_t  aCmd,
+                                              spinel_prop_key_t aKey,
+                                              Timepoint         aDeadline)
+{
+    mCmdTable[aTid]        = aCmd;
+    mWaitingKeyTable[aTid] = aKey;
+    mDeadlineTable[aTid]   = aDeadline;
+    ScheduleTimer(aDeadline);
+}
+
+void SpinelCommandScheduler::ReleaseTid(spinel_tid_t aTid)
+{
+    FreeTid(aTid);
+    SendQueuedCommands();
+}
+
+bool SpinelCommandScheduler::IsWaitingResponse(spinel_tid_t aTid) const
+{
+    return aTid != 0 && aTid < kMaxTids && IsTidInUse(aTid) && !IsTidTimedOut(aTid);
+}
+
+bool SpinelCommandScheduler::HandleLateResponse(spinel_tid_t aTid)
+{
+    bool isLate = aTid < kMaxTids && IsTidTimedOut(aTid);
+
+    if (isLate)
+    {
+        mCounters.mLateResponses++;
+        ReleaseTid(aTid);
+    }
+
+    return isLate;
+}
+
+otError SpinelCommandScheduler::Enqueue(std::vector<uint8_t> aFrame,
+                                        spinel_command_t     aCmd,
+                                        spinel_prop_key_t    aKey,
+                                        Priority             aPriority,
+                                        Timepoint            aDeadline)
+{
+    otError       error = OT_ERROR_NONE;
+    QueuedCommand command;
+
+    if (mQueuedCommandCount >= kMaxQueuedCommands)
+    {
+        mCounters.mOverflows++;
+        otbrLogWarning("Spinel command queue is full, dropping (cmd:%u, key:%u)", aCmd, aKey);
+        ExitNow(error = OT_ERROR_BUSY);
+    }
+
+    command.mCmd      = aCmd;
+    command.mKey      = aKey;
+    command.mDeadline = aDeadline;
+    command.mFrame    = std::move(aFrame);
+
+    mQueuedCommands[static_cast<uint8_t>(aPriority)].push_back(std::move(command));
+    mQueuedCommandCount++;
+    mCounters.mQueuedTotal++;
+    mCounters.mMaxQueued = std::max(mCounters.mMaxQueued, mQueuedCommandCount);
+    ScheduleTimer(aDeadline);
+
+exit:
+    return error;
+}
+
+void SpinelCommandScheduler::Abort(otError aError)
+{
+    std::vector<FailedCommand> failedCommands;
+
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        if (IsWaitingResponse(tid) && mCmdTable[tid] != SPINEL_CMD_NOOP)
+        {
+            failedCommands.push_back({mCmdTable[tid], mWaitingKeyTable[tid], aError});
+        }
+        FreeTid(tid);
+    }
+
+    for (std::deque<QueuedCommand> &queue : mQueuedCommands)
+    {
+        for (const QueuedCommand &command : queue)
+        {
+            failedCommands.push_back({command.mCmd, command.mKey, aError});
+        }
+        queue.clear();
+    }
+    mQueuedCommandCount = 0;
+
+    if (mTimerId != 0)
+    {
+        mTaskRunner.Cancel(mTimerId);
+        mTimerId = 0;
+    }
+
+    NotifyFailures(failedCommands);
+}
+
+SpinelCommandScheduler::Counters SpinelCommandScheduler::GetCounters(void) const
+{
+    Counters counters = mCounters;
+
+    counters.mInFlight = 0;
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        counters.mInFlight += IsWaitingResponse(tid) ? 1 : 0;
+    }
+    counters.mQueued = mQueuedCommandCount;
+
+    return counters;
+}
+
+void SpinelCommandScheduler::FreeTid(spinel_tid_t aTid)
+{
+    mTidsInUse &= ~(1 << aTid);
+    mTidsTimedOut &= ~(1 << aTid);
+
+    mCmdTable[aTid]        = SPINEL_CMD_NOOP;
+    mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
+}
+
+void SpinelCommandScheduler::SendQueuedCommands(void)
+{
+    std::vector<FailedCommand> failedCommands;
+
+    SendQueuedCommands(failedCommands);
+    NotifyFailures(failedCommands);
+}
+
+void SpinelCommandScheduler::SendQueuedCommands(std::vector<FailedCommand> &aFailedCommands)
+{
+    for (std::deque<QueuedCommand> &queue : mQueuedCommands)
+    {
+        while (!queue.empty())
+        {
+            spinel_tid_t  tid = AllocateTid();
+            QueuedCommand command;
+            otError       error;
+
+            VerifyOrExit(tid != 0);
+
+            command = std::move(queue.front());
+            queue.pop_front();
+            mQueuedCommandCount--;
+
+            command.mFrame[0] |= tid;
+            error = mSendFrameHandler(command.mFrame.data(), static_cast<uint16_t>(command.mFrame.size()));
+            if (error == OT_ERROR_NONE)
+            {
+                StartTransaction(tid, command.mCmd, command.mKey, command.mDeadline);
+            }
+            else
+            {
+                FreeTid(tid);
+                aFailedCommands.push_back({command.mCmd, command.mKey, error});
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+void SpinelCommandScheduler::ScheduleTimer(Timepoint aDeadline)
+{
+    Timepoint now = Clock::now();
+
+    VerifyOrExit(mTimerId == 0 || aDeadline < mTimerDeadline);
+
+    if (mTimerId != 0)
+    {
+        mTaskRunner.Cancel(mTimerId);
+    }
+
+    mTimerDeadline = aDeadline;
+    // Rounds up so that the timer never fires before the deadline.
+    mTimerId = mTaskRunner.Post(aDeadline > now
+                                    ? std::chrono::duration_cast<Milliseconds>(aDeadline - now) + Milliseconds(1)
+                                    : Milliseconds::zero(),
+                                [this](void) {
+                                    mTimerId = 0;
+                                    HandleTimer();
+                                });
+
+exit:
+    return;
+}
+
+void SpinelCommandScheduler::HandleTimer(void)
+{
+    Timepoint                  now          = Clock::now();
+    Timepoint                  nextDeadline = Timepoint::max();
+    std::vector<FailedCommand> failedCommands;
+
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        if (!IsTidInUse(tid) || mCmdTable[tid] == SPINEL_CMD_NOOP)
+        {
+            continue;
+        }
+
+        if (mDeadlineTable[tid] > now)
+        {
+            nextDeadline = std::min(nextDeadline, mDeadlineTable[tid]);
+        }
+        else if (IsTidTimedOut(tid))
+        {
+            otbrLogWarning("No late response for tid:%u, releasing it", tid);
+            FreeTid(tid);
+        }
+        else
+        {
+            otbrLogWarning("Spinel command (cmd:%u, key:%u) timed out waiting for response, tid:%u", mCmdTable[tid],
+                           mWaitingKeyTable[tid], tid);
+            mCounters.mTimeouts++;
+            failedCommands.push_back({mCmdTable[tid], mWaitingKeyTable[tid], OT_ERROR_RESPONSE_TIMEOUT});
+
+            // Keeps the tid reserved so that a late response can't complete a newer command.
+            mTidsTimedOut |= (1 << tid);
+            mDeadlineTable[tid] = now + kLateResponseTimeout;
+            nextDeadline        = std::min(nextDeadline, mDeadlineTable[tid]);
+        }
+    }
+
+    for (std::deque<QueuedCommand> &queue : mQueuedCommands)
+    {
+        for (auto it = queue.begin(); it != queue.end();)
+        {
+            if (it->mDeadline <= now)
+            {
+                otbrLogWarning("Spinel command (cmd:%u, key:%u) timed out in queue", it->mCmd, it->mKey);
+                mCounters.mTimeouts++;
+                failedCommands.push_back({it->mCmd, it->mKey, OT_ERROR_RESPONSE_TIMEOUT});
+                it = queue.erase(it);
+                mQueuedCommandCount--;
+            }
+            else
+            {
+                nextDeadline = std::min(nextDeadline, it->mDeadline);
+                ++it;
+            }
+        }
+    }
+
+    if (nextDeadline != Timepoint::max())
+    {
+        ScheduleTimer(nextDeadline);
+    }
+
+    SendQueuedCommands(failedCommands);
+    NotifyFailures(failedCommands);
+}
+
+void SpinelCommandScheduler::NotifyFailures(const std::vector<FailedCommand> &aFailedCommands)
+{
+    // Failure handlers may send new commands, so they are invoked after the tables are consistent.
+    for (const FailedCommand &command : aFailedCommands)
+    {
+        mFailureHandler(command.mCmd, command.mKey, command.mError);
+    }
+}
+
+} // namespace Host
+} // namespace otbr
@@ -0,0 +1,272 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the scheduler of Spinel commands sent to the NCP.
+ */
+
+#ifndef OTBR_AGENT_SPINEL_COMMAND_SCHEDULER_HPP_
+#define OTBR_AGENT_SPINEL_COMMAND_SCHEDULER_HPP_
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <openthread/error.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "lib/spinel/spinel.h"
+
+namespace otbr {
+namespace Host {
+
+/**
+ * This class tracks the transaction ids (TIDs) of the Spinel commands sent to the NCP.
+ *
+ * Spinel allows at most `kMaxTids - 1` commands to wait for a response at the same time. Further commands are
+ * queued by priority and sent as soon as a TID becomes free. Each command has a deadline covering both its time
+ * in the queue and its wait for a response.
+ *
+ * The TID of a command which timed out stays reserved until its late response arrives or
+ * `kLateResponseTimeout` passes, so that the late response is never matched against a newer command.
+ */
+class SpinelCommandScheduler : private NonCopyable
+{
+public:
+    static constexpr spinel_tid_t kMaxTids           = 16;
+    static constexpr uint16_t     kMaxQueuedCommands = 256;
+
+    // The time a TID stays reserved for the late response of a timed out command.
+    static constexpr Milliseconds kLateResponseTimeout = Milliseconds(5000);
+
+    /**
+     * This enumeration represents the priority of a Spinel command waiting for a free TID.
+     */
+    enum class Priority : uint8_t
+    {
+        kHigh   = 0, ///< Commands completing an async task, e.g. dataset and enable operations.
+        kNormal = 1, ///< The default priority.
+        kLow    = 2, ///< Bulk traffic, e.g. IPv6 datagrams.
+    };
+
+    /**
+     * This structure represents the counters of the Spinel command scheduler.
+     */
+    struct Counters
+    {
+        uint32_t mInFlight;      ///< The number of commands currently waiting for a response.
+        uint32_t mQueued;        ///< The number of commands currently waiting for a free TID.
+        uint32_t mMaxQueued;     ///< The maximum number of commands ever waiting for a free TID.
+        uint64_t mQueuedTotal;   ///< The number of commands which had to wait for a free TID.
+        uint64_t mTimeouts;      ///< The number of commands failed because no response was received in time.
+        uint64_t mOverflows;     ///< The number of commands rejected because the queue was full.
+        uint64_t mLateResponses; ///< The number of responses dropped because their command had timed out.
+    };
+
+    /**
+     * This function sends an encoded Spinel frame to the NCP.
+     *
+     * @param[in] aFrame   A pointer to the frame.
+     * @param[in] aLength  The length of the frame.
+     *
+     * @returns The error of the send operation.
+     */
+    using SendFrameHandler = std::function<otError(const uint8_t *aFrame, uint16_t aLength)>;
+
+    /**
+     * This function is called when a command fails without a response.
+     *
+     * @param[in] aCmd    The Spinel command.
+     * @param[in] aKey    The property key the command waits for.
+     * @param[in] aError  The reason of the failure.
+     */
+    using FailureHandler = std::function<void(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError)>;
+
+    /**
+     * Constructor.
+     *
+     * @param[in] aTaskRunner        The task runner which runs the deadline timer.
+     * @param[in] aSendFrameHandler  The handler sending the queued frames.
+     * @param[in] aFailureHandler    The handler of the commands failed without a response.
+     */
+    SpinelCommandScheduler(TaskRunner &aTaskRunner, SendFrameHandler aSendFrameHandler, FailureHandler aFailureHandler);
+
+    /**
+     * Destructor.
+     */
+    ~SpinelCommandScheduler(void);
+
+    /**
+     * This method reserves a free TID.
+     *
+     * @returns The reserved TID, or 0 if all TIDs are in use.
+     */
+    spinel_tid_t AllocateTid(void);
+
+    /**
+     * This method starts waiting for the response of a command sent with a reserved TID.
+     *
+     * @param[in] aTid       The TID returned by `AllocateTid()`.
+     * @param[in] aCmd       The Spinel command.
+     * @param[in] aKey       The property key the command waits for.
+     * @param[in] aDeadline  The time by which the response must be received.
+     */
+    void StartTransaction(spinel_tid_t aTid, spinel_command_t aCmd, spinel_prop_key_t aKey, Timepoint aDeadline);
+
+    /**
+     * This method releases a TID once its response is handled or its command could not be sent.
+     *
+     * The queued commands are sent with the released TID.
+     *
+     * @param[in] aTid  The TID to release.
+     */
+    void ReleaseTid(spinel_tid_t aTid);
+
+    /**
+     * This method indicates whether a command is waiting for a response with a given TID.
+     *
+     * @param[in] aTid  The TID.
+     *
+     * @returns Whether a command is waiting for a response with @p aTid.
+     */
+    bool IsWaitingResponse(spinel_tid_t aTid) const;
+
+    /**
+     * This method handles a response for a TID which no command is waiting for.
+     *
+     * If the command of the TID timed out, the TID is released.
+     *
+     * @param[in] aTid  The TID of the response.
+     *
+     * @returns Whether the response is the late response of a timed out command.
+     */
+    bool HandleLateResponse(spinel_tid_t aTid);
+
+    /**
+     * This method returns the command waiting for a response with a given TID.
+     *
+     * @param[in] aTid  The TID.
+     *
+     * @returns The Spinel command, or `SPINEL_CMD_NOOP` if the TID is not in use.
+     */
+    spinel_command_t GetCommand(spinel_tid_t aTid) const { return mCmdTable[aTid]; }
+
+    /**
+     * This method returns the property key waiting for a response with a given TID.
+     *
+     * @param[in] aTid  The TID.
+     *
+     * @returns The property key, or `SPINEL_PROP_LAST_STATUS` if the TID is not in use.
+     */
+    spinel_prop_key_t GetWaitingKey(spinel_tid_t aTid) const { return mWaitingKeyTable[aTid]; }
+
+    /**
+     * This method queues an encoded command until a TID becomes free.
+     *
+     * @param[in] aFrame     The encoded frame, with the TID left zero in the header.
+     * @param[in] aCmd       The Spinel command.
+     * @param[in] aKey       The property key the command waits for.
+     * @param[in] aPriority  The priority of the command.
+     * @param[in] aDeadline  The time by which the response must be received.
+     *
+     * @retval OT_ERROR_NONE  Successfully queued the command.
+     * @retval OT_ERROR_BUSY  The queue is full.
+     */
+    otError Enqueue(std::vector<uint8_t> aFrame,
+                    spinel_command_t     aCmd,
+                    spinel_prop_key_t    aKey,
+                    Priority             aPriority,
+                    Timepoint            aDeadline);
+
+    /**
+     * This method fails all the queued commands and the commands waiting for a response, and releases all TIDs.
+     *
+     * @param[in] aError  The error passed to the failure handler.
+     */
+    void Abort(otError aError);
+
+    /**
+     * This method returns the counters of the scheduler.
+     *
+     * @returns The counters.
+     */
+    Counters GetCounters(void) const;
+
+private:
+    static constexpr uint8_t kNumPriorities = 3;
+
+    struct QueuedCommand
+    {
+        spinel_command_t     mCmd;
+        spinel_prop_key_t    mKey;
+        Timepoint            mDeadline;
+        std::vector<uint8_t> mFrame; ///< The encoded frame, with the TID left zero in the header.
+    };
+
+    struct FailedCommand
+    {
+        spinel_command_t  mCmd;
+        spinel_prop_key_t mKey;
+        otError           mError;
+    };
+
+    bool IsTidInUse(spinel_tid_t aTid) const { return (mTidsInUse & (1 << aTid)) != 0; }
+    bool IsTidTimedOut(spinel_tid_t aTid) const { return (mTidsTimedOut & (1 << aTid)) != 0; }
+    void FreeTid(spinel_tid_t aTid);
+    void SendQueuedCommands(std::vector<FailedCommand> &aFailedCommands);
+    void SendQueuedCommands(void);
+    void ScheduleTimer(Timepoint aDeadline);
+    void HandleTimer(void);
+    void NotifyFailures(const std::vector<FailedCommand> &aFailedCommands);
+
+    TaskRunner      &mTaskRunner;
+    SendFrameHandler mSendFrameHandler;
+    FailureHandler   mFailureHandler;
+
+    uint16_t     mTidsInUse;    ///< The reserved TIDs, including the timed out ones.
+    uint16_t     mTidsTimedOut; ///< The TIDs reserved for the late response of a timed out command.
+    spinel_tid_t mNextTid;
+
+    spinel_prop_key_t mWaitingKeyTable[kMaxTids]; ///< The property keys of ongoing transactions.
+    spinel_command_t  mCmdTable[kMaxTids];        ///< The commands of ongoing transactions.
+    Timepoint         mDeadlineTable[kMaxTids];   ///< The response deadlines, or the late response deadlines.
+
+    std::deque<QueuedCommand> mQueuedCommands[kNumPriorities];
+    uint32_t                  mQueuedCommandCount;
+    TaskRunner::TaskId        mTimerId;
+    Timepoint                 mTimerDeadline;
+    Counters                  mCounters;
+};
+
+} // namespace Host
+} // namespace otbr
+
+#endif // OTBR_AGENT_SPINEL_COMMAND_SCHEDULER_HPP_
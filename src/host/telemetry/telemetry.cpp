@@ -33,6 +33,7 @@
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 
 #include <net/if.h>
+#include <string.h>
 
 #include <openthread/border_agent.h>
 #include <openthread/border_routing.h>
@@ -55,6 +56,7 @@
 #include <lib/spinel/radio_spinel_metrics.h>
 
 #include "common/code_utils.hpp"
+#include "common/log_rate_limiter.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
 #include "utils/sha256.hpp"
@@ -217,10 +219,26 @@ exit:
 
 otError TelemetryRetriever::RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
                                                   threadnetwork::TelemetryData &telemetryData)
+{
+    DeferredData deferredData;
+    otError      error = RetrieveTelemetryData(aPublisher, telemetryData, deferredData);
+
+    CompleteTelemetryData(deferredData, telemetryData);
+
+    return error;
+}
+
+otError TelemetryRetriever::RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                                  threadnetwork::TelemetryData &telemetryData,
+                                                  DeferredData                 &aDeferredData)
 {
     otError                     error = OT_ERROR_NONE;
     std::vector<otNeighborInfo> neighborTable;
 
+#if (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
+    memcpy(aDeferredData.mSalt, mNat64PdCommonSalt, sizeof(aDeferredData.mSalt));
+#endif
+
     // Begin of WpanStats section.
     auto wpanStats = telemetryData.mutable_wpan_stats();
 
@@ -700,9 +718,8 @@ otError TelemetryRetriever::RetrieveTelemetryData(Mdns::Publisher              *
         {
             otNat64AddressMappingIterator iterator;
             otNat64AddressMapping         otMapping;
-            Sha256::Hash                  hash;
-            Sha256                        sha256;
 
+            aDeferredData.mNat64MappingAddresses.clear();
             otNat64InitAddressMappingIterator(mInstance, &iterator);
             while (otNat64GetNextAddressMapping(mInstance, &iterator, &otMapping) == OT_ERROR_NONE)
             {
@@ -714,20 +731,15 @@ otError TelemetryRetriever::RetrieveTelemetryData(Mdns::Publisher              *
                 CopyNat64TrafficCounters(otMapping.mCounters.mUdp, nat64MappingCounters->mutable_udp());
                 CopyNat64TrafficCounters(otMapping.mCounters.mIcmp, nat64MappingCounters->mutable_icmp());
 
-                sha256.Start();
-                sha256.Update(otMapping.mIp6.mFields.m8, sizeof(otMapping.mIp6.mFields.m8));
-                sha256.Update(mNat64PdCommonSalt, sizeof(mNat64PdCommonSalt));
-                sha256.Finish(hash);
-
-                nat64Mapping->mutable_hashed_ipv6_address()->append(reinterpret_cast<const char *>(hash.GetBytes()),
-                                                                    Sha256::Hash::kSize);
+                // The hashed IPv6 address is set by CompleteTelemetryData().
+                aDeferredData.mNat64MappingAddresses.push_back(otMapping.mIp6);
                 // Remaining time is not included in the telemetry
             }
         }
         // End of Nat64Mapping section.
 #endif // OTBR_ENABLE_NAT64
 #if OTBR_ENABLE_DHCP6_PD
-        RetrievePdInfo(wpanBorderRouter);
+        RetrievePdInfo(wpanBorderRouter, aDeferredData);
 #endif // OTBR_ENABLE_DHCP6_PD
 #if OTBR_ENABLE_BORDER_AGENT
         RetrieveBorderAgentInfo(wpanBorderRouter->mutable_border_agent_info());
@@ -826,9 +838,62 @@ otError TelemetryRetriever::RetrieveTelemetryData(Mdns::Publisher              *
     }
 #endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
 
+    {
+        // Begin of LoggingInfo section.
+        auto                 loggingInfo = telemetryData.mutable_logging_info();
+        otbrLogAsyncCounters asyncCounters;
+
+        otbrLogGetAsyncCounters(asyncCounters);
+        loggingInfo->set_async_written_count(asyncCounters.mWritten);
+        loggingInfo->set_async_dropped_count(asyncCounters.mDropped);
+        loggingInfo->set_async_truncated_count(asyncCounters.mTruncated);
+        loggingInfo->set_rate_limited_suppressed_count(LogRateLimiter::GetTotalSuppressedCount());
+
+        for (const LogRateLimiter::SiteCounter &site : LogRateLimiter::GetSiteCounters())
+        {
+            auto entry = loggingInfo->add_suppressed_sites();
+
+            entry->set_location(site.mLocation);
+            entry->set_suppressed_count(site.mSuppressedCount);
+        }
+        // End of LoggingInfo section.
+    }
+
     return error;
 }
 
+void TelemetryRetriever::CompleteTelemetryData(const DeferredData           &aDeferredData,
+                                               threadnetwork::TelemetryData &aTelemetryData)
+{
+#if OTBR_ENABLE_NAT64
+    // The NAT64 mappings were added in the same order as their addresses were recorded.
+    for (int i = 0; i < aTelemetryData.wpan_border_router().nat64_mappings_size() &&
+                    static_cast<size_t>(i) < aDeferredData.mNat64MappingAddresses.size();
+         i++)
+    {
+        const otIp6Address &address = aDeferredData.mNat64MappingAddresses[i];
+        Sha256::Hash        hash;
+        Sha256              sha256;
+
+        sha256.Start();
+        sha256.Update(address.mFields.m8, sizeof(address.mFields.m8));
+        sha256.Update(aDeferredData.mSalt, sizeof(aDeferredData.mSalt));
+        sha256.Finish(hash);
+
+        aTelemetryData.mutable_wpan_border_router()->mutable_nat64_mappings(i)->mutable_hashed_ipv6_address()->assign(
+            reinterpret_cast<const char *>(hash.GetBytes()), Sha256::Hash::kSize);
+    }
+#endif // OTBR_ENABLE_NAT64
+#if OTBR_ENABLE_DHCP6_PD
+    if (aDeferredData.mHasPdPrefix)
+    {
+        ComputeHashedPdPrefix(aDeferredData, aTelemetryData.mutable_wpan_border_router()->mutable_hashed_pd_prefix());
+    }
+#endif
+    OTBR_UNUSED_VARIABLE(aDeferredData);
+    OTBR_UNUSED_VARIABLE(aTelemetryData);
+}
+
 #if OTBR_ENABLE_BORDER_ROUTING
 void TelemetryRetriever::RetrieveInfraLinkInfo(threadnetwork::TelemetryData::InfraLinkInfo &aInfraLinkInfo)
 {
@@ -907,34 +972,40 @@ void TelemetryRetriever::RetrieveExternalRouteInfo(threadnetwork::TelemetryData:
 #endif // OTBR_ENABLE_BORDER_ROUTING
 
 #if OTBR_ENABLE_DHCP6_PD
-void TelemetryRetriever::RetrievePdInfo(threadnetwork::TelemetryData::WpanBorderRouter *aWpanBorderRouter)
+void TelemetryRetriever::RetrievePdInfo(threadnetwork::TelemetryData::WpanBorderRouter *aWpanBorderRouter,
+                                        DeferredData                                 &aDeferredData)
 {
+    otBorderRoutingPrefixTableEntry prefixInfo;
+
     aWpanBorderRouter->set_dhcp6_pd_state(Dhcp6PdStateFromOtDhcp6PdState(otBorderRoutingDhcp6PdGetState(mInstance)));
-    RetrieveHashedPdPrefix(aWpanBorderRouter->mutable_hashed_pd_prefix());
+
+    // The hashed PD prefix is set by CompleteTelemetryData().
+    aDeferredData.mHasPdPrefix = otBorderRoutingGetPdOmrPrefix(mInstance, &prefixInfo) == OT_ERROR_NONE;
+    if (aDeferredData.mHasPdPrefix)
+    {
+        aDeferredData.mPdPrefix = prefixInfo.mPrefix;
+    }
+
     RetrievePdProcessedRaInfo(aWpanBorderRouter->mutable_pd_processed_ra_info());
 }
 
-void TelemetryRetriever::RetrieveHashedPdPrefix(std::string *aHashedPdPrefix)
+void TelemetryRetriever::ComputeHashedPdPrefix(const DeferredData &aDeferredData, std::string *aHashedPdPrefix)
 {
-    otBorderRoutingPrefixTableEntry aPrefixInfo;
-    const uint8_t                  *prefixAddr          = nullptr;
-    const uint8_t                  *truncatedHash       = nullptr;
-    constexpr size_t                kHashPrefixLength   = 6;
-    constexpr size_t                kHashedPrefixLength = 2;
-    std::vector<uint8_t>            hashedPdHeader      = {0x20, 0x01, 0x0d, 0xb8};
-    std::vector<uint8_t>            hashedPdTailer      = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    std::vector<uint8_t>            hashedPdPrefix;
+    const uint8_t       *prefixAddr          = aDeferredData.mPdPrefix.mPrefix.mFields.m8;
+    const uint8_t       *truncatedHash       = nullptr;
+    constexpr size_t     kHashPrefixLength   = 6;
+    constexpr size_t     kHashedPrefixLength = 2;
+    std::vector<uint8_t> hashedPdHeader      = {0x20, 0x01, 0x0d, 0xb8};
+    std::vector<uint8_t> hashedPdTailer      = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    std::vector<uint8_t> hashedPdPrefix;
     hashedPdPrefix.reserve(16);
     Sha256       sha256;
     Sha256::Hash hash;
 
-    SuccessOrExit(otBorderRoutingGetPdOmrPrefix(mInstance, &aPrefixInfo));
-    prefixAddr = aPrefixInfo.mPrefix.mPrefix.mFields.m8;
-
     // TODO: Put below steps into a reusable function.
     sha256.Start();
     sha256.Update(prefixAddr, kHashPrefixLength);
-    sha256.Update(mNat64PdCommonSalt, kNat64PdCommonHashSaltLength);
+    sha256.Update(aDeferredData.mSalt, kNat64PdCommonHashSaltLength);
     sha256.Finish(hash);
 
     // Append hashedPdHeader
@@ -952,9 +1023,6 @@ void TelemetryRetriever::RetrieveHashedPdPrefix(std::string *aHashedPdPrefix)
     hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdTailer.begin(), hashedPdTailer.end());
 
     aHashedPdPrefix->append(reinterpret_cast<const char *>(hashedPdPrefix.data()), hashedPdPrefix.size());
-
-exit:
-    return;
 }
 
 void TelemetryRetriever::RetrievePdProcessedRaInfo(threadnetwork::TelemetryData::PdProcessedRaInfo *aPdProcessedRaInfo)
@@ -33,7 +33,10 @@
 
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 
+#include <vector>
+
 #include <openthread/instance.h>
+#include <openthread/ip6.h>
 
 #include "mdns/mdns.hpp"
 #include "proto/thread_telemetry.pb.h"
@@ -46,6 +49,10 @@ namespace Host {
 class TelemetryRetriever
 {
 public:
+#if (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
+    static constexpr uint8_t kNat64PdCommonHashSaltLength = 16;
+#endif
+
     /**
      * Constructor.
      *
@@ -67,15 +74,59 @@ public:
      */
     otError RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData);
 
+    /**
+     * This structure holds the inputs of the telemetry fields which are derived from a snapshot of the
+     * OpenThread state but do not access it, so they can be computed off the mainloop.
+     */
+    struct DeferredData
+    {
+#if (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
+        uint8_t mSalt[kNat64PdCommonHashSaltLength]; ///< The salt of the hashed addresses and prefixes.
+#endif
+#if OTBR_ENABLE_NAT64
+        std::vector<otIp6Address> mNat64MappingAddresses; ///< The IPv6 address of each NAT64 mapping, in order.
+#endif
+#if OTBR_ENABLE_DHCP6_PD
+        bool        mHasPdPrefix = false; ///< Whether `mPdPrefix` is valid.
+        otIp6Prefix mPdPrefix;            ///< The DHCPv6 PD OMR prefix.
+#endif
+    };
+
+    /**
+     * This method populates the telemetry data like the method above, except that the fields computed from
+     * @p aDeferredData are left to `CompleteTelemetryData()`.
+     *
+     * @param[in]  aPublisher     The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
+     * @param[in]  telemetryData  The telemetry data to be populated.
+     * @param[out] aDeferredData  The inputs of the deferred telemetry fields.
+     *
+     * @retval OT_ERROR_NONE    There is no error happened in the process.
+     * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
+     */
+    otError RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                  threadnetwork::TelemetryData &telemetryData,
+                                  DeferredData                 &aDeferredData);
+
+    /**
+     * This method populates the deferred telemetry fields, such as the hashed NAT64 addresses and PD prefix.
+     *
+     * It does not access the OpenThread instance, so it may be called from any thread.
+     *
+     * @param[in] aDeferredData  The inputs collected by `RetrieveTelemetryData()`.
+     * @param[in] aTelemetryData The telemetry data returned by the same `RetrieveTelemetryData()` call.
+     */
+    static void CompleteTelemetryData(const DeferredData &aDeferredData, threadnetwork::TelemetryData &aTelemetryData);
+
 private:
 #if OTBR_ENABLE_BORDER_ROUTING
     void RetrieveInfraLinkInfo(threadnetwork::TelemetryData::InfraLinkInfo &aInfraLinkInfo);
     void RetrieveExternalRouteInfo(threadnetwork::TelemetryData::ExternalRoutes &aExternalRouteInfo);
 #endif
 #if OTBR_ENABLE_DHCP6_PD
-    void RetrievePdInfo(threadnetwork::TelemetryData::WpanBorderRouter *aWpanBorderRouter);
-    void RetrieveHashedPdPrefix(std::string *aHashedPdPrefix);
-    void RetrievePdProcessedRaInfo(threadnetwork::TelemetryData::PdProcessedRaInfo *aPdProcessedRaInfo);
+    void        RetrievePdInfo(threadnetwork::TelemetryData::WpanBorderRouter *aWpanBorderRouter,
+                               DeferredData                                 &aDeferredData);
+    static void ComputeHashedPdPrefix(const DeferredData &aDeferredData, std::string *aHashedPdPrefix);
+    void        RetrievePdProcessedRaInfo(threadnetwork::TelemetryData::PdProcessedRaInfo *aPdProcessedRaInfo);
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
     void RetrieveBorderAgentInfo(threadnetwork::TelemetryData::BorderAgentInfo *aBorderAgentInfo);
@@ -83,8 +134,7 @@ private:
 
     otInstance *mInstance;
 #if (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
-    static constexpr uint8_t kNat64PdCommonHashSaltLength = 16;
-    uint8_t                  mNat64PdCommonSalt[kNat64PdCommonHashSaltLength];
+    uint8_t mNat64PdCommonSalt[kNat64PdCommonHashSaltLength];
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
     otbr::TelemetryRetriever::BorderAgent mTelemetryRetrieverBorderAgent;
@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TLM"
+
+#include "telemetry_retriever_netif.hpp"
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+
+namespace otbr {
+namespace TelemetryRetriever {
+
+static void RetrieveDirectionCounters(const Netif::DirectionCounters                       &aCounters,
+                                      threadnetwork::TelemetryData::NetifDirectionCounters *aDirectionCounters)
+{
+    aDirectionCounters->set_packets(aCounters.mPackets);
+    aDirectionCounters->set_bytes(aCounters.mBytes);
+
+    for (uint32_t count : aCounters.mLatencyHistogram)
+    {
+        aDirectionCounters->add_latency_histogram(count);
+    }
+}
+
+static void RetrievePoolCounters(const PacketBufferPool::Counters                       &aCounters,
+                                 threadnetwork::TelemetryData::PacketBufferPoolCounters *aPoolCounters)
+{
+    aPoolCounters->set_allocations(aCounters.mAllocations);
+    aPoolCounters->set_failures(aCounters.mFailures);
+    aPoolCounters->set_in_use(aCounters.mInUse);
+    aPoolCounters->set_max_in_use(aCounters.mMaxInUse);
+    aPoolCounters->set_created_buffers(aCounters.mCreatedBuffers);
+}
+
+void RetrieveNetifInfo(const Netif &aNetif, threadnetwork::TelemetryData::NetifInfo *aNetifInfo)
+{
+    const Netif::Counters              counters      = aNetif.GetCounters();
+    const Netif::Ip6SendBatchCounters &batchCounters = aNetif.GetIp6SendBatchCounters();
+    auto                               ip6SendBatch  = aNetifInfo->mutable_ip6_send_batch();
+
+    RetrieveDirectionCounters(counters.mToThread, aNetifInfo->mutable_to_thread());
+    RetrieveDirectionCounters(counters.mFromThread, aNetifInfo->mutable_from_thread());
+    aNetifInfo->set_oversize_drops(counters.mOversizeDrops);
+    aNetifInfo->set_tun_write_drops(counters.mTunWriteDrops);
+    aNetifInfo->set_no_buffer_drops(counters.mNoBufferDrops);
+    aNetifInfo->set_send_drops(counters.mSendDrops);
+    aNetifInfo->set_ra_intercepted_count(counters.mRaIntercepted);
+    aNetifInfo->set_datapath_throttle_count(counters.mThrottles);
+
+    ip6SendBatch->set_batches(batchCounters.mBatches);
+    ip6SendBatch->set_packets(batchCounters.mPackets);
+    ip6SendBatch->set_full_batches(batchCounters.mFullBatches);
+    ip6SendBatch->set_send_failures(batchCounters.mSendFailures);
+    ip6SendBatch->set_max_batch_size(batchCounters.mMaxBatchSize);
+
+    RetrievePoolCounters(aNetif.GetIp6SendPoolCounters(), aNetifInfo->mutable_ip6_send_pool());
+    RetrievePoolCounters(aNetif.GetIp6ReceivePoolCounters(), aNetifInfo->mutable_ip6_receive_pool());
+}
+
+} // namespace TelemetryRetriever
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
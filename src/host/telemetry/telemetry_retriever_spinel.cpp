@@ -0,0 +1,53 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TLM"
+
+#include "telemetry_retriever_spinel.hpp"
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+
+namespace otbr {
+namespace TelemetryRetriever {
+
+void RetrieveSpinelCommandCounters(const Host::SpinelCommandScheduler::Counters        &aCounters,
+                                   threadnetwork::TelemetryData::SpinelCommandCounters *aSpinelCommandCounters)
+{
+    aSpinelCommandCounters->set_in_flight(aCounters.mInFlight);
+    aSpinelCommandCounters->set_queued(aCounters.mQueued);
+    aSpinelCommandCounters->set_max_queued(aCounters.mMaxQueued);
+    aSpinelCommandCounters->set_queued_total(aCounters.mQueuedTotal);
+    aSpinelCommandCounters->set_timeouts(aCounters.mTimeouts);
+    aSpinelCommandCounters->set_overflows(aCounters.mOverflows);
+    aSpinelCommandCounters->set_late_responses(aCounters.mLateResponses);
+}
+
+} // namespace TelemetryRetriever
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
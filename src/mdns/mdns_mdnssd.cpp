@@ -47,6 +47,7 @@
 #include <string.h>
 
 #include "common/code_utils.hpp"
+#include "common/log_rate_limiter.hpp"
 #include "common/logging.hpp"
 #include "common/time.hpp"
 #include "utils/dns_utils.hpp"
@@ -425,8 +426,8 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
         if (error != kDNSServiceErr_NoError)
         {
             otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
-            otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
-                    DNSErrorToString(error), serviceRef);
+            otbrLogRateLimited(logLevel, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
+                               DNSErrorToString(error), serviceRef);
         }
         if (error == kDNSServiceErr_ServiceNotRunning)
         {
@@ -81,8 +81,9 @@ public:
 
     // Implementation of MainloopProcessor.
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "PublisherMDnsSd"; }
 
 protected:
     otbrError PublishServiceImpl(const std::string &aHostName,
@@ -388,7 +389,7 @@ private:
 
     std::vector<DNSServiceRef> mServiceRefsToProcess;
 
-    TaskRunner mTaskRunner;
+    TaskRunner mTaskRunner{"PublisherMDnsSd.TaskRunner"};
 };
 
 /**
@@ -1061,6 +1061,45 @@ std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
     return ret;
 }
 
+static cJSON *MainloopProcessorStats2Json(const MainloopProcessorStats &aStats)
+{
+    cJSON *stats     = cJSON_CreateObject();
+    cJSON *histogram = cJSON_CreateArray();
+
+    for (uint32_t count : aStats.mProcessTimeHistogram)
+    {
+        cJSON_AddItemToArray(histogram, cJSON_CreateNumber(count));
+    }
+
+    cJSON_AddItemToObject(stats, KEY_NAME, cJSON_CreateString(aStats.mName.c_str()));
+    cJSON_AddItemToObject(stats, KEY_ITERATIONS, cJSON_CreateNumber(aStats.mIterations));
+    cJSON_AddItemToObject(stats, KEY_WAKEUPS, cJSON_CreateNumber(aStats.mWakeups));
+    cJSON_AddItemToObject(stats, KEY_TASKSRUN, cJSON_CreateNumber(aStats.mTasksRun));
+    cJSON_AddItemToObject(stats, KEY_UPDATETIME, cJSON_CreateNumber(aStats.mUpdateTimeUs));
+    cJSON_AddItemToObject(stats, KEY_PROCESSTIME, cJSON_CreateNumber(aStats.mProcessTimeUs));
+    cJSON_AddItemToObject(stats, KEY_MAXPROCESSTIME, cJSON_CreateNumber(aStats.mMaxProcessTimeUs));
+    cJSON_AddItemToObject(stats, KEY_FDCOUNT, cJSON_CreateNumber(aStats.mFdCount));
+    cJSON_AddItemToObject(stats, KEY_PROCESSTIMEHISTOGRAM, histogram);
+
+    return stats;
+}
+
+std::string MainloopStats2JsonString(const std::vector<MainloopProcessorStats> &aStats)
+{
+    cJSON      *stats = cJSON_CreateArray();
+    std::string ret;
+
+    for (const MainloopProcessorStats &processorStats : aStats)
+    {
+        cJSON_AddItemToArray(stats, MainloopProcessorStats2Json(processorStats));
+    }
+
+    ret = Json2String(stats);
+    cJSON_Delete(stats);
+
+    return ret;
+}
+
 std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
 {
     cJSON      *macCounters = MacCounters2Json(aMacCounters);
@@ -1081,6 +1120,22 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
     return ret;
 }
 
+std::string StringArray2JsonString(const std::vector<std::string> &aStrings)
+{
+    cJSON      *strings = cJSON_CreateArray();
+    std::string ret;
+
+    for (const std::string &string : aStrings)
+    {
+        cJSON_AddItemToArray(strings, cJSON_CreateString(string.c_str()));
+    }
+
+    ret = Json2String(strings);
+    cJSON_Delete(strings);
+
+    return ret;
+}
+
 std::string CString2JsonString(const char *aCString)
 {
     cJSON      *cString = CString2Json(aCString);
@@ -43,6 +43,7 @@
 #include <openthread/link.h>
 #include <openthread/thread_ftd.h>
 
+#include "common/mainloop_manager.hpp"
 #include "common/types.hpp"
 #include "rest/names.hpp"
 #include "rest/types.hpp"
@@ -109,6 +110,15 @@ std::string CString2JsonString(const char *aCString);
  */
 std::string String2JsonString(const std::string &aString);
 
+/**
+ * This method formats strings to a Json array and serialize it to a string.
+ *
+ * @param[in] aStrings  The strings.
+ *
+ * @returns A string of serialized Json array.
+ */
+std::string StringArray2JsonString(const std::vector<std::string> &aStrings);
+
 /**
  * This method parses a Json string and checks its datatype and returns a string if it is a string.
  *
@@ -306,6 +316,15 @@ std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData);
  */
 std::string LeaderData2JsonString(const otLeaderData &aLeaderData);
 
+/**
+ * This method formats the statistics of mainloop processors to a Json array and serialize it to a string.
+ *
+ * @param[in] aStats  The statistics of mainloop processors.
+ *
+ * @returns A string of serialized Json array.
+ */
+std::string MainloopStats2JsonString(const std::vector<MainloopProcessorStats> &aStats);
+
 /**
  * This method formats a MacCounters object to a Json object and serialize it to a string.
  *
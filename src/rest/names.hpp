@@ -84,6 +84,7 @@
 #define KEY_EXTADDRESS "extAddress" // 64-bit MAC address
 #define KEY_EXTERNALCOMMISSIONING "externalCommissioning"
 #define KEY_EXTPANID "extPanId"
+#define KEY_FDCOUNT "fdCount"
 #define KEY_FRAMEERRORRATE "frameErrorRate"
 #define KEY_FULLNETWORKDATA "fullNetworkData"
 #define KEY_HOSTNAME "hostname"
@@ -104,6 +105,7 @@
 #define KEY_ISFTD "fullThreadDevice"
 #define KEY_ISLEADER "isLeader"
 #define KEY_ISPBBR "isPrimaryBBR"
+#define KEY_ITERATIONS "iterations"
 #define KEY_JOINERID "joinerId"
 #define KEY_LASTRSSI "lastRssi"
 #define KEY_LDEVIDSUBJECT "lDevIdSubject" // LDevID subject public key info
@@ -123,6 +125,7 @@
 #define KEY_LINKQUALITYOUT "linkQualityOut"
 #define KEY_MACCOUNTERS "macCounters"
 #define KEY_MAXCHILDTIMEOUT "maxChildTimeout"
+#define KEY_MAXPROCESSTIME "maxProcessTimeUs"
 #define KEY_MAXRSSI "maxRssi"
 #define KEY_MAX_AGE "maxAge"
 #define KEY_MAX_RETRIES "maxRetries"
@@ -132,6 +135,7 @@
 #define KEY_MLECOUNTERS "mleCounters"
 #define KEY_MLEIDIID "mlEidIid"
 #define KEY_MODE "mode"
+#define KEY_NAME "name"
 #define KEY_NATIVECOMMISSIONING "nativeCommissioning"
 #define KEY_NETWORKDATA "networkData"
 #define KEY_NETWORKKEY "networkKey"
@@ -150,6 +154,8 @@
 #define KEY_PENDING "pending"
 #define KEY_PENDINGTIMESTAMP "pendingTimestamp"
 #define KEY_PERIOD "period"
+#define KEY_PROCESSTIME "processTimeUs"
+#define KEY_PROCESSTIMEHISTOGRAM "processTimeHistogram"
 #define KEY_PSKC "pskc"
 #define KEY_PSKD "pskd"
 #define KEY_QUEUEDMESSAGECOUNT "queuedMessageCount"
@@ -190,6 +196,7 @@
 #define KEY_SUPERVISIONINTERVAL "supervisionInterval"
 #define KEY_SUPPLYVOLTAGE "supplyVoltage" // Current supply voltage
 #define KEY_SUPPORTSERRORRATE "supportsErrorRate"
+#define KEY_TASKSRUN "tasksRun"
 #define KEY_THREADSTACKVERSION "threadStackVersion"
 #define KEY_THREADVERSION "threadVersion"
 #define KEY_TICKS "ticks"
@@ -200,9 +207,11 @@
 #define KEY_TOTALTRACKINGTIME "totalTrackingTime"
 #define KEY_TYPE "type"
 #define KEY_TYPES "types"
+#define KEY_UPDATETIME "updateTimeUs"
 #define KEY_VENDORMODEL "vendorModel"
 #define KEY_VENDORNAME "vendorName"
 #define KEY_VENDORSWVERSION "vendorSwVersion" // Vendor software version
+#define KEY_WAKEUPS "wakeups"
 #define KEY_WEIGHTING "weighting"
 #define NETWORK_DIAG_ACTION_TYPE_NAME "getNetworkDiagnosticTask"
 #define RESET_DIAG_COUNTERS_ACTION_TYPE_NAME "resetNetworkDiagCounterTask"
@@ -48,6 +48,8 @@
 #endif
 
 #include "common/api_strings.hpp"
+#include "common/flight_recorder.hpp"
+#include "common/mainloop_manager.hpp"
 #include "rest/json.hpp"
 
 #include "rest/actions_list.hpp" // Actions Collection
@@ -91,6 +93,8 @@
 #define OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER "/node/commissioner/joiner"
 #define OT_REST_RESOURCE_PATH_NODE_COPROCESSOR "/node/coprocessor"
 #define OT_REST_RESOURCE_PATH_NODE_COPROCESSOR_VERSION "/node/coprocessor/version"
+#define OT_REST_RESOURCE_PATH_NODE_MAINLOOP_STATS "/node/mainloop-stats"
+#define OT_REST_RESOURCE_PATH_NODE_FLIGHT_RECORDER "/node/flight-recorder"
 #define OT_REST_RESOURCE_PATH_NODE_BA_EPSKC_STATE "/node/ba-epskc/state"
 #define OT_REST_RESOURCE_PATH_NODE_BA_EPSKC_KEY "/node/ba-epskc/key"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
@@ -176,6 +180,8 @@ RestWebServer::RestWebServer(Host::RcpHost &aHost)
     mServer.Delete(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER, MakeHandler(&RestWebServer::CommissionerJoiner));
     mServer.Options(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER, MakeHandler(&RestWebServer::CommissionerJoiner));
     mServer.Get(OT_REST_RESOURCE_PATH_NODE_COPROCESSOR_VERSION, MakeHandler(&RestWebServer::CoprocessorVersion));
+    mServer.Get(OT_REST_RESOURCE_PATH_NODE_MAINLOOP_STATS, MakeHandler(&RestWebServer::MainloopStats));
+    mServer.Get(OT_REST_RESOURCE_PATH_NODE_FLIGHT_RECORDER, MakeHandler(&RestWebServer::FlightRecorder));
 
 #if OTBR_ENABLE_EPSKC
     mServer.Get(OT_REST_RESOURCE_PATH_NODE_BA_EPSKC_STATE, MakeHandler(&RestWebServer::EpskcState));
@@ -1084,6 +1090,50 @@ void RestWebServer::CoprocessorVersion(const Request &aRequest, Response &aRespo
     }
 }
 
+void RestWebServer::GetMainloopStats(Response &aResponse) const
+{
+    std::string body;
+
+    // The statistics are updated by the mainloop, take the snapshot there to avoid racing with it.
+    body = RunInMainLoop(
+        []() { return Json::MainloopStats2JsonString(MainloopManager::GetInstance().GetProcessorStats()); });
+
+    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
+    aResponse.status = StatusCode::OK_200;
+}
+
+void RestWebServer::MainloopStats(const Request &aRequest, Response &aResponse) const
+{
+    if (GetMethod(aRequest) == HttpMethod::kGet)
+    {
+        GetMainloopStats(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, StatusCode::MethodNotAllowed_405);
+    }
+}
+
+void RestWebServer::GetFlightRecorder(Response &aResponse) const
+{
+    // The flight recorder can be dumped from any thread.
+    aResponse.set_content(Json::StringArray2JsonString(otbr::FlightRecorder::GetInstance().Dump()),
+                          OT_REST_CONTENT_TYPE_JSON);
+    aResponse.status = StatusCode::OK_200;
+}
+
+void RestWebServer::FlightRecorder(const Request &aRequest, Response &aResponse) const
+{
+    if (GetMethod(aRequest) == HttpMethod::kGet)
+    {
+        GetFlightRecorder(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, StatusCode::MethodNotAllowed_405);
+    }
+}
+
 #if OTBR_ENABLE_EPSKC
 void RestWebServer::GetEpskcState(Response &aResponse) const
 {
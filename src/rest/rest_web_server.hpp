@@ -116,6 +116,8 @@ private:
     void CommissionerJoiner(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse);
     void CoprocessorVersion(const Request &aRequest, Response &aResponse) const;
+    void MainloopStats(const Request &aRequest, Response &aResponse) const;
+    void FlightRecorder(const Request &aRequest, Response &aResponse) const;
     void GetNodeInfo(Response &aResponse) const;
     void DeleteNodeInfo(Response &aResponse) const;
     void GetDataBaId(Response &aResponse) const;
@@ -136,6 +138,8 @@ private:
     void AddJoiner(const Request &aRequest, Response &aResponse) const;
     void RemoveJoiner(const Request &aRequest, Response &aResponse) const;
     void GetCoprocessorVersion(Response &aResponse) const;
+    void GetMainloopStats(Response &aResponse) const;
+    void GetFlightRecorder(Response &aResponse) const;
 
 #if OTBR_ENABLE_EPSKC
     void EpskcState(const Request &aRequest, Response &aResponse) const;
@@ -184,7 +188,10 @@ private:
     template <typename Call, typename... Args>
     auto RunInMainLoop(Call aCall, Args... aArgs) const -> decltype(aCall(aArgs...))
     {
-        return mHost.GetTaskRunner().PostAndWait<decltype(aCall(aArgs...))>([&]() { return aCall(aArgs...); });
+        // REST requests are management work and must not delay latency-sensitive tasks.
+        return mHost.GetTaskRunner().PostAndWait<decltype(aCall(aArgs...))>([&]() { return aCall(aArgs...); },
+                                                                             Milliseconds::zero(),
+                                                                             TaskRunner::Priority::kLow);
     }
 
     template <typename Call, typename... Args>
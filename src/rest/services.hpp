@@ -61,8 +61,9 @@ public:
 
     void Init(otInstance *aInstance);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "RestServices"; }
 
     /**
      * Attempts to convert a address string to an IPv6 address.
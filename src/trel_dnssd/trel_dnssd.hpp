@@ -179,7 +179,7 @@ private:
 
     Mdns::Publisher &mPublisher;
     Host::RcpHost   &mHost;
-    TaskRunner       mTaskRunner;
+    TaskRunner       mTaskRunner{"TrelDnssd.TaskRunner"};
     std::string      mTrelNetif;
     uint32_t         mTrelNetifIndex = 0;
     uint64_t         mSubscriberId   = 0;
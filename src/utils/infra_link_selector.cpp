@@ -37,8 +37,10 @@
 
 #include "utils/infra_link_selector.hpp"
 
+#include <errno.h>
 #include <linux/rtnetlink.h>
 #include <net/if.h>
+#include <string.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -50,7 +52,9 @@
 namespace otbr {
 namespace Utils {
 
-constexpr Milliseconds InfraLinkSelector::kInfraLinkSelectionDelay;
+constexpr Milliseconds InfraLinkSelector::kDefaultDownDelay;
+constexpr Milliseconds InfraLinkSelector::kDefaultUpDelay;
+constexpr size_t       InfraLinkSelector::kStateHistorySize;
 
 bool InfraLinkSelector::LinkInfo::Update(LinkState aState)
 {
@@ -63,6 +67,10 @@ bool InfraLinkSelector::LinkInfo::Update(LinkState aState)
         mWasUpAndRunning = true;
         mLastRunningTime = Clock::now();
     }
+    else if (aState == kUpAndRunning)
+    {
+        mRunningSinceTime = Clock::now();
+    }
 
     mState = aState;
 exit:
@@ -93,6 +101,14 @@ InfraLinkSelector::~InfraLinkSelector(void)
     }
 }
 
+void InfraLinkSelector::SetHysteresis(Milliseconds aDownDelay, Milliseconds aUpDelay)
+{
+    mDownDelay = aDownDelay;
+    mUpDelay   = aUpDelay;
+
+    otbrLogInfo("Hysteresis: down delay %lldms, up delay %lldms", mDownDelay.count(), mUpDelay.count());
+}
+
 const char *InfraLinkSelector::Select(void)
 {
     const char *sel;
@@ -160,24 +176,45 @@ const char *InfraLinkSelector::SelectGeneric(void)
         // Prefer `mCurrentInfraLink` if no other infra link is up and running
         VerifyOrExit(mCurrentInfraLink == nullptr || bestState == kUpAndRunning);
 
-        // Prefer `mCurrentInfraLink` if it's down for less than `kInfraLinkSelectionDelay`
+        // Prefer `mCurrentInfraLink` if it's down for less than `mDownDelay`
         if (mCurrentInfraLink != nullptr && currentInfraLinkInfo->mWasUpAndRunning)
         {
             Milliseconds timeSinceLastRunning =
                 std::chrono::duration_cast<Milliseconds>(now - currentInfraLinkInfo->mLastRunningTime);
 
-            if (timeSinceLastRunning < kInfraLinkSelectionDelay)
+            if (timeSinceLastRunning < mDownDelay)
             {
-                Milliseconds delay = kInfraLinkSelectionDelay - timeSinceLastRunning;
+                Milliseconds delay = mDownDelay - timeSinceLastRunning;
 
                 otbrLogInfo("Infra link %s was running %lldms ago, wait for %lldms to recheck.", mCurrentInfraLink,
                             timeSinceLastRunning.count(), delay.count());
-                mTaskRunner.Post(delay, [this]() { mRequireReselect = true; });
+                HoldBackSwitch(bestInfraLink, delay);
+                ExitNow();
+            }
+        }
+
+        // Prefer `mCurrentInfraLink` if the best infra link is running for less than `mUpDelay`
+        if (mCurrentInfraLink != nullptr)
+        {
+            Milliseconds timeSinceRunning =
+                std::chrono::duration_cast<Milliseconds>(now - mInfraLinkInfos[bestInfraLink].mRunningSinceTime);
+
+            if (timeSinceRunning < mUpDelay)
+            {
+                Milliseconds delay = mUpDelay - timeSinceRunning;
+
+                otbrLogInfo("Infra link %s is running for %lldms, wait for %lldms to recheck.", bestInfraLink,
+                            timeSinceRunning.count(), delay.count());
+                HoldBackSwitch(bestInfraLink, delay);
                 ExitNow();
             }
         }
 
         // Current infra link changed.
+        if (mCurrentInfraLink != nullptr)
+        {
+            mCounters.mSwitchesTaken++;
+        }
         mCurrentInfraLink = bestInfraLink;
     }
 
@@ -186,6 +223,12 @@ exit:
     {
         mRequireReselect = false;
 
+        // The held back switch is resolved once the link is switched or the hysteresis window ends.
+        if (prevInfraLink != mCurrentInfraLink || !mReselectScheduled)
+        {
+            mPendingInfraLink = nullptr;
+        }
+
         if (prevInfraLink != mCurrentInfraLink)
         {
             if (prevInfraLink == nullptr)
@@ -206,6 +249,38 @@ exit:
     return mCurrentInfraLink;
 }
 
+InfraLinkSelector::LinkState InfraLinkSelector::FlagsToLinkState(unsigned int aFlags)
+{
+    return (aFlags & IFF_UP) ? ((aFlags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+}
+
+void InfraLinkSelector::HoldBackSwitch(const char *aInfraLink, Milliseconds aDelay)
+{
+    // The rechecks within the hysteresis window hold back the same switch, it is only counted once.
+    if (aInfraLink != mPendingInfraLink)
+    {
+        mPendingInfraLink = aInfraLink;
+        mCounters.mSwitchesAvoided++;
+    }
+
+    ScheduleReselect(aDelay);
+}
+
+void InfraLinkSelector::ScheduleReselect(Milliseconds aDelay)
+{
+    // Only the latest recheck is needed when the links keep flapping.
+    if (mReselectScheduled)
+    {
+        mTaskRunner.Cancel(mReselectTaskId);
+    }
+
+    mReselectScheduled = true;
+    mReselectTaskId    = mTaskRunner.Post(aDelay, [this]() {
+        mReselectScheduled = false;
+        mRequireReselect   = true;
+    });
+}
+
 InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *aInfraLinkName)
 {
     int                          sock = 0;
@@ -220,7 +295,7 @@ InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *
 
     VerifyOrExit(ioctl(sock, SIOCGIFFLAGS, &ifReq) != -1);
 
-    state = (ifReq.ifr_flags & IFF_UP) ? ((ifReq.ifr_flags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+    state = FlagsToLinkState(static_cast<uint16_t>(ifReq.ifr_flags));
 
 exit:
     if (sock != 0)
@@ -251,75 +326,116 @@ void InfraLinkSelector::Process(const MainloopContext &aMainloop)
 
 void InfraLinkSelector::ReceiveNetLinkMessage(void)
 {
-    const size_t kMaxNetLinkBufSize = 8192;
-    ssize_t      len;
+    const size_t                      kMaxNetLinkBufSize = 8192;
+    ssize_t                           len;
+    std::map<const char *, LinkState> states;
     union
     {
         nlmsghdr mHeader;
         uint8_t  mBuffer[kMaxNetLinkBufSize];
     } msgBuffer;
 
-    len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), 0);
-    if (len < 0)
-    {
-        otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
-    }
-
-    for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
-         header                  = NLMSG_NEXT(header, len))
+    // Drain all the pending events and only apply the latest state of each infra link, so that a burst of link
+    // flaps results in a single reselection.
+    while (true)
     {
-        struct ifinfomsg *ifinfo;
-
-        switch (header->nlmsg_type)
+        len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), MSG_DONTWAIT);
+        if (len < 0)
         {
-        case RTM_NEWLINK:
-        case RTM_DELLINK:
-            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
-            HandleInfraLinkStateChange(ifinfo->ifi_index);
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
+            }
             break;
-        case NLMSG_ERROR:
+        }
+
+        for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+             header                  = NLMSG_NEXT(header, len))
         {
-            struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+            switch (header->nlmsg_type)
+            {
+            case RTM_NEWLINK:
+            case RTM_DELLINK:
+            {
+                struct ifinfomsg *ifinfo   = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
+                int               attrLen  = static_cast<int>(IFLA_PAYLOAD(header));
+                const char       *linkName = nullptr;
 
-            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
-            break;
-        }
-        default:
-            break;
+                for (struct rtattr *rta = IFLA_RTA(ifinfo); RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+                {
+                    if (rta->rta_type == IFLA_IFNAME)
+                    {
+                        linkName = FindInfraLinkName(reinterpret_cast<const char *>(RTA_DATA(rta)));
+                        break;
+                    }
+                }
+
+                if (linkName == nullptr)
+                {
+                    break;
+                }
+
+                states[linkName] = (header->nlmsg_type == RTM_DELLINK) ? kInvalid : FlagsToLinkState(ifinfo->ifi_flags);
+                break;
+            }
+            case NLMSG_ERROR:
+            {
+                struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+
+                otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
+                break;
+            }
+            default:
+                break;
+            }
         }
     }
 
-exit:
-    return;
+    for (const auto &state : states)
+    {
+        HandleInfraLinkStateChange(state.first, state.second);
+    }
 }
 
-void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
+const char *InfraLinkSelector::FindInfraLinkName(const char *aName) const
 {
     const char *infraLinkName = nullptr;
 
     for (const char *name : mInfraLinkNames)
     {
-        if (aInfraLinkIndex == if_nametoindex(name))
+        if (strcmp(name, aName) == 0)
         {
             infraLinkName = name;
             break;
         }
     }
 
-    VerifyOrExit(infraLinkName != nullptr);
+    return infraLinkName;
+}
+
+void InfraLinkSelector::HandleInfraLinkStateChange(const char *aInfraLinkName, LinkState aState)
+{
+    LinkInfo &linkInfo  = mInfraLinkInfos[aInfraLinkName];
+    LinkState prevState = linkInfo.mState;
 
-    {
-        LinkInfo &linkInfo  = mInfraLinkInfos[infraLinkName];
-        LinkState prevState = linkInfo.mState;
+    VerifyOrExit(linkInfo.Update(aState));
 
-        if (linkInfo.Update(QueryInfraLinkState(infraLinkName)))
-        {
-            otbrLogInfo("Infra link name %s index %lu state changed: %s -> %s", infraLinkName, aInfraLinkIndex,
-                        LinkStateToString(prevState), LinkStateToString(linkInfo.mState));
-            mRequireReselect = true;
-        }
+    otbrLogInfo("Infra link name %s state changed: %s -> %s", aInfraLinkName, LinkStateToString(prevState),
+                LinkStateToString(linkInfo.mState));
+
+    mCounters.mStateChanges++;
+    mStateHistory.push_back({aInfraLinkName, aState, Clock::now()});
+    if (mStateHistory.size() > kStateHistorySize)
+    {
+        mStateHistory.pop_front();
     }
+
+    mRequireReselect = true;
+
 exit:
     return;
 }
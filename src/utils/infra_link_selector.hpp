@@ -39,6 +39,7 @@
 #if __linux__
 
 #include <assert.h>
+#include <deque>
 #include <map>
 #include <utility>
 #include <vector>
@@ -69,6 +70,43 @@ namespace Utils {
 class InfraLinkSelector : public MainloopProcessor, private NonCopyable
 {
 public:
+    /**
+     * This enumeration infrastructure link states.
+     */
+    enum LinkState : uint8_t
+    {
+        kInvalid,      ///< The infrastructure link is invalid.
+        kDown,         ///< The infrastructure link is down.
+        kUp,           ///< The infrastructure link is up, but not running.
+        kUpAndRunning, ///< The infrastructure link is up and running.
+
+    };
+
+    /**
+     * This structure represents a state change of an infrastructure link candidate.
+     */
+    struct StateChange
+    {
+        const char *mInfraLinkName; ///< The infrastructure link name.
+        LinkState   mState;         ///< The new state of the infrastructure link.
+        Timepoint   mTime;          ///< The time when the state change was received.
+    };
+
+    /**
+     * This structure represents the counters of the InfraLinkSelector.
+     */
+    struct Counters
+    {
+        uint32_t mStateChanges;    ///< The number of state changes of the infrastructure link candidates.
+        uint32_t mSwitchesTaken;   ///< The number of times the selected infrastructure link was switched.
+        uint32_t mSwitchesAvoided; ///< The number of switches held back by the hysteresis windows.
+    };
+
+    static constexpr size_t kStateHistorySize = 32; ///< The max number of state changes kept in the history.
+
+    static constexpr Milliseconds kDefaultDownDelay = Milliseconds(10000); ///< The default down hysteresis window.
+    static constexpr Milliseconds kDefaultUpDelay   = Milliseconds(0);     ///< The default up hysteresis window.
+
     /**
      * This constructor initializes the InfraLinkSelector instance.
      *
@@ -91,52 +129,83 @@ public:
      * Once an interface is selected, it's preferred if either is true:
      *      The interface is still `up and running`
      *      No other interface is `up and running`
-     *      The interface has been `up and running` within last 10 seconds
+     *      The interface has been `up and running` within the down delay (default: 10 seconds)
+     *      No other interface has been `up and running` for the up delay (default: 0)
      *
      * @returns  The selected infrastructure link.
      */
     const char *Select(void);
 
-private:
     /**
-     * This enumeration infrastructure link states.
+     * This method sets the hysteresis windows of the infrastructure link selection.
+     *
+     * @param[in] aDownDelay  How long the selected link may stay not running before switching away from it.
+     * @param[in] aUpDelay    How long another link must have been up and running before switching to it.
      */
-    enum LinkState : uint8_t
-    {
-        kInvalid,      ///< The infrastructure link is invalid.
-        kDown,         ///< The infrastructure link is down.
-        kUp,           ///< The infrastructure link is up, but not running.
-        kUpAndRunning, ///< The infrastructure link is up and running.
+    void SetHysteresis(Milliseconds aDownDelay, Milliseconds aUpDelay);
 
-    };
+    /**
+     * This method returns the counters of the InfraLinkSelector.
+     *
+     * @returns The counters.
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
 
+    /**
+     * This method returns the recent state changes of the infrastructure link candidates, the oldest first.
+     *
+     * @returns The state history.
+     */
+    const std::deque<StateChange> &GetStateHistory(void) const { return mStateHistory; }
+
+    /**
+     * This method converts an infrastructure link state to a string.
+     *
+     * @param[in] aState  The infrastructure link state.
+     *
+     * @returns The string representation of @p aState.
+     */
+    static const char *LinkStateToString(LinkState aState);
+
+private:
     struct LinkInfo
     {
         LinkState         mState = kInvalid;
         Clock::time_point mLastRunningTime;
+        Clock::time_point mRunningSinceTime;
         bool              mWasUpAndRunning = false;
 
         bool Update(LinkState aState);
     };
 
-    static constexpr const char *kDefaultInfraLinkName    = "";
-    static constexpr auto        kInfraLinkSelectionDelay = Milliseconds(10000);
+    static constexpr const char *kDefaultInfraLinkName = "";
 
     const char *SelectGeneric(void);
-
-    static const char *LinkStateToString(LinkState aState);
-    static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
-    void               Update(MainloopContext &aMainloop) override;
-    void               Process(const MainloopContext &aMainloop) override;
-    void               ReceiveNetLinkMessage(void);
-    void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
+    void        HoldBackSwitch(const char *aInfraLink, Milliseconds aDelay);
+    void        ScheduleReselect(Milliseconds aDelay);
+
+    static LinkState FlagsToLinkState(unsigned int aFlags);
+    static LinkState QueryInfraLinkState(const char *aInfraLinkName);
+    void             Update(MainloopContext &aMainloop) override;
+    void             Process(const MainloopContext &aMainloop) override;
+    const char      *GetName(void) const override { return "InfraLinkSelector"; }
+    void             ReceiveNetLinkMessage(void);
+    const char      *FindInfraLinkName(const char *aName) const;
+    void             HandleInfraLinkStateChange(const char *aInfraLinkName, LinkState aState);
 
     std::vector<const char *>        mInfraLinkNames;
     std::map<const char *, LinkInfo> mInfraLinkInfos;
     int                              mNetlinkSocket    = -1;
     const char                      *mCurrentInfraLink = nullptr;
-    TaskRunner                       mTaskRunner;
-    bool                             mRequireReselect = true;
+    const char                      *mPendingInfraLink = nullptr; // The link of the switch held back.
+    TaskRunner                       mTaskRunner{"InfraLinkSelector.TaskRunner"};
+    bool                             mRequireReselect   = true;
+    bool                             mReselectScheduled = false;
+    TaskRunner::TaskId               mReselectTaskId    = 0;
+    Milliseconds                     mDownDelay         = kDefaultDownDelay;
+    Milliseconds                     mUpDelay           = kDefaultUpDelay;
+    Counters                         mCounters          = {};
+    std::deque<StateChange>          mStateHistory;
 };
 
 } // namespace Utils
@@ -0,0 +1,70 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "BENCH"
+
+#include <benchmark/benchmark.h>
+
+#include "common/logging.hpp"
+#include "common/types.hpp"
+
+namespace {
+
+const otbr::Ip6Address kAddress("fd00:db8:0:0:1234:5678:9abc:def0");
+
+/**
+ * Logs a filtered-out debug message the way the logging macros did before lazy evaluation, so that
+ * the arguments are formatted before the level check in otbrLog().
+ */
+void BM_FilteredLogEager(benchmark::State &aState)
+{
+    otbrLogSetLevel(OTBR_LOG_INFO);
+
+    for (auto _ : aState)
+    {
+        otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "Send packet to %s (%hu bytes)", kAddress.ToString().c_str(),
+                static_cast<uint16_t>(1280));
+    }
+}
+BENCHMARK(BM_FilteredLogEager);
+
+/**
+ * Logs the same filtered-out debug message with otbrLogDebug(), which skips the arguments.
+ */
+void BM_FilteredLogLazy(benchmark::State &aState)
+{
+    otbrLogSetLevel(OTBR_LOG_INFO);
+
+    for (auto _ : aState)
+    {
+        otbrLogDebug("Send packet to %s (%hu bytes)", kAddress.ToString().c_str(), static_cast<uint16_t>(1280));
+    }
+}
+BENCHMARK(BM_FilteredLogLazy);
+
+} // namespace
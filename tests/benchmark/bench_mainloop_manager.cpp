@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include "common/mainloop_manager.hpp"
+
+namespace {
+
+/**
+ * This class is an idle mainloop processor which watches the read end of a pipe,
+ * like most of the otbr-agent processors do with their sockets.
+ */
+class PipeProcessor : public otbr::MainloopProcessor
+{
+public:
+    PipeProcessor(void)
+    {
+        if (pipe(mPipe) != 0)
+        {
+            mPipe[0] = mPipe[1] = -1;
+        }
+    }
+
+    ~PipeProcessor(void) override
+    {
+        close(mPipe[0]);
+        close(mPipe[1]);
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override { aMainloop.AddFdToReadSet(mPipe[0]); }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        benchmark::DoNotOptimize(FD_ISSET(mPipe[0], &aMainloop.mReadFdSet));
+    }
+
+    const char *GetName(void) const override { return "Pipe"; }
+
+private:
+    int mPipe[2];
+};
+
+// Measures the overhead of `MainloopManager::Update()` and `Process()` for
+// one mainloop iteration with `aState.range(0)` processors.
+void BM_MainloopUpdateAndProcess(benchmark::State &aState)
+{
+    std::vector<std::unique_ptr<PipeProcessor>> processors;
+    otbr::MainloopManager                      &mainloopManager = otbr::MainloopManager::GetInstance();
+
+    for (int64_t i = 0; i < aState.range(0); ++i)
+    {
+        processors.emplace_back(new PipeProcessor());
+    }
+
+    for (auto _ : aState)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {0, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        mainloopManager.Update(mainloop);
+
+        // Simulates an idle `select()` which returns without any ready fd.
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        mainloopManager.Process(mainloop);
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_MainloopUpdateAndProcess)->Arg(1)->Arg(8)->Arg(64);
+
+} // namespace
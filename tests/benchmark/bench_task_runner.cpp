@@ -0,0 +1,252 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "common/task_runner.hpp"
+
+namespace {
+
+void RunMainloopOnce(otbr::TaskRunner &aTaskRunner, const timeval &aTimeout)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = aTimeout;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    if (select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+               &mainloop.mTimeout) >= 0)
+    {
+        aTaskRunner.Process(mainloop);
+    }
+}
+
+/**
+ * This class runs a TaskRunner on a dedicated mainloop thread, which
+ * plays the role of the otbr-agent mainloop in multi-threaded benchmarks.
+ */
+class MainloopThread
+{
+public:
+    MainloopThread(void)
+        : mStop(false)
+        , mThread([this]() {
+            while (!mStop)
+            {
+                RunMainloopOnce(mTaskRunner, {0, 10000});
+            }
+        })
+    {
+    }
+
+    ~MainloopThread(void)
+    {
+        mStop = true;
+        mTaskRunner.Post([]() {});
+        mThread.join();
+    }
+
+    otbr::TaskRunner &GetTaskRunner(void) { return mTaskRunner; }
+
+private:
+    otbr::TaskRunner mTaskRunner;
+    std::atomic_bool mStop;
+    std::thread      mThread;
+};
+
+MainloopThread *sMainloopThread = nullptr;
+
+// Posts immediate tasks and drains them on the same thread.
+void BM_PostAndDrain(benchmark::State &aState)
+{
+    otbr::TaskRunner taskRunner;
+    const int64_t    batch   = aState.range(0);
+    uint64_t         counter = 0;
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < batch; ++i)
+        {
+            taskRunner.Post([&counter]() { ++counter; });
+        }
+        RunMainloopOnce(taskRunner, {0, 0});
+    }
+
+    benchmark::DoNotOptimize(counter);
+    aState.SetItemsProcessed(aState.iterations() * batch);
+}
+BENCHMARK(BM_PostAndDrain)->Arg(1)->Arg(64);
+
+// Same as above but through the delayed-task heap, which was the only
+// path for immediate tasks before the lock-free fast path was added.
+void BM_PostZeroDelayAndDrain(benchmark::State &aState)
+{
+    otbr::TaskRunner taskRunner;
+    const int64_t    batch   = aState.range(0);
+    uint64_t         counter = 0;
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < batch; ++i)
+        {
+            taskRunner.Post(otbr::Milliseconds::zero(), [&counter]() { ++counter; });
+        }
+        RunMainloopOnce(taskRunner, {0, 0});
+    }
+
+    benchmark::DoNotOptimize(counter);
+    aState.SetItemsProcessed(aState.iterations() * batch);
+}
+BENCHMARK(BM_PostZeroDelayAndDrain)->Arg(1)->Arg(64);
+
+// Posts immediate tasks from several threads to a busy mainloop thread.
+void BM_PostConcurrent(benchmark::State &aState)
+{
+    if (aState.thread_index() == 0)
+    {
+        sMainloopThread = new MainloopThread();
+    }
+
+    for (auto _ : aState)
+    {
+        sMainloopThread->GetTaskRunner().Post([]() {});
+    }
+
+    if (aState.thread_index() == 0)
+    {
+        delete sMainloopThread;
+        sMainloopThread = nullptr;
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_PostConcurrent)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_PostZeroDelayConcurrent(benchmark::State &aState)
+{
+    if (aState.thread_index() == 0)
+    {
+        sMainloopThread = new MainloopThread();
+    }
+
+    for (auto _ : aState)
+    {
+        sMainloopThread->GetTaskRunner().Post(otbr::Milliseconds::zero(), []() {});
+    }
+
+    if (aState.thread_index() == 0)
+    {
+        delete sMainloopThread;
+        sMainloopThread = nullptr;
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_PostZeroDelayConcurrent)->ThreadRange(1, 8)->UseRealTime();
+
+// Measures the round-trip latency of posting a task to a busy mainloop
+// thread and waiting for its result.
+void BM_PostAndWait(benchmark::State &aState)
+{
+    MainloopThread mainloopThread;
+    int            counter = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(mainloopThread.GetTaskRunner().PostAndWait<int>([&counter]() { return ++counter; }));
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_PostAndWait)->UseRealTime();
+
+// Inserts and cancels a delayed task while `aState.range(0)` other timers
+// are outstanding, which is the common pattern of retry and timeout timers.
+void BM_DelayedPostAndCancel(benchmark::State &aState)
+{
+    otbr::TaskRunner                   taskRunner;
+    std::mt19937                       random(0);
+    std::uniform_int_distribution<int> delayMs(1000, 3600 * 1000);
+
+    for (int64_t i = 0; i < aState.range(0); ++i)
+    {
+        taskRunner.Post(otbr::Milliseconds(delayMs(random)), []() {});
+    }
+
+    for (auto _ : aState)
+    {
+        otbr::TaskRunner::TaskId taskId = taskRunner.Post(otbr::Milliseconds(delayMs(random)), []() {});
+
+        taskRunner.Cancel(taskId);
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_DelayedPostAndCancel)->Arg(0)->Arg(10000);
+
+// Inserts `aState.range(0)` delayed tasks and cancels them all.
+void BM_DelayedPostAndCancelBatch(benchmark::State &aState)
+{
+    otbr::TaskRunner                      taskRunner;
+    std::mt19937                          random(0);
+    std::uniform_int_distribution<int>    delayMs(1000, 3600 * 1000);
+    std::vector<otbr::TaskRunner::TaskId> taskIds;
+
+    taskIds.reserve(static_cast<size_t>(aState.range(0)));
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < aState.range(0); ++i)
+        {
+            taskIds.push_back(taskRunner.Post(otbr::Milliseconds(delayMs(random)), []() {}));
+        }
+
+        for (otbr::TaskRunner::TaskId taskId : taskIds)
+        {
+            taskRunner.Cancel(taskId);
+        }
+
+        taskIds.clear();
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_DelayedPostAndCancelBatch)->Arg(10000);
+
+} // namespace
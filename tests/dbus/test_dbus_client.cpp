@@ -224,6 +224,50 @@ void CheckDnssdCounters(ThreadApiDBus *aApi)
 #endif
 }
 
+void CheckMainloopStats(ThreadApiDBus *aApi)
+{
+    std::vector<otbr::DBus::MainloopProcessorStats> stats;
+    bool                                            hasTaskRunner = false;
+
+    TEST_ASSERT(aApi->GetMainloopStats(stats) == OTBR_ERROR_NONE);
+    TEST_ASSERT(!stats.empty());
+
+    for (const auto &processorStats : stats)
+    {
+        uint64_t count = 0;
+
+        TEST_ASSERT(!processorStats.mName.empty());
+        TEST_ASSERT(processorStats.mIterations > 0);
+        TEST_ASSERT(processorStats.mProcessTimeHistogram.size() == 20);
+
+        for (uint32_t bucket : processorStats.mProcessTimeHistogram)
+        {
+            count += bucket;
+        }
+        TEST_ASSERT(count == processorStats.mIterations);
+
+        if (processorStats.mName == "RcpHost.TaskRunner")
+        {
+            hasTaskRunner = true;
+            TEST_ASSERT(processorStats.mFdCount == 1);
+        }
+    }
+
+    TEST_ASSERT(hasTaskRunner);
+}
+
+void CheckFlightRecorder(ThreadApiDBus *aApi)
+{
+    std::vector<std::string> records;
+
+    TEST_ASSERT(aApi->GetFlightRecorder(records) == OTBR_ERROR_NONE);
+
+    for (const std::string &record : records)
+    {
+        TEST_ASSERT(!record.empty());
+    }
+}
+
 void CheckMdnsInfo(ThreadApiDBus *aApi)
 {
     OTBR_UNUSED_VARIABLE(aApi);
@@ -528,6 +572,8 @@ int main()
                             CheckTrelInfo(api.get());
                             CheckMdnsInfo(api.get());
                             CheckDnssdCounters(api.get());
+                            CheckMainloopStats(api.get());
+                            CheckFlightRecorder(api.get());
                             CheckNat64(api.get());
                             CheckEphemeralKey(api.get());
                             CheckBorderAgent(api.get());
@@ -0,0 +1,203 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TEST"
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/async_logger.hpp"
+
+using otbr::AsyncLogger;
+
+TEST(AsyncLogger, TestWriteAndFlush)
+{
+    std::vector<std::string> lines;
+    AsyncLogger              logger([&lines](otbrLogLevel aLevel, const char *aLine) {
+        EXPECT_EQ(aLevel, OTBR_LOG_INFO);
+        lines.push_back(aLine);
+    });
+
+    EXPECT_TRUE(logger.Write(OTBR_LOG_INFO, "first"));
+    EXPECT_TRUE(logger.Write(OTBR_LOG_INFO, "second"));
+    logger.Flush();
+
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "first");
+    EXPECT_EQ(lines[1], "second");
+    EXPECT_EQ(logger.GetCounters().mWritten, 2u);
+    EXPECT_EQ(logger.GetCounters().mDropped, 0u);
+    EXPECT_EQ(logger.GetCounters().mRings, 1u);
+}
+
+TEST(AsyncLogger, TestDropWhenRingIsFull)
+{
+    std::promise<void>       release;
+    std::shared_future<void> releaseFuture = release.get_future().share();
+    std::promise<void>       blocked;
+    size_t                   written = 0;
+    AsyncLogger              logger([&](otbrLogLevel, const char *) {
+        // Blocks the background thread on the first line to simulate a stalled syslog daemon.
+        if (written++ == 0)
+        {
+            blocked.set_value();
+            releaseFuture.wait();
+        }
+    });
+
+    EXPECT_TRUE(logger.Write(OTBR_LOG_INFO, "blocking"));
+    blocked.get_future().wait();
+
+    for (size_t i = 0; i < AsyncLogger::kRingCapacity + 10; i++)
+    {
+        // Producers never block, the lines beyond the ring capacity are dropped.
+        EXPECT_TRUE(logger.Write(OTBR_LOG_INFO, "line"));
+    }
+
+    release.set_value();
+    logger.Flush();
+
+    EXPECT_EQ(logger.GetCounters().mDropped, 11u);
+    // The line being written still occupies its entry while the sink is blocked.
+    EXPECT_EQ(logger.GetCounters().mWritten, AsyncLogger::kRingCapacity);
+}
+
+TEST(AsyncLogger, TestTruncateLongLine)
+{
+    std::string lastLine;
+    AsyncLogger logger([&lastLine](otbrLogLevel, const char *aLine) { lastLine = aLine; });
+    std::string longLine(AsyncLogger::kMaxLineLength * 2, 'x');
+
+    EXPECT_TRUE(logger.Write(OTBR_LOG_INFO, longLine.c_str()));
+    logger.Flush();
+
+    EXPECT_EQ(lastLine.size(), AsyncLogger::kMaxLineLength - 1);
+    EXPECT_EQ(logger.GetCounters().mTruncated, 1u);
+}
+
+TEST(AsyncLogger, TestMultipleThreads)
+{
+    const int                kNumThreads        = 4;
+    const int                kNumLinesPerThread = 1000;
+    std::mutex               mutex;
+    std::vector<std::string> lines;
+    std::vector<std::thread> threads;
+    AsyncLogger              logger([&](otbrLogLevel, const char *aLine) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        lines.push_back(aLine);
+    });
+
+    for (int i = 0; i < kNumThreads; i++)
+    {
+        threads.emplace_back([&logger, i]() {
+            for (int j = 0; j < kNumLinesPerThread; j++)
+            {
+                std::string line = std::to_string(i) + ":" + std::to_string(j);
+
+                EXPECT_TRUE(logger.Write(OTBR_LOG_INFO, line.c_str()));
+                if (j % 32 == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    logger.Flush();
+
+    {
+        AsyncLogger::Counters counters = logger.GetCounters();
+        std::vector<int>      nextLine(kNumThreads, 0);
+
+        EXPECT_EQ(counters.mWritten + counters.mDropped, static_cast<uint64_t>(kNumThreads * kNumLinesPerThread));
+        EXPECT_EQ(lines.size(), counters.mWritten);
+
+        // Lines of the same thread are written in order.
+        for (const std::string &line : lines)
+        {
+            int thread = std::stoi(line.substr(0, line.find(':')));
+            int index  = std::stoi(line.substr(line.find(':') + 1));
+
+            EXPECT_GE(index, nextLine[thread]);
+            nextLine[thread] = index + 1;
+        }
+
+        // The rings of the exited threads are released.
+        EXPECT_EQ(counters.mRings, 0u);
+    }
+}
+
+TEST(AsyncLogger, TestToggleWhileLogging)
+{
+    constexpr int            kNumThreads = 4;
+    std::atomic_bool         stop{false};
+    std::vector<std::thread> threads;
+    otbrLogAsyncCounters     counters;
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, false);
+
+    for (int i = 0; i < kNumThreads; i++)
+    {
+        threads.emplace_back([&stop, i]() {
+            while (!stop.load())
+            {
+                otbrLogInfo("thread %d", i);
+            }
+        });
+    }
+
+    // Disabling must not release the logger which other threads may be writing to.
+    for (int i = 0; i < 100; i++)
+    {
+        otbrLogAsyncSetEnabled(i % 2 == 0);
+    }
+
+    stop.store(true);
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    otbrLogGetAsyncCounters(counters);
+    EXPECT_EQ(counters.mWritten, 0u);
+
+    otbrLogDeinit();
+}
@@ -198,3 +198,96 @@ TEST(AsyncTask, TestMultipleStepsFailedHalfWay)
     EXPECT_EQ(resultHandlerCalledTimes, 1);
     EXPECT_EQ(error, OT_ERROR_BUSY);
 }
+
+TEST(AsyncTask, TestResultIgnoredAfterCompletion)
+{
+    AsyncTaskPtr task;
+    AsyncTaskPtr step1;
+    AsyncTaskPtr step2;
+
+    int     resultHandlerCalledTimes = 0;
+    otError error                    = OT_ERROR_NONE;
+
+    auto errorHandler = [&resultHandlerCalledTimes, &error](otError aError, const std::string &aErrorInfo) {
+        OTBR_UNUSED_VARIABLE(aErrorInfo);
+
+        resultHandlerCalledTimes++;
+        error = aError;
+    };
+
+    task = std::make_shared<AsyncTask>(errorHandler);
+    task->First([&step1](AsyncTaskPtr aNext) { step1 = std::move(aNext); })->Then([&step2](AsyncTaskPtr aNext) {
+        step2 = std::move(aNext);
+    });
+    task->Run();
+
+    // All the steps share the ownership of the same task.
+    EXPECT_EQ(task.use_count(), 2);
+
+    step1->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(task.use_count(), 3);
+
+    step2->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(resultHandlerCalledTimes, 1);
+    EXPECT_EQ(error, OT_ERROR_NONE);
+
+    // A late result doesn't restart the chain or call the result handler again.
+    step1->SetResult(OT_ERROR_BUSY, "");
+    task  = nullptr;
+    step1 = nullptr;
+    step2 = nullptr;
+    EXPECT_EQ(resultHandlerCalledTimes, 1);
+    EXPECT_EQ(error, OT_ERROR_NONE);
+}
+
+TEST(AsyncTask, TestRepeatedResultOfStepIgnored)
+{
+    AsyncTaskPtr task;
+    AsyncTaskPtr step1;
+    AsyncTaskPtr step2;
+    AsyncTaskPtr step3;
+
+    int     resultHandlerCalledTimes = 0;
+    int     stepCount                = 0;
+    otError error                    = OT_ERROR_GENERIC;
+
+    auto errorHandler = [&resultHandlerCalledTimes, &error](otError aError, const std::string &aErrorInfo) {
+        OTBR_UNUSED_VARIABLE(aErrorInfo);
+
+        resultHandlerCalledTimes++;
+        error = aError;
+    };
+
+    task = std::make_shared<AsyncTask>(errorHandler);
+    task->First([&stepCount, &step1](AsyncTaskPtr aNext) {
+            step1 = std::move(aNext);
+            stepCount++;
+        })
+        ->Then([&stepCount, &step2](AsyncTaskPtr aNext) {
+            step2 = std::move(aNext);
+            stepCount++;
+        })
+        ->Then([&stepCount, &step3](AsyncTaskPtr aNext) {
+            step3 = std::move(aNext);
+            stepCount++;
+        });
+    task->Run();
+
+    step1->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(stepCount, 2);
+
+    // The second result of the first step neither skips the second step nor fails the chain.
+    step1->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(stepCount, 2);
+    step1->SetResult(OT_ERROR_BUSY, "");
+    EXPECT_EQ(resultHandlerCalledTimes, 0);
+
+    step2->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(stepCount, 3);
+    step2->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(resultHandlerCalledTimes, 0);
+
+    step3->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(resultHandlerCalledTimes, 1);
+    EXPECT_EQ(error, OT_ERROR_NONE);
+}
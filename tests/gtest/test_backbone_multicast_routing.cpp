@@ -194,6 +194,12 @@ TEST(BbrMcastRouting, MulticastRoutingTableSetCorrectlyAfterHandlingMlrEvents)
     EXPECT_THAT(lines.front(), ::testing::Not(::testing::HasSubstr(kOifs)));
     EXPECT_THAT(lines.front(), ::testing::HasSubstr(kStateResolved));
 
+    otbr::MulticastRoutingManager::MfcCounters counters = mcastRtMgr.GetMfcCounters();
+    EXPECT_EQ(counters.mEntries, 1);
+    EXPECT_EQ(counters.mCapacity, otbr::MulticastRoutingManager::kDefaultMfcCapacity);
+    EXPECT_EQ(counters.mAdditions, 1);
+    EXPECT_EQ(counters.mEvictions, 0);
+
     otbr::Ip6Address kMulAddr1 = {
         {0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xcd}};
     mcastRtMgr.HandleBackboneMulticastListenerEvent(OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED, kMulAddr1);
@@ -204,6 +210,13 @@ TEST(BbrMcastRouting, MulticastRoutingTableSetCorrectlyAfterHandlingMlrEvents)
     EXPECT_THAT(lines.front(), ::testing::HasSubstr(kIif));
     EXPECT_THAT(lines.front(), ::testing::HasSubstr(kOifs));
     EXPECT_THAT(lines.front(), ::testing::HasSubstr(kStateResolved));
+    EXPECT_EQ(mcastRtMgr.GetMfcCounters().mEntries, 1);
+
+    // Shrinking the MFC only evicts the least recently used entries beyond the new capacity.
+    EXPECT_EQ(mcastRtMgr.SetMfcCapacity(0), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(mcastRtMgr.SetMfcCapacity(1), OTBR_ERROR_NONE);
+    EXPECT_EQ(mcastRtMgr.GetMfcCounters().mEvictions, 0);
+    EXPECT_EQ(GetMulticastRoutingTable().size(), 1);
 }
 
 #endif // OTBR_ENABLE_BACKBONE_ROUTER
@@ -0,0 +1,189 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TEST"
+
+#include <memory>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "common/flight_recorder.hpp"
+
+using otbr::FlightRecorder;
+
+static void RecordEvent(FlightRecorder &aRecorder, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    aRecorder.Record(OTBR_LOG_DEBUG, OTBR_LOG_TAG, aFormat, args);
+    va_end(args);
+}
+
+// Returns the message of a dumped record, without the timestamp, the level and the tag.
+static std::string GetMessage(const std::string &aRecord)
+{
+    std::string prefix = "[DEBG] " OTBR_LOG_TAG ": ";
+    size_t      pos    = aRecord.find(prefix);
+
+    return (pos == std::string::npos) ? "" : aRecord.substr(pos + prefix.size());
+}
+
+TEST(FlightRecorder, TestFormatArguments)
+{
+    std::unique_ptr<FlightRecorder> recorder(new FlightRecorder());
+    std::vector<std::string>        records;
+    char                            expected[256];
+    const char                     *nullString = nullptr;
+
+    RecordEvent(*recorder, "int %d|%-4i|%+hd|%hhd|%ld|%lld", -1, 22, static_cast<short>(-333), static_cast<char>(-4),
+                -5L, -6LL);
+    snprintf(expected, sizeof(expected), "int %d|%-4i|%+hd|%hhd|%ld|%lld", -1, 22, static_cast<short>(-333),
+             static_cast<char>(-4), -5L, -6LL);
+    RecordEvent(*recorder, "uint %u|%04x|%X|%o|%hu|%zu|%llu", 1u, 0xabu, 0xCDu, 8u, static_cast<unsigned short>(65535),
+                static_cast<size_t>(12345), 18446744073709551615ULL);
+    RecordEvent(*recorder, "misc %c|%5.1f|%*d|%.*s|%s|100%%", 'x', 2.5, 6, 7, 3, "abcdef", nullString);
+    RecordEvent(*recorder, "pointer %p", static_cast<void *>(recorder.get()));
+
+    records = recorder->Dump();
+    ASSERT_EQ(records.size(), 4u);
+
+    EXPECT_EQ(GetMessage(records[0]), expected);
+
+    snprintf(expected, sizeof(expected), "uint %u|%04x|%X|%o|%hu|%zu|%llu", 1u, 0xabu, 0xCDu, 8u,
+             static_cast<unsigned short>(65535), static_cast<size_t>(12345), 18446744073709551615ULL);
+    EXPECT_EQ(GetMessage(records[1]), expected);
+
+    EXPECT_EQ(GetMessage(records[2]), "misc x|  2.5|     7|abc|(null)|100%");
+
+    snprintf(expected, sizeof(expected), "pointer %p", static_cast<void *>(recorder.get()));
+    EXPECT_EQ(GetMessage(records[3]), expected);
+}
+
+TEST(FlightRecorder, TestTruncation)
+{
+    std::unique_ptr<FlightRecorder> recorder(new FlightRecorder());
+    std::vector<std::string>        records;
+    std::string                     longString(FlightRecorder::kMaxStringArgLength * 2, 'a');
+
+    RecordEvent(*recorder, "string %s end", longString.c_str());
+    RecordEvent(*recorder, "many %llu %llu %llu %llu %llu %llu %llu %llu %llu end", 1ULL, 2ULL, 3ULL, 4ULL, 5ULL, 6ULL,
+                7ULL, 8ULL, 9ULL);
+    RecordEvent(*recorder, "unsupported %n end", nullptr);
+
+    records = recorder->Dump();
+    ASSERT_EQ(records.size(), 3u);
+
+    EXPECT_EQ(GetMessage(records[0]), "string " + longString.substr(0, FlightRecorder::kMaxStringArgLength) + " end");
+    EXPECT_EQ(GetMessage(records[1]), "many 1 2 3 4 5 6 7 8 ...");
+    EXPECT_EQ(GetMessage(records[2]), "unsupported ...");
+}
+
+TEST(FlightRecorder, TestCopiesFormatString)
+{
+    std::unique_ptr<FlightRecorder> recorder(new FlightRecorder());
+    std::vector<std::string>        records;
+    std::unique_ptr<std::string>    format(new std::string("temporary %d"));
+    std::string                     longFormat(FlightRecorder::kMaxFormatLength * 2, 'b');
+
+    // The format string is freed before the records are dumped.
+    RecordEvent(*recorder, format->c_str(), 42);
+    format.reset(new std::string("overwritten %d"));
+    format.reset();
+    RecordEvent(*recorder, longFormat.c_str());
+
+    records = recorder->Dump();
+    ASSERT_EQ(records.size(), 2u);
+
+    EXPECT_EQ(GetMessage(records[0]), "temporary 42");
+    EXPECT_EQ(GetMessage(records[1]), longFormat.substr(0, FlightRecorder::kMaxFormatLength) + "...");
+}
+
+TEST(FlightRecorder, TestRingOverwritesOldest)
+{
+    std::unique_ptr<FlightRecorder> recorder(new FlightRecorder());
+    std::vector<std::string>        records;
+
+    EXPECT_TRUE(recorder->Dump().empty());
+
+    for (size_t i = 0; i < FlightRecorder::kNumRecords + 10; i++)
+    {
+        RecordEvent(*recorder, "event %zu", i);
+    }
+
+    records = recorder->Dump();
+    EXPECT_EQ(recorder->GetRecordedCount(), FlightRecorder::kNumRecords + 10);
+    ASSERT_EQ(records.size(), FlightRecorder::kNumRecords);
+    EXPECT_EQ(GetMessage(records.front()), "event 10");
+    EXPECT_EQ(GetMessage(records.back()), "event " + std::to_string(FlightRecorder::kNumRecords + 9));
+}
+
+TEST(FlightRecorder, TestRecordsFilteredLogs)
+{
+    std::vector<std::string> records;
+
+    otbrLogSetLevel(OTBR_LOG_INFO);
+    EXPECT_EQ(otbrLogGetCaptureLevel(), OTBR_LOG_INFO);
+
+    otbrLogFlightRecorderSetLevel(OTBR_LOG_DEBUG);
+    otbrLogFlightRecorderSetEnabled(true);
+    EXPECT_EQ(otbrLogGetCaptureLevel(), OTBR_LOG_DEBUG);
+    otbrLogDebug("filtered debug message %d", 42);
+    otbrLogFlightRecorderSetEnabled(false);
+    otbrLogFlightRecorderSetLevel(OTBR_LOG_INFO);
+
+    records = FlightRecorder::GetInstance().Dump();
+    ASSERT_FALSE(records.empty());
+    EXPECT_EQ(GetMessage(records.back()), "filtered debug message 42");
+}
+
+TEST(FlightRecorder, TestRecordsUpToRecorderLevel)
+{
+    uint64_t recordedCount;
+
+    otbrLogSetLevel(OTBR_LOG_WARNING);
+    otbrLogFlightRecorderSetEnabled(true);
+
+    // The default recorder level doesn't make debug messages more expensive.
+    EXPECT_EQ(otbrLogGetCaptureLevel(), OTBR_LOG_INFO);
+    recordedCount = FlightRecorder::GetInstance().GetRecordedCount();
+    otbrLogDebug("unrecorded debug message");
+    EXPECT_EQ(FlightRecorder::GetInstance().GetRecordedCount(), recordedCount);
+    otbrLogInfo("recorded info message");
+    EXPECT_EQ(FlightRecorder::GetInstance().GetRecordedCount(), recordedCount + 1);
+
+    // A more verbose log level is still captured.
+    otbrLogSetLevel(OTBR_LOG_DEBUG);
+    EXPECT_EQ(otbrLogGetCaptureLevel(), OTBR_LOG_DEBUG);
+
+    otbrLogFlightRecorderSetEnabled(false);
+    otbrLogSetLevel(OTBR_LOG_INFO);
+}
@@ -29,6 +29,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <netinet/icmp6.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include "common/mainloop_manager.hpp"
 #include "host/posix/infra_if.hpp"
 #include "host/posix/netif.hpp"
@@ -193,6 +197,61 @@ TEST(InfraIf, DepsUpdateInfraIfStateInvokedCorrectly_AfterInfraIfStateChange)
     netif.Deinit();
 }
 
+TEST(InfraIf, DepsSetInfraIfNotInvoked_AfterOtherInterfaceChanges)
+{
+    const std::string     fakeInfraIf = "wlx123";
+    const std::string     otherIf     = "wlx456";
+    otbr::MainloopContext context;
+
+    otbr::Netif::Dependencies defaultNetifDep;
+    otbr::Netif               netif(fakeInfraIf, defaultNetifDep);
+    otbr::Netif               otherNetif(otherIf, defaultNetifDep);
+    EXPECT_EQ(netif.Init(), OTBR_ERROR_NONE);
+    EXPECT_EQ(otherNetif.Init(), OTBR_ERROR_NONE);
+
+    const otIp6Address kTestAddr = {
+        {0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa5, 0x42, 0xb7, 0x91, 0x80, 0xc3, 0xf8}};
+    const otIp6Address kOtherAddr = {
+        {0xfd, 0x35, 0x7a, 0x7d, 0x0f, 0x16, 0xe7, 0xe3, 0x73, 0xf3, 0x09, 0x00, 0x8e, 0xbe, 0x1b, 0x65}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {{kTestAddr, 64, 0, 1, 0}};
+    netif.UpdateIp6UnicastAddresses(addrs);
+
+    InfraIfDependencyTest testInfraIfDep;
+    otbr::InfraIf         infraIf(testInfraIfDep);
+    infraIf.Init();
+    EXPECT_EQ(infraIf.SetInfraIf(fakeInfraIf), OTBR_ERROR_NONE);
+    EXPECT_EQ(testInfraIfDep.mIp6Addresses.size(), 1);
+
+    // The address changes of another interface are not reported as infra interface changes.
+    addrs = {{kOtherAddr, 64, 0, 1, 0}};
+    otherNetif.UpdateIp6UnicastAddresses(addrs);
+    testInfraIfDep.mSetInfraIfInvoked = false;
+
+    for (int i = 0; i < 5; i++)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+    EXPECT_FALSE(testInfraIfDep.mSetInfraIfInvoked);
+
+    infraIf.Deinit();
+    otherNetif.Deinit();
+    netif.Deinit();
+}
+
 TEST(InfraIf, DepsHandleIcmp6NdInvokedCorrectly_AfterInfraIfReceivesIcmp6Nd)
 {
     const std::string     fakeInfraIf = "wlx123";
@@ -256,4 +315,139 @@ TEST(InfraIf, DepsHandleIcmp6NdInvokedCorrectly_AfterInfraIfReceivesIcmp6Nd)
     infraIf.Deinit();
     netif.Deinit();
 }
+
+TEST(InfraIf, Icmp6CountersUpdatedCorrectly_AfterInfraIfReceivesIcmp6NdBatch)
+{
+    const std::string     fakeInfraIf = "wlx123";
+    otbr::MainloopContext context;
+
+    otbr::Netif::Dependencies defaultNetifDep;
+    otbr::Netif               netif(fakeInfraIf, defaultNetifDep);
+    EXPECT_EQ(netif.Init(), OTBR_ERROR_NONE);
+
+    const otIp6Address kLinkLocalAddr = {
+        {0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa5, 0x42, 0xb7, 0x91, 0x80, 0xc3, 0xf8}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {{kLinkLocalAddr, 64, 0, 1, 0}};
+    netif.UpdateIp6UnicastAddresses(addrs);
+
+    InfraIfDependencyTest testInfraIfDep;
+    otbr::InfraIf         infraIf(testInfraIfDep);
+    infraIf.Init();
+    EXPECT_EQ(infraIf.SetInfraIf(fakeInfraIf), OTBR_ERROR_NONE);
+    netif.SetNetifState(true);
+
+    // A Router Advertisement from fe80::dee5:5bff:fec6:8af3 to ff02::1
+    const uint8_t kTestMsg[] = {
+        0x60, 0x06, 0xce, 0x11, 0x00, 0x48, 0x3a, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xde, 0xe5, 0x5b, 0xff, 0xfe, 0xc6, 0x8a, 0xf3, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x00, 0xac, 0xf5, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0x04, 0x40, 0xc0, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00,
+        0xfd, 0x38, 0x5f, 0xf4, 0x61, 0x0b, 0x40, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x18, 0x02, 0x40, 0x00, 0x00, 0x00, 0x07, 0x08, 0xfd, 0x9f, 0x5c, 0xfa, 0x66, 0x3e, 0x00, 0x01,
+    };
+    const size_t kHopLimitOffset = 7;
+    const size_t kCodeOffset     = 41;
+    const size_t kChecksumOffset = 43;
+    uint8_t      badCodeMsg[sizeof(kTestMsg)];
+    uint8_t      badHopLimitMsg[sizeof(kTestMsg)];
+
+    // The kernel socket filter drops the RA with a non-zero code before it reaches user space.
+    memcpy(badCodeMsg, kTestMsg, sizeof(kTestMsg));
+    badCodeMsg[kCodeOffset]     = 0x01;
+    badCodeMsg[kChecksumOffset] = 0xf4;
+
+    // The RA with a hop limit other than 255 is dropped in user space.
+    memcpy(badHopLimitMsg, kTestMsg, sizeof(kTestMsg));
+    badHopLimitMsg[kHopLimitOffset] = 0x40;
+
+    netif.Ip6Receive(badCodeMsg, sizeof(badCodeMsg));
+    netif.Ip6Receive(badHopLimitMsg, sizeof(badHopLimitMsg));
+    netif.Ip6Receive(kTestMsg, sizeof(kTestMsg));
+    netif.Ip6Receive(kTestMsg, sizeof(kTestMsg));
+
+    for (int i = 0; i < 50 && infraIf.GetIcmp6Counters().mAccepted < 2; i++)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+
+    EXPECT_EQ(infraIf.GetIcmp6Counters().mAccepted, 2);
+    EXPECT_EQ(infraIf.GetIcmp6Counters().mFiltered, 1);
+    EXPECT_EQ(infraIf.GetIcmp6Counters().mRxErrors, 0);
+
+    infraIf.Deinit();
+    netif.Deinit();
+}
+
+TEST(InfraIf, Icmp6NdFilterDropsShortAndNonZeroCodeMessages)
+{
+    int     fds[2];
+    uint8_t buffer[64];
+    ssize_t rval;
+
+    // Each message is sent with the given length, only the type and code bytes are set.
+    struct
+    {
+        uint8_t mType;
+        uint8_t mCode;
+        size_t  mLength;
+        bool    mAccepted;
+    } kMessages[] = {
+        {ND_ROUTER_SOLICIT, 0, sizeof(nd_router_solicit), true},
+        {ND_ROUTER_SOLICIT, 0, sizeof(nd_router_solicit) - 1, false},
+        {ND_ROUTER_ADVERT, 0, sizeof(nd_router_advert) + 8, true},
+        {ND_ROUTER_ADVERT, 1, sizeof(nd_router_advert), false},
+        {ND_ROUTER_ADVERT, 0, 4, false},
+        {ND_NEIGHBOR_ADVERT, 0, sizeof(nd_neighbor_advert), true},
+        {ND_NEIGHBOR_ADVERT, 0, sizeof(nd_neighbor_advert) - 1, false},
+        {ND_NEIGHBOR_ADVERT, 2, sizeof(nd_neighbor_advert), false},
+        {ICMP6_ECHO_REQUEST, 0, 8, false},
+        {ND_ROUTER_SOLICIT, 0, 1, false},
+    };
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0, fds), 0);
+    ASSERT_EQ(otbr::InfraIf::AttachIcmp6NdFilter(fds[1]), OTBR_ERROR_NONE);
+
+    for (const auto &message : kMessages)
+    {
+        memset(buffer, 0, sizeof(buffer));
+        buffer[0] = message.mType;
+        buffer[1] = message.mCode;
+        ASSERT_EQ(send(fds[0], buffer, message.mLength, 0), static_cast<ssize_t>(message.mLength));
+    }
+
+    for (const auto &message : kMessages)
+    {
+        if (!message.mAccepted)
+        {
+            continue;
+        }
+
+        rval = recv(fds[1], buffer, sizeof(buffer), 0);
+        ASSERT_EQ(rval, static_cast<ssize_t>(message.mLength));
+        EXPECT_EQ(buffer[0], message.mType);
+        EXPECT_EQ(buffer[1], message.mCode);
+    }
+
+    // All the other messages are dropped by the filter.
+    EXPECT_EQ(recv(fds[1], buffer, sizeof(buffer), 0), -1);
+    EXPECT_TRUE(errno == EAGAIN || errno == EWOULDBLOCK);
+
+    close(fds[0]);
+    close(fds[1]);
+}
 #endif // __linux__
@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop_manager.hpp"
+#include "host/posix/netif.hpp"
+#include "utils/infra_link_selector.hpp"
+
+// Only Test on linux platform for now.
+#ifdef __linux__
+
+using otbr::Milliseconds;
+using otbr::Utils::InfraLinkSelector;
+
+// Runs the mainloop for `aTimeoutMs` and returns the infra link selected at the end, the selection is evaluated on
+// every iteration like the agent does.
+static std::string RunAndSelect(InfraLinkSelector &aSelector, uint32_t aTimeoutMs)
+{
+    otbr::MainloopContext context;
+    auto                  start = std::chrono::steady_clock::now();
+    std::string           selected;
+
+    while (true)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 10000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        otbr::MainloopManager::GetInstance().Process(context);
+
+        selected = aSelector.Select();
+
+        if (std::chrono::steady_clock::now() - start > Milliseconds(aTimeoutMs))
+        {
+            break;
+        }
+    }
+
+    return selected;
+}
+
+TEST(InfraLinkSelector, SwitchIsHeldBack_WhenSelectedLinkFlaps)
+{
+    otbr::Netif::Dependencies defaultNetifDep;
+    otbr::Netif               link0("ils0", defaultNetifDep);
+    otbr::Netif               link1("ils1", defaultNetifDep);
+    EXPECT_EQ(link0.Init(), OTBR_ERROR_NONE);
+    EXPECT_EQ(link1.Init(), OTBR_ERROR_NONE);
+    link0.SetNetifState(true);
+    link1.SetNetifState(true);
+
+    InfraLinkSelector selector({"ils0", "ils1"});
+    selector.SetHysteresis(Milliseconds(500), Milliseconds(0));
+    EXPECT_EQ(std::string(selector.Select()), "ils0");
+
+    // The selected link recovers within the down delay every time.
+    for (int i = 0; i < 3; i++)
+    {
+        link0.SetNetifState(false);
+        EXPECT_EQ(RunAndSelect(selector, 50), "ils0");
+        link0.SetNetifState(true);
+        EXPECT_EQ(RunAndSelect(selector, 50), "ils0");
+    }
+
+    EXPECT_EQ(selector.GetCounters().mSwitchesTaken, 0);
+    // The flaps keep holding back the same switch within the down delay.
+    EXPECT_EQ(selector.GetCounters().mSwitchesAvoided, 1);
+    EXPECT_EQ(selector.GetCounters().mStateChanges, 6);
+    ASSERT_EQ(selector.GetStateHistory().size(), 6);
+    EXPECT_EQ(std::string(selector.GetStateHistory().back().mInfraLinkName), "ils0");
+    EXPECT_EQ(selector.GetStateHistory().back().mState, InfraLinkSelector::kUpAndRunning);
+
+    // The selected link stays down for longer than the down delay.
+    link0.SetNetifState(false);
+    EXPECT_EQ(RunAndSelect(selector, 800), "ils1");
+    EXPECT_EQ(selector.GetCounters().mSwitchesTaken, 1);
+    EXPECT_EQ(selector.GetStateHistory().back().mState, InfraLinkSelector::kDown);
+
+    link1.Deinit();
+    link0.Deinit();
+}
+
+TEST(InfraLinkSelector, SwitchIsHeldBack_UntilOtherLinkIsRunningForUpDelay)
+{
+    otbr::Netif::Dependencies defaultNetifDep;
+    otbr::Netif               link0("ils0", defaultNetifDep);
+    otbr::Netif               link1("ils1", defaultNetifDep);
+    EXPECT_EQ(link0.Init(), OTBR_ERROR_NONE);
+    EXPECT_EQ(link1.Init(), OTBR_ERROR_NONE);
+    link0.SetNetifState(true);
+
+    InfraLinkSelector selector({"ils0", "ils1"});
+    selector.SetHysteresis(Milliseconds(0), Milliseconds(500));
+    EXPECT_EQ(std::string(selector.Select()), "ils0");
+
+    link1.SetNetifState(true);
+    link0.SetNetifState(false);
+    EXPECT_EQ(RunAndSelect(selector, 100), "ils0");
+    EXPECT_EQ(selector.GetCounters().mSwitchesTaken, 0);
+    EXPECT_EQ(selector.GetCounters().mSwitchesAvoided, 1);
+
+    EXPECT_EQ(RunAndSelect(selector, 700), "ils1");
+    EXPECT_EQ(selector.GetCounters().mSwitchesTaken, 1);
+    EXPECT_EQ(selector.GetCounters().mSwitchesAvoided, 1);
+
+    link1.Deinit();
+    link0.Deinit();
+}
+
+#endif // __linux__
@@ -0,0 +1,147 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TEST"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "common/log_rate_limiter.hpp"
+
+using otbr::LogRateLimiter;
+
+TEST(LogRateLimiter, TestBurstAndRefill)
+{
+    LogRateLimiter limiter(OTBR_LOG_INFO, OTBR_LOG_TAG, __FILE__, __LINE__);
+    uint32_t       suppressed;
+
+    for (uint32_t i = 0; i < LogRateLimiter::kBurstSize; i++)
+    {
+        EXPECT_TRUE(limiter.Allow(suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        EXPECT_FALSE(limiter.Allow(suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+
+    std::this_thread::sleep_for(LogRateLimiter::kTokenInterval + otbr::Milliseconds(100));
+
+    // The next allowed message reports the suppressed ones.
+    EXPECT_TRUE(limiter.Allow(suppressed));
+    EXPECT_EQ(suppressed, 5u);
+    EXPECT_FALSE(limiter.Allow(suppressed));
+    EXPECT_EQ(suppressed, 0u);
+}
+
+TEST(LogRateLimiter, TestSiteCounters)
+{
+    uint64_t totalSuppressed = LogRateLimiter::GetTotalSuppressedCount();
+    int      line            = __LINE__;
+
+    {
+        LogRateLimiter limiter(OTBR_LOG_INFO, OTBR_LOG_TAG, "/path/to/test_file.cpp", line);
+        uint32_t       suppressed;
+        bool           found = false;
+
+        for (uint32_t i = 0; i < LogRateLimiter::kBurstSize + 3; i++)
+        {
+            limiter.Allow(suppressed);
+        }
+
+        EXPECT_EQ(LogRateLimiter::GetTotalSuppressedCount(), totalSuppressed + 3);
+
+        for (const LogRateLimiter::SiteCounter &counter : LogRateLimiter::GetSiteCounters())
+        {
+            if (counter.mLocation == "test_file.cpp:" + std::to_string(line))
+            {
+                found = true;
+                EXPECT_EQ(counter.mSuppressedCount, 3u);
+            }
+        }
+
+        EXPECT_TRUE(found);
+    }
+
+    // The call site is unregistered when the limiter is destroyed.
+    for (const LogRateLimiter::SiteCounter &counter : LogRateLimiter::GetSiteCounters())
+    {
+        EXPECT_NE(counter.mLocation, "test_file.cpp:" + std::to_string(line));
+    }
+}
+
+TEST(LogRateLimiter, TestPendingReportAfterSilence)
+{
+    LogRateLimiter  limiter(OTBR_LOG_INFO, OTBR_LOG_TAG, __FILE__, __LINE__);
+    uint32_t        suppressed;
+    otbr::Timepoint start = otbr::Clock::now();
+    otbr::Timepoint reportTime;
+
+    for (uint32_t i = 0; i < LogRateLimiter::kBurstSize + 3; i++)
+    {
+        limiter.Allow(suppressed);
+    }
+
+    // The report is due once the call site is allowed to log again.
+    ASSERT_TRUE(LogRateLimiter::GetNextReportTime(reportTime));
+    EXPECT_GE(reportTime, start + LogRateLimiter::kTokenInterval);
+    EXPECT_LE(reportTime, otbr::Clock::now() + LogRateLimiter::kTokenInterval);
+
+    LogRateLimiter::ReportDueSuppressions(reportTime - otbr::Milliseconds(1));
+    EXPECT_TRUE(LogRateLimiter::GetNextReportTime(reportTime));
+
+    // The call site stays silent, the pending report is logged without it.
+    LogRateLimiter::ReportDueSuppressions(reportTime);
+    EXPECT_FALSE(LogRateLimiter::GetNextReportTime(reportTime));
+
+    std::this_thread::sleep_for(LogRateLimiter::kTokenInterval + otbr::Milliseconds(100));
+
+    EXPECT_TRUE(limiter.Allow(suppressed));
+    EXPECT_EQ(suppressed, 0u);
+}
+
+TEST(LogRateLimiter, TestFilteredByLogLevel)
+{
+    uint64_t     totalSuppressed = LogRateLimiter::GetTotalSuppressedCount();
+    otbrLogLevel level           = otbrLogGetLevel();
+
+    otbrLogSetLevel(OTBR_LOG_INFO);
+
+    // Messages filtered by the log level don't consume tokens.
+    for (uint32_t i = 0; i < LogRateLimiter::kBurstSize * 2; i++)
+    {
+        otbrLogRateLimited(OTBR_LOG_DEBUG, "filtered %u", i);
+    }
+
+    EXPECT_EQ(LogRateLimiter::GetTotalSuppressedCount(), totalSuppressed);
+
+    otbrLogSetLevel(level);
+}
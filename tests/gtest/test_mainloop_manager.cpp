@@ -0,0 +1,377 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "common/mainloop_manager.hpp"
+
+namespace {
+
+int RunOnce(otbr::MainloopManager &aManager, otbr::MainloopContext &aMainloop)
+{
+    aMainloop.mMaxFd   = -1;
+    aMainloop.mTimeout = {0, 100000};
+
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+
+    aManager.Update(aMainloop);
+
+    return select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                  &aMainloop.mTimeout);
+}
+
+class TestProcessor : public otbr::MainloopProcessor
+{
+public:
+    TestProcessor(otbr::MainloopManager &aManager, const char *aName)
+        : mManager(aManager)
+        , mName(aName)
+        , mTimeout({1, 0})
+        , mTasksPerProcess(0)
+        , mRemoveInProcess(false)
+        , mSharedFd(-1)
+    {
+        EXPECT_EQ(pipe(mFds), 0);
+        mManager.AddMainloopProcessor(this);
+    }
+
+    ~TestProcessor(void) override
+    {
+        mManager.RemoveMainloopProcessor(this);
+        close(mFds[0]);
+        close(mFds[1]);
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override
+    {
+        aMainloop.AddFdToReadSet(mFds[0]);
+
+        if (mSharedFd != -1)
+        {
+            aMainloop.AddFdToReadSet(mSharedFd);
+        }
+
+        if (timercmp(&mTimeout, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = mTimeout;
+        }
+    }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        uint8_t byte;
+
+        if (FD_ISSET(mFds[0], &aMainloop.mReadFdSet))
+        {
+            EXPECT_EQ(read(mFds[0], &byte, sizeof(byte)), 1);
+        }
+
+        if (mTasksPerProcess > 0)
+        {
+            mManager.RecordTasksRun(mTasksPerProcess);
+        }
+
+        if (mRemoveInProcess)
+        {
+            mManager.RemoveMainloopProcessor(this);
+        }
+    }
+
+    const char *GetName(void) const override { return mName; }
+
+    void Notify(void)
+    {
+        const uint8_t kOne = 1;
+
+        EXPECT_EQ(write(mFds[1], &kOne, sizeof(kOne)), 1);
+    }
+
+    otbr::MainloopManager &mManager;
+    const char            *mName;
+    int                    mFds[2];
+    struct timeval         mTimeout;
+    uint32_t               mTasksPerProcess;
+    bool                   mRemoveInProcess;
+    int                    mSharedFd;
+};
+
+const otbr::MainloopProcessorStats *FindStats(const std::vector<otbr::MainloopProcessorStats> &aStats,
+                                              const std::string                               &aName)
+{
+    for (const auto &stats : aStats)
+    {
+        if (stats.mName == aName)
+        {
+            return &stats;
+        }
+    }
+
+    return nullptr;
+}
+
+uint64_t SumHistogram(const otbr::MainloopProcessorStats &aStats)
+{
+    return std::accumulate(aStats.mProcessTimeHistogram.begin(), aStats.mProcessTimeHistogram.end(), uint64_t{0});
+}
+
+} // namespace
+
+TEST(MainloopManager, TestFdCallbackOnlyForReadyFds)
+{
+    otbr::MainloopManager manager;
+    otbr::MainloopContext mainloop;
+    int                   pipe1[2];
+    int                   pipe2[2];
+    std::vector<int>      readyFds;
+    const uint8_t         kOne = 1;
+
+    ASSERT_EQ(pipe(pipe1), 0);
+    ASSERT_EQ(pipe(pipe2), 0);
+
+    for (int fd : {pipe1[0], pipe2[0]})
+    {
+        EXPECT_EQ(manager.AddFd(fd, otbr::MainloopContext::kReadFdSet,
+                                [&readyFds, fd](uint8_t aEvents) {
+                                    EXPECT_EQ(aEvents, otbr::MainloopContext::kReadFdSet);
+                                    readyFds.push_back(fd);
+                                }),
+                  OTBR_ERROR_NONE);
+    }
+    EXPECT_EQ(manager.AddFd(pipe1[0], otbr::MainloopContext::kReadFdSet, [](uint8_t) {}), OTBR_ERROR_DUPLICATED);
+
+    // Nothing is readable.
+    EXPECT_EQ(RunOnce(manager, mainloop), 0);
+    manager.Process(mainloop);
+    EXPECT_TRUE(readyFds.empty());
+
+    ASSERT_EQ(write(pipe2[1], &kOne, sizeof(kOne)), 1);
+    EXPECT_EQ(RunOnce(manager, mainloop), 1);
+    manager.Process(mainloop);
+    ASSERT_EQ(readyFds.size(), 1u);
+    EXPECT_EQ(readyFds[0], pipe2[0]);
+
+    manager.RemoveFd(pipe1[0]);
+    manager.RemoveFd(pipe2[0]);
+
+    // No longer watched, the epoll fd is not added to the mainloop.
+    readyFds.clear();
+    EXPECT_EQ(RunOnce(manager, mainloop), 0);
+    EXPECT_EQ(mainloop.mMaxFd, -1);
+    manager.Process(mainloop);
+    EXPECT_TRUE(readyFds.empty());
+
+    for (int fd : {pipe1[0], pipe1[1], pipe2[0], pipe2[1]})
+    {
+        close(fd);
+    }
+}
+
+TEST(MainloopManager, TestRemoveFdInCallback)
+{
+    otbr::MainloopManager manager;
+    otbr::MainloopContext mainloop;
+    int                   fds[2];
+    int                   counter = 0;
+    const uint8_t         kOne    = 1;
+
+    ASSERT_EQ(pipe(fds), 0);
+
+    EXPECT_EQ(manager.AddFd(fds[0], otbr::MainloopContext::kReadFdSet,
+                            [&](uint8_t) {
+                                ++counter;
+                                manager.RemoveFd(fds[0]);
+                            }),
+              OTBR_ERROR_NONE);
+
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+
+    EXPECT_EQ(RunOnce(manager, mainloop), 1);
+    manager.Process(mainloop);
+    EXPECT_EQ(counter, 1);
+
+    // The fd is still readable but is no longer watched.
+    EXPECT_EQ(RunOnce(manager, mainloop), 0);
+    manager.Process(mainloop);
+    EXPECT_EQ(counter, 1);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestUpdateFd)
+{
+    otbr::MainloopManager manager;
+    otbr::MainloopContext mainloop;
+    int                   fds[2];
+    uint8_t               events = 0;
+
+    ASSERT_EQ(pipe(fds), 0);
+
+    EXPECT_EQ(manager.UpdateFd(fds[1], otbr::MainloopContext::kWriteFdSet), OTBR_ERROR_NOT_FOUND);
+    EXPECT_EQ(manager.AddFd(fds[1], 0, [&events](uint8_t aEvents) { events = aEvents; }), OTBR_ERROR_NONE);
+
+    EXPECT_EQ(RunOnce(manager, mainloop), 0);
+    manager.Process(mainloop);
+    EXPECT_EQ(events, 0);
+
+    EXPECT_EQ(manager.UpdateFd(fds[1], otbr::MainloopContext::kWriteFdSet), OTBR_ERROR_NONE);
+    EXPECT_EQ(RunOnce(manager, mainloop), 1);
+    manager.Process(mainloop);
+    EXPECT_EQ(events, otbr::MainloopContext::kWriteFdSet);
+
+    manager.RemoveFd(fds[1]);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestProcessorStats)
+{
+    otbr::MainloopManager                     manager;
+    otbr::MainloopContext                     mainloop;
+    TestProcessor                             fdProcessor(manager, "Fd");
+    TestProcessor                             timerProcessor(manager, "Timer");
+    std::vector<otbr::MainloopProcessorStats> stats;
+    const otbr::MainloopProcessorStats       *fdStats;
+    const otbr::MainloopProcessorStats       *timerStats;
+
+    fdProcessor.mTasksPerProcess = 3;
+    timerProcessor.mTimeout      = {0, 1000};
+
+    // Ignored as no processor is being processed.
+    manager.RecordTasksRun(10);
+
+    // Woken up by the fd of `fdProcessor`.
+    fdProcessor.Notify();
+    EXPECT_EQ(RunOnce(manager, mainloop), 1);
+    manager.Process(mainloop);
+
+    // Woken up by the timeout of `timerProcessor`.
+    EXPECT_EQ(RunOnce(manager, mainloop), 0);
+    manager.Process(mainloop);
+
+    stats = manager.GetProcessorStats();
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].mName, "Fd");
+    EXPECT_EQ(stats[1].mName, "Timer");
+
+    fdStats    = FindStats(stats, "Fd");
+    timerStats = FindStats(stats, "Timer");
+    ASSERT_NE(fdStats, nullptr);
+    ASSERT_NE(timerStats, nullptr);
+
+    EXPECT_EQ(fdStats->mIterations, 2u);
+    EXPECT_EQ(fdStats->mWakeups, 1u);
+    EXPECT_EQ(fdStats->mTasksRun, 6u);
+    EXPECT_EQ(fdStats->mFdCount, 1u);
+    EXPECT_EQ(SumHistogram(*fdStats), 2u);
+    EXPECT_LE(fdStats->mMaxProcessTimeUs, fdStats->mProcessTimeUs);
+
+    EXPECT_EQ(timerStats->mIterations, 2u);
+    EXPECT_EQ(timerStats->mWakeups, 1u);
+    EXPECT_EQ(timerStats->mTasksRun, 0u);
+    EXPECT_EQ(timerStats->mFdCount, 1u);
+    EXPECT_EQ(SumHistogram(*timerStats), 2u);
+}
+
+TEST(MainloopManager, TestSharedFdStats)
+{
+    otbr::MainloopManager                     manager;
+    otbr::MainloopContext                     mainloop;
+    TestProcessor                             processor1(manager, "Processor1");
+    TestProcessor                             processor2(manager, "Processor2");
+    std::vector<otbr::MainloopProcessorStats> stats;
+    int                                       sharedFds[2];
+    const uint8_t                             kOne = 1;
+
+    ASSERT_EQ(pipe(sharedFds), 0);
+    processor1.mSharedFd = sharedFds[0];
+    processor2.mSharedFd = sharedFds[0];
+
+    // The shared fd is attributed to both processors.
+    EXPECT_EQ(write(sharedFds[1], &kOne, sizeof(kOne)), 1);
+    EXPECT_EQ(RunOnce(manager, mainloop), 1);
+    EXPECT_TRUE(FD_ISSET(processor1.mFds[0], &mainloop.mReadFdSet) == 0);
+    EXPECT_TRUE(FD_ISSET(sharedFds[0], &mainloop.mReadFdSet) != 0);
+    manager.Process(mainloop);
+
+    stats = manager.GetProcessorStats();
+    ASSERT_EQ(stats.size(), 2u);
+    for (const auto &processorStats : stats)
+    {
+        EXPECT_EQ(processorStats.mFdCount, 2u);
+        EXPECT_EQ(processorStats.mWakeups, 1u);
+    }
+
+    // The shared fd is no longer attributed to a processor once it stops adding it.
+    processor2.mSharedFd = -1;
+    EXPECT_EQ(RunOnce(manager, mainloop), 1);
+    EXPECT_TRUE(FD_ISSET(sharedFds[0], &mainloop.mReadFdSet) != 0);
+    manager.Process(mainloop);
+
+    stats = manager.GetProcessorStats();
+    EXPECT_EQ(FindStats(stats, "Processor1")->mFdCount, 2u);
+    EXPECT_EQ(FindStats(stats, "Processor2")->mFdCount, 1u);
+    EXPECT_EQ(FindStats(stats, "Processor1")->mWakeups, 2u);
+    EXPECT_EQ(FindStats(stats, "Processor2")->mWakeups, 1u);
+
+    close(sharedFds[0]);
+    close(sharedFds[1]);
+}
+
+TEST(MainloopManager, TestRemoveProcessorInProcess)
+{
+    otbr::MainloopManager                     manager;
+    otbr::MainloopContext                     mainloop;
+    TestProcessor                             first(manager, "First");
+    TestProcessor                             second(manager, "Second");
+    std::vector<otbr::MainloopProcessorStats> stats;
+
+    first.mRemoveInProcess = true;
+    first.mTimeout         = {0, 0};
+
+    EXPECT_EQ(RunOnce(manager, mainloop), 0);
+    manager.Process(mainloop);
+
+    stats = manager.GetProcessorStats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].mName, "Second");
+    EXPECT_EQ(stats[0].mIterations, 1u);
+
+    EXPECT_EQ(RunOnce(manager, mainloop), 0);
+    manager.Process(mainloop);
+
+    stats = manager.GetProcessorStats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].mIterations, 2u);
+}
@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/mpsc_queue.hpp"
+
+TEST(MpscQueue, TestSingleThread)
+{
+    otbr::MpscQueue<int> queue;
+    int                  item;
+
+    EXPECT_FALSE(queue.Pop(item));
+
+    queue.Push(1);
+    queue.Push(2);
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_EQ(item, 1);
+
+    queue.Push(3);
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_EQ(item, 2);
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_EQ(item, 3);
+    EXPECT_FALSE(queue.Pop(item));
+
+    // Items left in the queue are released by the destructor.
+    queue.Push(4);
+}
+
+TEST(MpscQueue, TestMultipleProducers)
+{
+    constexpr int            kNumProducers = 4;
+    constexpr int            kNumItems     = 10000;
+    otbr::MpscQueue<int>     queue;
+    std::vector<std::thread> producers;
+    std::vector<int>         lastItems(kNumProducers, -1);
+    int                      popped = 0;
+
+    for (int i = 0; i < kNumProducers; ++i)
+    {
+        producers.emplace_back([&queue, i]() {
+            for (int j = 0; j < kNumItems; ++j)
+            {
+                queue.Push(i * kNumItems + j);
+            }
+        });
+    }
+
+    while (popped < kNumProducers * kNumItems)
+    {
+        int item;
+
+        if (!queue.Pop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Items from the same producer are popped in the order of pushing.
+        EXPECT_GT(item % kNumItems, lastItems[item / kNumItems]);
+        lastItems[item / kNumItems] = item % kNumItems;
+        ++popped;
+    }
+
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    for (int lastItem : lastItems)
+    {
+        EXPECT_EQ(lastItem, kNumItems - 1);
+    }
+}
@@ -29,15 +29,20 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <arpa/inet.h>
+#include <chrono>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <ifaddrs.h>
 #include <iostream>
+#include <mutex>
 #include <net/if.h>
 #include <netinet/in.h>
 #include <netinet/ip6.h>
 #include <netinet/udp.h>
+#include <numeric>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -371,6 +376,51 @@ TEST(Netif, WpanIfHasCorrectUnicastAddresses_AfterUpdatingUnicastAddresses)
     netif.Deinit();
 }
 
+TEST(Netif, WpanIfHasCorrectUnicastAddresses_AfterUpdatingManyUnicastAddresses)
+{
+    const char  *wpan      = "wpan0";
+    const size_t kNumAddrs = 200; // Needs more than one netlink batch.
+
+    otbr::Netif                       netif(wpan, sDefaultNetifDependencies);
+    std::vector<otbr::Ip6AddressInfo> addrs;
+    std::vector<std::string>          wpan_addrs;
+
+    EXPECT_EQ(netif.Init(), OT_ERROR_NONE);
+
+    for (size_t i = 0; i < kNumAddrs; i++)
+    {
+        otIp6Address address = {
+            {0xfd, 0x0d, 0x07, 0xfc, 0xa1, 0xb9, 0xf0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+        address.mFields.m8[14] = static_cast<uint8_t>(i >> 8);
+        address.mFields.m8[15] = static_cast<uint8_t>(i & 0xff);
+        addrs.emplace_back(address, 64, 0, 1, 0);
+    }
+
+    netif.UpdateIp6UnicastAddresses(addrs);
+    wpan_addrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpan_addrs.size(), kNumAddrs);
+    EXPECT_THAT(wpan_addrs, ::testing::Contains("fd0d:7fc:a1b9:f050::"));
+    EXPECT_THAT(wpan_addrs, ::testing::Contains("fd0d:7fc:a1b9:f050::c7"));
+
+    // Replaces the first half of the addresses.
+    addrs.erase(addrs.begin(), addrs.begin() + kNumAddrs / 2);
+    addrs.back().mAddress.mFields.m8[13] = 0xff;
+    netif.UpdateIp6UnicastAddresses(addrs);
+    wpan_addrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpan_addrs.size(), kNumAddrs / 2);
+    EXPECT_THAT(wpan_addrs, ::testing::Not(::testing::Contains("fd0d:7fc:a1b9:f050::")));
+    EXPECT_THAT(wpan_addrs, ::testing::Not(::testing::Contains("fd0d:7fc:a1b9:f050::c7")));
+    EXPECT_THAT(wpan_addrs, ::testing::Contains("fd0d:7fc:a1b9:f050::64"));
+    EXPECT_THAT(wpan_addrs, ::testing::Contains("fd0d:7fc:a1b9:f050::ff:c7"));
+
+    netif.UpdateIp6UnicastAddresses({});
+    wpan_addrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpan_addrs.size(), 0);
+
+    netif.Deinit();
+}
+
 TEST(Netif, WpanIfHasCorrectMulticastAddresses_AfterUpdatingMulticastAddresses)
 {
     const char *wpan = "wpan0";
@@ -650,6 +700,460 @@ TEST(Netif, WpanIfSendIp6PacketCorrectly_AfterReceivingOnIf)
     netif.Deinit();
 }
 
+class NetifDependencyTestIp6SendBatch : public otbr::Netif::Dependencies
+{
+public:
+    otbrError Ip6SendBatch(otbr::PacketBuffer *aPackets, size_t aCount, size_t &aSentCount) override
+    {
+        for (size_t i = 0; i < aCount; i++)
+        {
+            const ip6_hdr *ipv6_header = reinterpret_cast<const ip6_hdr *>(aPackets[i].GetData());
+
+            if (aPackets[i].GetHeadroom() < otbr::Netif::kIp6SendHeadroom)
+            {
+                mNumMissingHeadroom++;
+            }
+
+            if (ipv6_header->ip6_nxt == IPPROTO_UDP)
+            {
+                mNumUdpPackets++;
+            }
+        }
+
+        mMaxBatchSize = std::max(mMaxBatchSize, aCount);
+        aSentCount    = aCount;
+
+        return OTBR_ERROR_NONE;
+    }
+
+    size_t mNumUdpPackets      = 0;
+    size_t mNumMissingHeadroom = 0;
+    size_t mMaxBatchSize       = 0;
+};
+
+TEST(Netif, WpanIfSendIp6PacketsInBatches_AfterReceivingBurstOnIf)
+{
+    static constexpr size_t kNumPackets = 10;
+    static constexpr size_t kBatchSize  = 4;
+
+    NetifDependencyTestIp6SendBatch netifDependency;
+    const char                     *hello = "Hello Otbr Netif!";
+    otbr::Netif                     netif("wpan0", netifDependency);
+
+    netif.SetIp6SendBatchSize(kBatchSize);
+    EXPECT_EQ(netif.Init(), OT_ERROR_NONE);
+
+    // OMR Prefix: fd76:a5d1:fcb0:1707::/64
+    const otIp6Address kOmr = {
+        {0xfd, 0x76, 0xa5, 0xd1, 0xfc, 0xb0, 0x17, 0x07, 0xf3, 0xc7, 0xd8, 0x8c, 0xef, 0xd1, 0x24, 0xa9}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    // Queue a burst of UDP packets in the TUN device before running the mainloop.
+    {
+        int                 sockFd;
+        struct sockaddr_in6 destAddr;
+
+        ASSERT_GE(sockFd = socket(AF_INET6, SOCK_DGRAM, 0), 0);
+
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin6_family = AF_INET6;
+        destAddr.sin6_port   = htons(12345);
+        inet_pton(AF_INET6, "fd76:a5d1:fcb0:1707:3f1:47ce:85d3:77f", &(destAddr.sin6_addr));
+
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            ASSERT_GE(sendto(sockFd, hello, strlen(hello), 0, (const struct sockaddr *)&destAddr, sizeof(destAddr)), 0);
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    for (int i = 0; i < 100 && netifDependency.mNumUdpPackets < kNumPackets; i++)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        ASSERT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                         &context.mTimeout),
+                  0);
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+
+    EXPECT_EQ(netifDependency.mNumUdpPackets, kNumPackets);
+    EXPECT_LE(netifDependency.mMaxBatchSize, kBatchSize);
+    EXPECT_GT(netifDependency.mMaxBatchSize, 1u);
+    EXPECT_GE(netif.GetIp6SendBatchCounters().mPackets, kNumPackets);
+    EXPECT_GE(netif.GetIp6SendBatchCounters().mFullBatches, 1u);
+    EXPECT_EQ(netif.GetIp6SendBatchCounters().mMaxBatchSize, netifDependency.mMaxBatchSize);
+    EXPECT_EQ(netif.GetIp6SendBatchCounters().mSendFailures, 0u);
+    EXPECT_EQ(netifDependency.mNumMissingHeadroom, 0u);
+
+    // The buffers are recycled across the batches.
+    EXPECT_EQ(netif.GetIp6SendPoolCounters().mInUse, 0u);
+    EXPECT_LE(netif.GetIp6SendPoolCounters().mCreatedBuffers, kBatchSize);
+    EXPECT_EQ(netif.GetIp6SendPoolCounters().mFailures, 0u);
+
+    netif.Deinit();
+}
+
+class NetifDependencyTestPartialIp6SendBatch : public otbr::Netif::Dependencies
+{
+public:
+    otbrError Ip6SendBatch(otbr::PacketBuffer *aPackets, size_t aCount, size_t &aSentCount) override
+    {
+        OTBR_UNUSED_VARIABLE(aPackets);
+
+        // Only takes the first packet of each batch.
+        mNumReceived += aCount;
+        aSentCount = std::min<size_t>(aCount, 1);
+
+        return aSentCount == aCount ? OTBR_ERROR_NONE : OTBR_ERROR_OPENTHREAD;
+    }
+
+    size_t mNumReceived = 0;
+};
+
+TEST(Netif, WpanIfCountsUnsentIp6PacketsAsDrops_WhenBatchIsPartiallySent)
+{
+    static constexpr size_t kNumPackets = 10;
+    static constexpr size_t kBatchSize  = 4;
+
+    NetifDependencyTestPartialIp6SendBatch netifDependency;
+    const char                            *hello = "Hello Otbr Netif!";
+    otbr::Netif                            netif("wpan0", netifDependency);
+
+    netif.SetIp6SendBatchSize(kBatchSize);
+    EXPECT_EQ(netif.Init(), OT_ERROR_NONE);
+
+    // OMR Prefix: fd76:a5d1:fcb0:1707::/64
+    const otIp6Address kOmr = {
+        {0xfd, 0x76, 0xa5, 0xd1, 0xfc, 0xb0, 0x17, 0x07, 0xf3, 0xc7, 0xd8, 0x8c, 0xef, 0xd1, 0x24, 0xa9}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    {
+        int                 sockFd;
+        struct sockaddr_in6 destAddr;
+
+        ASSERT_GE(sockFd = socket(AF_INET6, SOCK_DGRAM, 0), 0);
+
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin6_family = AF_INET6;
+        destAddr.sin6_port   = htons(12345);
+        inet_pton(AF_INET6, "fd76:a5d1:fcb0:1707:3f1:47ce:85d3:77f", &(destAddr.sin6_addr));
+
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            ASSERT_GE(sendto(sockFd, hello, strlen(hello), 0, (const struct sockaddr *)&destAddr, sizeof(destAddr)), 0);
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    for (int i = 0; i < 100 && netifDependency.mNumReceived < kNumPackets; i++)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        ASSERT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                         &context.mTimeout),
+                  0);
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+
+    {
+        otbr::Netif::Counters counters = netif.GetCounters();
+
+        EXPECT_GE(netifDependency.mNumReceived, kNumPackets);
+        EXPECT_GT(counters.mSendDrops, 0u);
+        EXPECT_EQ(counters.mToThread.mPackets + counters.mSendDrops, netifDependency.mNumReceived);
+        EXPECT_EQ(counters.mSendDrops, netif.GetIp6SendBatchCounters().mSendFailures);
+    }
+
+    netif.Deinit();
+}
+
+TEST(Netif, WpanIfForwardsIp6PacketsOnDatapathThread_WhenDatapathThreadEnabled)
+{
+    static constexpr size_t kNumPackets = 10;
+
+    NetifDependencyTestIp6SendBatch netifDependency;
+    const char                     *hello = "Hello Otbr Netif!";
+    otbr::Netif                     netif("wpan0", netifDependency);
+
+    netif.SetDatapathThreadEnabled(true);
+    ASSERT_EQ(netif.Init(), OTBR_ERROR_NONE);
+    EXPECT_TRUE(netif.IsDatapathThreadEnabled());
+
+    const otIp6Address kOmr = {
+        {0xfd, 0x2a, 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8b}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    // The packet from the NCP is written to the TUN by the datapath thread.
+    {
+        int                 sockFd;
+        struct sockaddr_in6 listenAddr;
+        uint8_t             recvBuf[kMaxIp6Size];
+        fd_set              readFds;
+        struct timeval      timeout = {3, 0};
+
+        ASSERT_GE(sockFd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK, 0), 0);
+        memset(&listenAddr, 0, sizeof(listenAddr));
+        listenAddr.sin6_family = AF_INET6;
+        listenAddr.sin6_port   = htons(12345);
+        inet_pton(AF_INET6, "fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b", &(listenAddr.sin6_addr));
+        ASSERT_EQ(bind(sockFd, (const struct sockaddr *)&listenAddr, sizeof(listenAddr)), 0);
+
+        std::thread producerThread(producerTask, std::ref(netif));
+
+        FD_ZERO(&readFds);
+        FD_SET(sockFd, &readFds);
+        EXPECT_GT(select(sockFd + 1, &readFds, nullptr, nullptr, &timeout), 0);
+        EXPECT_EQ(recv(sockFd, recvBuf, sizeof(recvBuf), 0), static_cast<ssize_t>(strlen(hello)));
+
+        producerThread.join();
+        close(sockFd);
+    }
+
+    // The packets to the Thread network are read by the datapath thread and sent in the mainloop.
+    {
+        int                 sockFd;
+        struct sockaddr_in6 destAddr;
+
+        ASSERT_GE(sockFd = socket(AF_INET6, SOCK_DGRAM, 0), 0);
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin6_family = AF_INET6;
+        destAddr.sin6_port   = htons(12345);
+        inet_pton(AF_INET6, "fd2a:c30c:87d3:1:ed1c:c91:ccb6:578a", &(destAddr.sin6_addr));
+
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            ASSERT_GE(sendto(sockFd, hello, strlen(hello), 0, (const struct sockaddr *)&destAddr, sizeof(destAddr)), 0);
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    for (int i = 0; i < 100 && netifDependency.mNumUdpPackets < kNumPackets; i++)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        ASSERT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                         &context.mTimeout),
+                  0);
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+
+    EXPECT_EQ(netifDependency.mNumUdpPackets, kNumPackets);
+    EXPECT_EQ(netifDependency.mNumMissingHeadroom, 0u);
+    EXPECT_EQ(netif.GetIp6SendBatchCounters().mSendFailures, 0u);
+
+    {
+        otbr::Netif::Counters counters = netif.GetCounters();
+        uint64_t              numQueued =
+            std::accumulate(counters.mToThread.mLatencyHistogram.begin(), counters.mToThread.mLatencyHistogram.end(),
+                            static_cast<uint64_t>(0));
+
+        EXPECT_EQ(counters.mFromThread.mPackets, 1u);
+        EXPECT_EQ(counters.mFromThread.mBytes, 65u);
+        EXPECT_GE(counters.mToThread.mPackets, kNumPackets);
+        EXPECT_EQ(numQueued, counters.mToThread.mPackets);
+        EXPECT_EQ(counters.mTunWriteDrops, 0u);
+        EXPECT_EQ(counters.mNoBufferDrops, 0u);
+    }
+
+    netif.Deinit();
+    EXPECT_EQ(netif.GetIp6SendPoolCounters().mInUse, 0u);
+}
+
+class NetifDependencyTestHoldIp6SendBatch : public otbr::Netif::Dependencies
+{
+public:
+    otbrError Ip6SendBatch(otbr::PacketBuffer *aPackets, size_t aCount, size_t &aSentCount) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Keeps the buffers as a slow coprocessor would.
+        mPackets.insert(mPackets.end(), aPackets, aPackets + aCount);
+        mNumPackets += aCount;
+        aSentCount = aCount;
+
+        return OTBR_ERROR_NONE;
+    }
+
+    size_t GetNumHeldPackets(void)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mPackets.size();
+    }
+
+    size_t GetNumPackets(void)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mNumPackets;
+    }
+
+    void ReleasePackets(void)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mPackets.clear();
+    }
+
+private:
+    std::mutex                      mMutex;
+    std::vector<otbr::PacketBuffer> mPackets;
+    size_t                          mNumPackets = 0;
+};
+
+static void RunMainloopOnce(void)
+{
+    otbr::MainloopContext context;
+
+    context.mMaxFd   = -1;
+    context.mTimeout = {0, 10000};
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+
+    otbr::MainloopManager::GetInstance().Update(context);
+    ASSERT_GE(
+        select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet, &context.mTimeout),
+        0);
+    otbr::MainloopManager::GetInstance().Process(context);
+}
+
+// Runs the mainloop until the condition holds, the timeout only guards against a hang.
+static bool RunMainloopUntil(const std::function<bool(void)> &aCondition)
+{
+    auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (!aCondition())
+    {
+        if (std::chrono::steady_clock::now() >= end)
+        {
+            return false;
+        }
+        RunMainloopOnce();
+    }
+
+    return true;
+}
+
+TEST(Netif, WpanIfDatapathThreadWaitsForBuffers_WhenSendPoolIsExhausted)
+{
+    static constexpr size_t kNumPackets = 4 * otbr::Netif::kMaxIp6SendBatchSize;
+
+    NetifDependencyTestHoldIp6SendBatch netifDependency;
+    const char                         *hello = "Hello Otbr Netif!";
+    otbr::Netif                         netif("wpan0", netifDependency);
+    uint64_t                            failures;
+    uint64_t                            throttles;
+
+    // The datapath thread is throttled once all the buffers are held by the dependency.
+    auto isThrottled = [&netif, &netifDependency, &throttles]() {
+        return netif.GetCounters().mThrottles > throttles &&
+               netifDependency.GetNumHeldPackets() == netif.GetIp6SendPoolCounters().mInUse;
+    };
+
+    netif.SetDatapathThreadEnabled(true);
+    ASSERT_EQ(netif.Init(), OTBR_ERROR_NONE);
+
+    const otIp6Address kOmr = {
+        {0xfd, 0x2a, 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8b}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+    throttles = netif.GetCounters().mThrottles;
+
+    {
+        int                 sockFd;
+        struct sockaddr_in6 destAddr;
+
+        ASSERT_GE(sockFd = socket(AF_INET6, SOCK_DGRAM, 0), 0);
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin6_family = AF_INET6;
+        destAddr.sin6_port   = htons(12345);
+        inet_pton(AF_INET6, "fd2a:c30c:87d3:1:ed1c:c91:ccb6:578a", &(destAddr.sin6_addr));
+
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            ASSERT_GE(sendto(sockFd, hello, strlen(hello), 0, (const struct sockaddr *)&destAddr, sizeof(destAddr)), 0);
+        }
+        close(sockFd);
+    }
+
+    // The dependency holds all the buffers, the remaining packets stay in the TUN.
+    ASSERT_TRUE(RunMainloopUntil(isThrottled));
+    EXPECT_LT(netifDependency.GetNumPackets(), kNumPackets);
+
+    // The datapath thread doesn't read the readable TUN while waiting for buffers.
+    failures = netif.GetIp6SendPoolCounters().mFailures;
+    for (int i = 0; i < 10; i++)
+    {
+        RunMainloopOnce();
+    }
+    EXPECT_EQ(netif.GetIp6SendPoolCounters().mFailures, failures);
+    EXPECT_EQ(netifDependency.GetNumHeldPackets(), netif.GetIp6SendPoolCounters().mInUse);
+
+    // Reading resumes once the buffers are released, until the pool is exhausted again or the TUN is drained.
+    while (netifDependency.GetNumPackets() < kNumPackets)
+    {
+        throttles = netif.GetCounters().mThrottles;
+        netifDependency.ReleasePackets();
+        ASSERT_TRUE(RunMainloopUntil([&netifDependency, &isThrottled]() {
+            return netifDependency.GetNumPackets() == kNumPackets || isThrottled();
+        }));
+    }
+    EXPECT_EQ(netifDependency.GetNumPackets(), kNumPackets);
+
+    // The buffers must return to the pool before it's destroyed.
+    netifDependency.ReleasePackets();
+    netif.Deinit();
+}
+
+TEST(Netif, WpanIfCountsDroppedPackets_AfterReceivingOversizePacket)
+{
+    std::vector<uint8_t> packet(kMaxIp6Size + 1, 0);
+    otbr::Netif          netif("wpan0", sDefaultNetifDependencies);
+
+    ASSERT_EQ(netif.Init(), OTBR_ERROR_NONE);
+
+    netif.Ip6Receive(packet.data(), static_cast<uint16_t>(packet.size()));
+    EXPECT_EQ(netif.GetCounters().mOversizeDrops, 1u);
+    EXPECT_EQ(netif.GetCounters().mFromThread.mPackets, 0u);
+
+    netif.Deinit();
+}
+
 class NetifDependencyTestMulSub : public otbr::Netif::Dependencies
 {
 public:
@@ -0,0 +1,157 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "common/packet_buffer.hpp"
+
+TEST(PacketBuffer, TestAllocateAndRecycle)
+{
+    otbr::PacketBufferPool pool(2, 100, 8);
+    otbr::PacketBuffer     buffer1 = pool.Allocate();
+    otbr::PacketBuffer     buffer2 = pool.Allocate();
+    otbr::PacketBuffer     buffer3 = pool.Allocate();
+    uint8_t               *data1   = buffer1.GetData();
+
+    EXPECT_FALSE(buffer1.IsNull());
+    EXPECT_FALSE(buffer2.IsNull());
+    EXPECT_TRUE(buffer3.IsNull());
+    EXPECT_EQ(buffer3.GetData(), nullptr);
+    EXPECT_EQ(buffer1.GetLength(), 0);
+    EXPECT_EQ(buffer1.GetHeadroom(), 8);
+    EXPECT_EQ(buffer1.GetCapacity(), 100);
+    EXPECT_EQ(pool.GetCounters().mFailures, 1u);
+    EXPECT_EQ(pool.GetCounters().mInUse, 2u);
+
+    buffer1.Reset();
+    EXPECT_TRUE(buffer1.IsNull());
+    EXPECT_EQ(pool.GetCounters().mInUse, 1u);
+
+    // The released buffer is reused instead of creating a new one.
+    buffer3 = pool.Allocate();
+    EXPECT_EQ(buffer3.GetData(), data1);
+    EXPECT_EQ(pool.GetCounters().mCreatedBuffers, 2u);
+    EXPECT_EQ(pool.GetCounters().mAllocations, 3u);
+    EXPECT_EQ(pool.GetCounters().mMaxInUse, 2u);
+}
+
+TEST(PacketBuffer, TestSharedViews)
+{
+    otbr::PacketBufferPool pool(1, 100, 8);
+    otbr::PacketBuffer     buffer = pool.Allocate();
+
+    ASSERT_FALSE(buffer.IsNull());
+    EXPECT_EQ(buffer.GetRefCount(), 1u);
+
+    {
+        otbr::PacketBuffer view = buffer;
+
+        EXPECT_EQ(buffer.GetRefCount(), 2u);
+        EXPECT_EQ(view.GetData(), buffer.GetData());
+
+        buffer.Reset();
+        EXPECT_EQ(view.GetRefCount(), 1u);
+        EXPECT_EQ(pool.GetCounters().mInUse, 1u);
+
+        buffer = std::move(view);
+        EXPECT_TRUE(view.IsNull());
+        EXPECT_EQ(buffer.GetRefCount(), 1u);
+    }
+
+    EXPECT_EQ(pool.GetCounters().mInUse, 1u);
+    buffer.Reset();
+    EXPECT_EQ(pool.GetCounters().mInUse, 0u);
+}
+
+TEST(PacketBuffer, TestPrependInPlace)
+{
+    static const uint8_t kPayload[] = {0x60, 0x00, 0x00, 0x00};
+    static const uint8_t kHeader[]  = {0x81, 0x03, 0x72};
+
+    otbr::PacketBufferPool pool(1, sizeof(kPayload), 4);
+    otbr::PacketBuffer     buffer = pool.Allocate();
+    uint8_t               *data   = buffer.GetData();
+
+    memcpy(data, kPayload, sizeof(kPayload));
+    EXPECT_EQ(buffer.SetLength(sizeof(kPayload)), OTBR_ERROR_NONE);
+    EXPECT_EQ(buffer.SetLength(sizeof(kPayload) + 1), OTBR_ERROR_INVALID_ARGS);
+
+    EXPECT_EQ(buffer.Prepend(kHeader, sizeof(kHeader)), OTBR_ERROR_NONE);
+    EXPECT_EQ(buffer.GetData(), data - sizeof(kHeader));
+    EXPECT_EQ(buffer.GetLength(), sizeof(kHeader) + sizeof(kPayload));
+    EXPECT_EQ(memcmp(buffer.GetData(), kHeader, sizeof(kHeader)), 0);
+    EXPECT_EQ(memcmp(buffer.GetData() + sizeof(kHeader), kPayload, sizeof(kPayload)), 0);
+    EXPECT_EQ(buffer.GetHeadroom(), 1);
+    EXPECT_EQ(buffer.Prepend(kHeader, sizeof(kHeader)), OTBR_ERROR_INVALID_ARGS);
+
+    EXPECT_EQ(buffer.RemoveHeader(sizeof(kHeader)), OTBR_ERROR_NONE);
+    EXPECT_EQ(buffer.GetData(), data);
+    EXPECT_EQ(buffer.GetLength(), sizeof(kPayload));
+    EXPECT_EQ(buffer.RemoveHeader(sizeof(kPayload) + 1), OTBR_ERROR_INVALID_ARGS);
+}
+
+TEST(PacketBuffer, TestReleaseFromOtherThreads)
+{
+    static constexpr size_t kNumBuffers = 64;
+
+    otbr::PacketBufferPool          pool(kNumBuffers, 100, 0);
+    std::vector<otbr::PacketBuffer> buffers;
+    std::vector<std::thread>        threads;
+
+    for (size_t i = 0; i < kNumBuffers; i++)
+    {
+        buffers.push_back(pool.Allocate());
+    }
+    EXPECT_TRUE(pool.Allocate().IsNull());
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&buffers, i]() {
+            for (size_t j = i; j < buffers.size(); j += 4)
+            {
+                otbr::PacketBuffer view = buffers[j];
+
+                view.Reset();
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(pool.GetCounters().mInUse, kNumBuffers);
+    buffers.clear();
+    EXPECT_EQ(pool.GetCounters().mInUse, 0u);
+    EXPECT_FALSE(pool.Allocate().IsNull());
+}
@@ -0,0 +1,247 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <functional>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <sys/select.h>
+
+#include "common/task_runner.hpp"
+#include "host/spinel_command_scheduler.hpp"
+
+using otbr::Clock;
+using otbr::Milliseconds;
+using otbr::Host::SpinelCommandScheduler;
+
+namespace {
+
+struct FailedCommand
+{
+    spinel_command_t  mCmd;
+    spinel_prop_key_t mKey;
+    otError           mError;
+};
+
+class SpinelCommandSchedulerTest : public testing::Test
+{
+protected:
+    SpinelCommandSchedulerTest(void)
+        : mScheduler(
+              mTaskRunner,
+              [this](const uint8_t *aFrame, uint16_t aLength) {
+                  mSentFrames.emplace_back(aFrame, aFrame + aLength);
+                  return OT_ERROR_NONE;
+              },
+              [this](spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError) {
+                  mFailedCommands.push_back({aCmd, aKey, aError});
+              })
+    {
+    }
+
+    // Occupies all the TIDs with commands waiting for a response until `aDeadline`.
+    std::vector<spinel_tid_t> OccupyAllTids(otbr::Timepoint aDeadline)
+    {
+        std::vector<spinel_tid_t> tids;
+        spinel_tid_t              tid;
+
+        while ((tid = mScheduler.AllocateTid()) != 0)
+        {
+            mScheduler.StartTransaction(tid, SPINEL_CMD_PROP_VALUE_GET, SPINEL_PROP_LAST_STATUS, aDeadline);
+            tids.push_back(tid);
+        }
+
+        return tids;
+    }
+
+    // Queues a command whose frame carries @p aMarker after the header.
+    otError Enqueue(uint8_t aMarker, SpinelCommandScheduler::Priority aPriority, otbr::Timepoint aDeadline)
+    {
+        return mScheduler.Enqueue({SPINEL_HEADER_FLAG, aMarker}, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET,
+                                  aPriority, aDeadline);
+    }
+
+    void RunTaskRunnerUntil(const std::function<bool(void)> &aCondition)
+    {
+        for (int i = 0; i < 100 && !aCondition(); i++)
+        {
+            otbr::MainloopContext mainloop;
+
+            mainloop.mMaxFd   = -1;
+            mainloop.mTimeout = {1, 0};
+            FD_ZERO(&mainloop.mReadFdSet);
+            FD_ZERO(&mainloop.mWriteFdSet);
+            FD_ZERO(&mainloop.mErrorFdSet);
+
+            mTaskRunner.Update(mainloop);
+            ASSERT_GE(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                             &mainloop.mTimeout),
+                      0);
+            mTaskRunner.Process(mainloop);
+        }
+    }
+
+    otbr::TaskRunner                  mTaskRunner;
+    SpinelCommandScheduler            mScheduler;
+    std::vector<std::vector<uint8_t>> mSentFrames;
+    std::vector<FailedCommand>        mFailedCommands;
+};
+
+} // namespace
+
+TEST_F(SpinelCommandSchedulerTest, SendsQueuedCommandsByPriority_WhenTidsAreReleased)
+{
+    const otbr::Timepoint     deadline = Clock::now() + Milliseconds(10000);
+    std::vector<spinel_tid_t> tids     = OccupyAllTids(deadline);
+
+    ASSERT_EQ(tids.size(), SpinelCommandScheduler::kMaxTids - 1u);
+
+    EXPECT_EQ(Enqueue(1, SpinelCommandScheduler::Priority::kLow, deadline), OT_ERROR_NONE);
+    EXPECT_EQ(Enqueue(2, SpinelCommandScheduler::Priority::kNormal, deadline), OT_ERROR_NONE);
+    EXPECT_EQ(Enqueue(3, SpinelCommandScheduler::Priority::kHigh, deadline), OT_ERROR_NONE);
+    EXPECT_EQ(Enqueue(4, SpinelCommandScheduler::Priority::kHigh, deadline), OT_ERROR_NONE);
+    EXPECT_EQ(mScheduler.GetCounters().mQueued, 4u);
+    EXPECT_TRUE(mSentFrames.empty());
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        mScheduler.ReleaseTid(tids[i]);
+
+        ASSERT_EQ(mSentFrames.size(), i + 1);
+        // The queued command is sent with the released TID.
+        EXPECT_EQ(SPINEL_HEADER_GET_TID(mSentFrames[i][0]), tids[i]);
+        EXPECT_TRUE(mScheduler.IsWaitingResponse(tids[i]));
+        EXPECT_EQ(mScheduler.GetWaitingKey(tids[i]), SPINEL_PROP_STREAM_NET);
+    }
+
+    EXPECT_EQ(mSentFrames[0][1], 3);
+    EXPECT_EQ(mSentFrames[1][1], 4);
+    EXPECT_EQ(mSentFrames[2][1], 2);
+    EXPECT_EQ(mSentFrames[3][1], 1);
+    EXPECT_EQ(mScheduler.GetCounters().mQueued, 0u);
+    EXPECT_EQ(mScheduler.GetCounters().mQueuedTotal, 4u);
+    EXPECT_EQ(mScheduler.GetCounters().mMaxQueued, 4u);
+    EXPECT_TRUE(mFailedCommands.empty());
+}
+
+TEST_F(SpinelCommandSchedulerTest, RejectsCommand_WhenQueueIsFull)
+{
+    const otbr::Timepoint deadline = Clock::now() + Milliseconds(10000);
+
+    OccupyAllTids(deadline);
+
+    for (uint16_t i = 0; i < SpinelCommandScheduler::kMaxQueuedCommands; i++)
+    {
+        ASSERT_EQ(Enqueue(0, SpinelCommandScheduler::Priority::kNormal, deadline), OT_ERROR_NONE);
+    }
+    EXPECT_EQ(Enqueue(0, SpinelCommandScheduler::Priority::kHigh, deadline), OT_ERROR_BUSY);
+
+    EXPECT_EQ(mScheduler.GetCounters().mQueued, SpinelCommandScheduler::kMaxQueuedCommands);
+    EXPECT_EQ(mScheduler.GetCounters().mMaxQueued, SpinelCommandScheduler::kMaxQueuedCommands);
+    EXPECT_EQ(mScheduler.GetCounters().mOverflows, 1u);
+    EXPECT_EQ(mScheduler.GetCounters().mInFlight, SpinelCommandScheduler::kMaxTids - 1u);
+}
+
+TEST_F(SpinelCommandSchedulerTest, FailsCommands_WhenDeadlinePasses)
+{
+    const otbr::Timepoint deadline = Clock::now() + Milliseconds(10);
+
+    OccupyAllTids(deadline);
+    EXPECT_EQ(Enqueue(0, SpinelCommandScheduler::Priority::kNormal, deadline), OT_ERROR_NONE);
+
+    RunTaskRunnerUntil([this]() { return mFailedCommands.size() == SpinelCommandScheduler::kMaxTids; });
+
+    ASSERT_EQ(mFailedCommands.size(), SpinelCommandScheduler::kMaxTids);
+    for (const FailedCommand &command : mFailedCommands)
+    {
+        EXPECT_EQ(command.mError, OT_ERROR_RESPONSE_TIMEOUT);
+    }
+    EXPECT_EQ(mScheduler.GetCounters().mTimeouts, SpinelCommandScheduler::kMaxTids);
+    EXPECT_EQ(mScheduler.GetCounters().mInFlight, 0u);
+    EXPECT_EQ(mScheduler.GetCounters().mQueued, 0u);
+    EXPECT_TRUE(mSentFrames.empty());
+
+    // The TIDs stay reserved for the late responses.
+    EXPECT_EQ(mScheduler.AllocateTid(), 0);
+}
+
+TEST_F(SpinelCommandSchedulerTest, DropsLateResponse_WhenTidIsReused)
+{
+    const spinel_tid_t timedOutTid = mScheduler.AllocateTid();
+    spinel_tid_t       tid;
+
+    mScheduler.StartTransaction(timedOutTid, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_IF_UP,
+                                Clock::now() + Milliseconds(10));
+    RunTaskRunnerUntil([this]() { return !mFailedCommands.empty(); });
+    ASSERT_EQ(mFailedCommands.size(), 1u);
+    EXPECT_EQ(mFailedCommands[0].mKey, SPINEL_PROP_NET_IF_UP);
+    EXPECT_FALSE(mScheduler.IsWaitingResponse(timedOutTid));
+
+    // All the other TIDs are used by newer commands, the timed out TID is not reused.
+    while ((tid = mScheduler.AllocateTid()) != 0)
+    {
+        EXPECT_NE(tid, timedOutTid);
+        mScheduler.StartTransaction(tid, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET,
+                                    Clock::now() + Milliseconds(10000));
+    }
+    EXPECT_EQ(Enqueue(0, SpinelCommandScheduler::Priority::kNormal, Clock::now() + Milliseconds(10000)),
+              OT_ERROR_NONE);
+
+    // The late response is dropped and releases the TID to the queued command.
+    EXPECT_TRUE(mScheduler.HandleLateResponse(timedOutTid));
+    EXPECT_EQ(mScheduler.GetCounters().mLateResponses, 1u);
+    ASSERT_EQ(mSentFrames.size(), 1u);
+    EXPECT_EQ(SPINEL_HEADER_GET_TID(mSentFrames[0][0]), timedOutTid);
+    EXPECT_TRUE(mScheduler.IsWaitingResponse(timedOutTid));
+    EXPECT_EQ(mScheduler.GetWaitingKey(timedOutTid), SPINEL_PROP_STREAM_NET);
+
+    // A second response for the TID belongs to the queued command.
+    EXPECT_FALSE(mScheduler.HandleLateResponse(timedOutTid));
+    EXPECT_EQ(mFailedCommands.size(), 1u);
+}
+
+TEST_F(SpinelCommandSchedulerTest, FailsAllCommands_WhenAborted)
+{
+    const otbr::Timepoint deadline = Clock::now() + Milliseconds(10000);
+
+    OccupyAllTids(deadline);
+    EXPECT_EQ(Enqueue(0, SpinelCommandScheduler::Priority::kHigh, deadline), OT_ERROR_NONE);
+    EXPECT_EQ(Enqueue(0, SpinelCommandScheduler::Priority::kLow, deadline), OT_ERROR_NONE);
+
+    mScheduler.Abort(OT_ERROR_ABORT);
+
+    ASSERT_EQ(mFailedCommands.size(), SpinelCommandScheduler::kMaxTids + 1u);
+    for (const FailedCommand &command : mFailedCommands)
+    {
+        EXPECT_EQ(command.mError, OT_ERROR_ABORT);
+    }
+    EXPECT_EQ(mScheduler.GetCounters().mInFlight, 0u);
+    EXPECT_EQ(mScheduler.GetCounters().mQueued, 0u);
+    EXPECT_TRUE(mSentFrames.empty());
+    EXPECT_NE(mScheduler.AllocateTid(), 0);
+}
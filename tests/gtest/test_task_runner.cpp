@@ -27,6 +27,7 @@
  */
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -306,6 +307,20 @@ TEST(TaskRunner, TestCancelDelayedTasks)
     t.join();
 }
 
+TEST(TaskRunner, TestCancelReleasesTask)
+{
+    otbr::TaskRunner         taskRunner;
+    std::shared_ptr<int>     state = std::make_shared<int>(0);
+    otbr::TaskRunner::TaskId tid;
+
+    tid = taskRunner.Post(std::chrono::hours(1), [state]() { ++*state; });
+    EXPECT_EQ(state.use_count(), 2);
+
+    // The captured state is released without waiting for the deadline.
+    taskRunner.Cancel(tid);
+    EXPECT_EQ(state.use_count(), 1);
+}
+
 TEST(TaskRunner, TestAllAPIs)
 {
     std::atomic<int>         counter{0};
@@ -347,3 +362,112 @@ TEST(TaskRunner, TestAllAPIs)
 
     EXPECT_EQ(30, counter.load());
 }
+
+TEST(TaskRunner, TestPriorityLanes)
+{
+    std::string           str;
+    otbr::TaskRunner      taskRunner;
+    otbr::MainloopContext mainloop;
+
+    taskRunner.Post(otbr::TaskRunner::Priority::kLow, [&]() { str.push_back('a'); });
+    taskRunner.Post([&]() { str.push_back('b'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kHigh, [&]() { str.push_back('c'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kHigh, [&]() { str.push_back('d'); });
+
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kHigh).mQueueDepth, 2u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kNormal).mQueueDepth, 1u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kLow).mQueueDepth, 1u);
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    taskRunner.Update(mainloop);
+    EXPECT_EQ(1, select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                        &mainloop.mTimeout));
+    taskRunner.Process(mainloop);
+
+    // Higher priority tasks run first, tasks in the same lane keep their order.
+    EXPECT_EQ(str, "cdba");
+
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kHigh).mQueueDepth, 0u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kHigh).mMaxQueueDepth, 2u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kHigh).mTasksRun, 2u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kLow).mQueueDepth, 0u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kLow).mTasksRun, 1u);
+}
+
+TEST(TaskRunner, TestLaneStarvationBound)
+{
+    std::string           str;
+    otbr::TaskRunner      taskRunner;
+    otbr::MainloopContext mainloop;
+    std::string           expected;
+
+    taskRunner.Post(otbr::TaskRunner::Priority::kLow, [&]() { str.push_back('l'); });
+
+    for (int i = 0; i < 20; i++)
+    {
+        taskRunner.Post(otbr::TaskRunner::Priority::kHigh, [&]() { str.push_back('h'); });
+    }
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    taskRunner.Update(mainloop);
+    EXPECT_EQ(1, select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                        &mainloop.mTimeout));
+    taskRunner.Process(mainloop);
+
+    // The low priority task is bypassed at most `kMaxBypassCount` times.
+    expected = std::string(otbr::TaskRunner::kMaxBypassCount, 'h') + "l" +
+               std::string(20 - otbr::TaskRunner::kMaxBypassCount, 'h');
+    EXPECT_EQ(str, expected);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kLow).mPromotions, 1u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kHigh).mPromotions, 0u);
+}
+
+TEST(TaskRunner, TestExpiredDelayedTasksCountInNormalLane)
+{
+    std::string           str;
+    otbr::TaskRunner      taskRunner;
+    otbr::MainloopContext mainloop;
+    std::string           expected;
+
+    taskRunner.Post(std::chrono::milliseconds(0), [&]() { str.push_back('d'); });
+
+    for (int i = 0; i < 20; i++)
+    {
+        taskRunner.Post(otbr::TaskRunner::Priority::kHigh, [&]() { str.push_back('h'); });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    taskRunner.Update(mainloop);
+    EXPECT_EQ(1, select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                        &mainloop.mTimeout));
+    taskRunner.Process(mainloop);
+
+    // The expired delayed task waits in the normal lane, which is bypassed at most `kMaxBypassCount` times.
+    expected = std::string(otbr::TaskRunner::kMaxBypassCount, 'h') + "d" +
+               std::string(20 - otbr::TaskRunner::kMaxBypassCount, 'h');
+    EXPECT_EQ(str, expected);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kNormal).mQueueDepth, 0u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kNormal).mMaxQueueDepth, 1u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kNormal).mTasksRun, 1u);
+    EXPECT_EQ(taskRunner.GetLaneStats(otbr::TaskRunner::Priority::kNormal).mPromotions, 1u);
+}
@@ -0,0 +1,160 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/timer_wheel.hpp"
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::TimerWheel;
+
+namespace {
+
+void RunExpired(TimerWheel &aWheel, Timepoint aNow)
+{
+    TimerWheel::Handler handler;
+
+    while (aWheel.PopExpired(aNow, handler))
+    {
+        handler();
+    }
+}
+
+} // namespace
+
+TEST(TimerWheel, TestExpireInOrder)
+{
+    Timepoint   epoch = otbr::Clock::now();
+    TimerWheel  wheel(epoch);
+    std::string str;
+    Timepoint   next;
+
+    EXPECT_FALSE(wheel.GetNextServiceTime(next));
+
+    wheel.Add(1, epoch + Milliseconds(10), [&str]() { str.push_back('a'); });
+    wheel.Add(2, epoch + Milliseconds(9), [&str]() { str.push_back('b'); });
+    wheel.Add(3, epoch + Milliseconds(10), [&str]() { str.push_back('c'); });
+    EXPECT_EQ(wheel.GetSize(), 3u);
+
+    EXPECT_TRUE(wheel.GetNextServiceTime(next));
+    EXPECT_EQ(next, epoch + Milliseconds(9));
+
+    RunExpired(wheel, epoch + Milliseconds(8));
+    EXPECT_EQ(str, "");
+
+    RunExpired(wheel, epoch + Milliseconds(9));
+    EXPECT_EQ(str, "b");
+
+    EXPECT_TRUE(wheel.GetNextServiceTime(next));
+    EXPECT_EQ(next, epoch + Milliseconds(10));
+
+    RunExpired(wheel, epoch + Milliseconds(100));
+    EXPECT_EQ(str, "bac");
+    EXPECT_EQ(wheel.GetSize(), 0u);
+    EXPECT_FALSE(wheel.GetNextServiceTime(next));
+}
+
+TEST(TimerWheel, TestNeverExpireEarly)
+{
+    Timepoint  epoch = otbr::Clock::now();
+    TimerWheel wheel(epoch);
+    bool       fired = false;
+
+    wheel.Add(1, epoch + std::chrono::microseconds(1500), [&fired]() { fired = true; });
+
+    RunExpired(wheel, epoch + std::chrono::microseconds(1999));
+    EXPECT_FALSE(fired);
+
+    RunExpired(wheel, epoch + Milliseconds(2));
+    EXPECT_TRUE(fired);
+}
+
+TEST(TimerWheel, TestRemoveReleasesHandler)
+{
+    Timepoint            epoch = otbr::Clock::now();
+    TimerWheel           wheel(epoch);
+    std::shared_ptr<int> state = std::make_shared<int>(0);
+
+    wheel.Add(1, epoch + Milliseconds(100000), [state]() { ++*state; });
+    EXPECT_EQ(state.use_count(), 2);
+
+    EXPECT_TRUE(wheel.Remove(1));
+    EXPECT_EQ(state.use_count(), 1);
+    EXPECT_EQ(wheel.GetSize(), 0u);
+    EXPECT_FALSE(wheel.Remove(1));
+}
+
+TEST(TimerWheel, TestRandomDeadlines)
+{
+    Timepoint                        epoch = otbr::Clock::now();
+    TimerWheel                       wheel(epoch);
+    std::mt19937_64                  random(0);
+    std::vector<uint64_t>            deadlines;
+    std::vector<uint64_t>            expired;
+    std::vector<TimerWheel::TimerId> removed;
+    uint64_t                         now = 0;
+
+    // Spans all the levels of the wheel plus the overflow list.
+    for (TimerWheel::TimerId id = 0; id < 2000; id++)
+    {
+        uint64_t deadline = random() % (1ull << (8 + 6 * (id % 5)));
+
+        deadlines.push_back(deadline);
+        wheel.Add(id, epoch + Milliseconds(deadline), [&expired, &deadlines, &now, id]() {
+            EXPECT_LE(deadlines[id], now);
+            expired.push_back(deadlines[id]);
+        });
+    }
+
+    for (TimerWheel::TimerId id = 0; id < 2000; id += 7)
+    {
+        EXPECT_TRUE(wheel.Remove(id));
+        removed.push_back(id);
+    }
+
+    while (wheel.GetSize() > 0)
+    {
+        Timepoint next;
+
+        ASSERT_TRUE(wheel.GetNextServiceTime(next));
+        ASSERT_GE(next, epoch + Milliseconds(now));
+
+        now = std::chrono::duration_cast<Milliseconds>(next - epoch).count();
+        RunExpired(wheel, next);
+    }
+
+    EXPECT_EQ(expired.size(), deadlines.size() - removed.size());
+    EXPECT_TRUE(std::is_sorted(expired.begin(), expired.end()));
+}
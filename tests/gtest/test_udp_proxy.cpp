@@ -33,46 +33,54 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <vector>
+
 #include "common/mainloop_manager.hpp"
 #include "common/types.hpp"
 #include "host/posix/udp_proxy.hpp"
 
-static constexpr size_t   kMaxUdpSize       = 1280;
-static constexpr uint16_t kTestThreadBaPort = 49191;
-const std::string         kHello            = "Hello UdpProxy!";
+static constexpr size_t   kMaxUdpSize          = 1280;
+static constexpr uint16_t kTestThreadBaPort    = 49191;
+static constexpr uint16_t kTestThreadEpskcPort = 49192;
+const std::string         kHello               = "Hello UdpProxy!";
 
 class UdpProxyTest : public otbr::UdpProxy::Dependencies
 {
 public:
     UdpProxyTest(void)
         : mForwarded(false)
+        , mForwardedCount(0)
     {
     }
 
-    otbrError UdpForward(const uint8_t        *aUdpPayload,
-                         uint16_t              aLength,
-                         const otIp6Address   &aRemoteAddr,
-                         uint16_t              aRemotePort,
-                         const otbr::UdpProxy &aUdpProxy) override
+    otbrError UdpForward(const uint8_t      *aUdpPayload,
+                         uint16_t            aLength,
+                         const otIp6Address &aRemoteAddr,
+                         uint16_t            aRemotePort,
+                         uint16_t            aThreadPort) override
     {
         mForwarded = true;
+        mForwardedCount++;
+        mForwardedPorts.push_back(aThreadPort);
         assert(aLength < kMaxUdpSize);
 
         memcpy(mPayload, aUdpPayload, aLength);
         mLength = aLength;
         memcpy(mRemoteAddress.mFields.m8, aRemoteAddr.mFields.m8, sizeof(mRemoteAddress));
         mRemotePort = aRemotePort;
-        mLocalPort  = aUdpProxy.GetThreadPort();
+        mLocalPort  = aThreadPort;
 
         return OTBR_ERROR_NONE;
     }
 
-    bool         mForwarded;
-    uint8_t      mPayload[kMaxUdpSize];
-    uint16_t     mLength;
-    otIp6Address mRemoteAddress;
-    uint16_t     mRemotePort;
-    uint16_t     mLocalPort;
+    bool                  mForwarded;
+    size_t                mForwardedCount;
+    std::vector<uint16_t> mForwardedPorts;
+    uint8_t               mPayload[kMaxUdpSize];
+    uint16_t              mLength;
+    otIp6Address          mRemoteAddress;
+    uint16_t              mRemotePort;
+    uint16_t              mLocalPort;
 };
 
 TEST(UdpProxy, UdpProxyForwardCorrectlyWhenActive)
@@ -81,7 +89,7 @@ TEST(UdpProxy, UdpProxyForwardCorrectlyWhenActive)
     otbr::UdpProxy udpProxy(tester);
 
     udpProxy.Start(kTestThreadBaPort);
-    EXPECT_NE(udpProxy.GetHostPort(), 0);
+    EXPECT_NE(udpProxy.GetHostPort(kTestThreadBaPort), 0);
 
     // Send a UDP packet destined to loopback address.
     {
@@ -96,7 +104,7 @@ TEST(UdpProxy, UdpProxyForwardCorrectlyWhenActive)
 
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family      = AF_INET;
-        destAddr.sin_port        = htons(udpProxy.GetHostPort());
+        destAddr.sin_port        = htons(udpProxy.GetHostPort(kTestThreadBaPort));
         destAddr.sin_addr.s_addr = inet_addr("127.0.0.1"); // Loopback address
 
         if (sendto(sockFd, kHello.c_str(), kHello.size(), 0, (const struct sockaddr *)&destAddr, sizeof(destAddr)) < 0)
@@ -168,7 +176,8 @@ TEST(UdpProxy, UdpProxySendToPeerCorrectlyWhenActive)
     // Send a UDP packet through UDP Proxy
     otIp6Address peerAddress = {
         {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x01}};
-    udpProxy.SendToPeer(reinterpret_cast<const uint8_t *>(kHello.c_str()), kHello.size(), peerAddress, port);
+    udpProxy.SendToPeer(reinterpret_cast<const uint8_t *>(kHello.c_str()), kHello.size(), peerAddress, port,
+                        kTestThreadBaPort);
 
     // Receive the UDP packet
     socklen_t   len = sizeof(listenAddr);
@@ -180,3 +189,275 @@ TEST(UdpProxy, UdpProxySendToPeerCorrectlyWhenActive)
 
     udpProxy.Stop();
 }
+
+TEST(UdpProxy, UdpProxyForwardsBurstInBatchesWhenActive)
+{
+    constexpr size_t kNumPackets = otbr::UdpProxy::kMaxBatchSize + 4;
+
+    UdpProxyTest   tester;
+    otbr::UdpProxy udpProxy(tester);
+    size_t         batchedPackets = 0;
+
+    udpProxy.Start(kTestThreadBaPort);
+    EXPECT_NE(udpProxy.GetHostPort(kTestThreadBaPort), 0);
+
+    // Send a burst of UDP packets destined to loopback address before the proxy gets a chance to read them.
+    {
+        int                sockFd;
+        struct sockaddr_in destAddr;
+
+        if ((sockFd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+        {
+            perror("socket creation failed");
+            exit(EXIT_FAILURE);
+        }
+
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin_family      = AF_INET;
+        destAddr.sin_port        = htons(udpProxy.GetHostPort(kTestThreadBaPort));
+        destAddr.sin_addr.s_addr = inet_addr("127.0.0.1"); // Loopback address
+
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            if (sendto(sockFd, kHello.c_str(), kHello.size(), 0, (const struct sockaddr *)&destAddr,
+                       sizeof(destAddr)) < 0)
+            {
+                perror("Failed to send UDP packet through loopback interface");
+                exit(EXIT_FAILURE);
+            }
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    while (tester.mForwardedCount < kNumPackets)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {100, 0};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+
+    const otbr::UdpProxy::Counters &counters = *udpProxy.GetCounters(kTestThreadBaPort);
+
+    for (size_t i = 0; i < otbr::UdpProxy::kMaxBatchSize; i++)
+    {
+        batchedPackets += (i + 1) * counters.mRxBatchSizes[i];
+    }
+    EXPECT_EQ(counters.mRxPackets, kNumPackets);
+    EXPECT_EQ(batchedPackets, kNumPackets);
+    EXPECT_EQ(counters.mRxBatchSizes[otbr::UdpProxy::kMaxBatchSize - 1], 1);
+    EXPECT_EQ(counters.mForwardFailures, 0);
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(tester.mPayload), tester.mLength), kHello);
+
+    udpProxy.Stop();
+}
+
+TEST(UdpProxy, UdpProxySendsAllPacketsToPeerWhenActive)
+{
+    constexpr size_t kNumPackets = otbr::UdpProxy::kMaxBatchSize + 4;
+
+    UdpProxyTest   tester;
+    otbr::UdpProxy udpProxy(tester);
+
+    udpProxy.Start(kTestThreadBaPort);
+
+    // Receive UDP packets on loopback address with specified port
+    int                sockFd;
+    const uint16_t     port = 12346;
+    struct sockaddr_in listenAddr;
+    uint8_t            recvBuf[kMaxUdpSize];
+
+    if ((sockFd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+    {
+        perror("socket creation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    memset(&listenAddr, 0, sizeof(listenAddr));
+    listenAddr.sin_family      = AF_INET;
+    listenAddr.sin_port        = htons(port);
+    listenAddr.sin_addr.s_addr = inet_addr("127.0.0.1"); // Loopback address
+
+    if (bind(sockFd, (const struct sockaddr *)&listenAddr, sizeof(listenAddr)) < 0)
+    {
+        perror("bind failed");
+        exit(EXIT_FAILURE);
+    }
+
+    // Send UDP packets through UDP Proxy
+    otIp6Address peerAddress = {
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x01}};
+    for (size_t i = 0; i < kNumPackets; i++)
+    {
+        udpProxy.SendToPeer(reinterpret_cast<const uint8_t *>(kHello.c_str()), kHello.size(), peerAddress, port,
+                        kTestThreadBaPort);
+    }
+
+    // Receive the UDP packets
+    for (size_t i = 0; i < kNumPackets; i++)
+    {
+        int         n = recv(sockFd, (char *)recvBuf, kMaxUdpSize, 0);
+        std::string udpPayload(reinterpret_cast<const char *>(recvBuf), n);
+
+        EXPECT_EQ(udpPayload, kHello);
+    }
+
+    EXPECT_EQ(udpProxy.GetCounters(kTestThreadBaPort)->mTxPackets, kNumPackets);
+    EXPECT_EQ(udpProxy.GetCounters(kTestThreadBaPort)->mTxDrops, 0);
+
+    close(sockFd);
+
+    udpProxy.Stop();
+}
+
+TEST(UdpProxy, UdpProxyForwardsEachPortSeparatelyWhenProxyingMultiplePorts)
+{
+    UdpProxyTest   tester;
+    otbr::UdpProxy udpProxy(tester);
+
+    EXPECT_EQ(udpProxy.Start(kTestThreadBaPort), OTBR_ERROR_NONE);
+    EXPECT_EQ(udpProxy.Start(kTestThreadEpskcPort), OTBR_ERROR_NONE);
+    EXPECT_NE(udpProxy.GetHostPort(kTestThreadBaPort), 0);
+    EXPECT_NE(udpProxy.GetHostPort(kTestThreadEpskcPort), 0);
+    EXPECT_NE(udpProxy.GetHostPort(kTestThreadBaPort), udpProxy.GetHostPort(kTestThreadEpskcPort));
+
+    // Send a UDP packet to each of the host ports.
+    {
+        int                sockFd;
+        struct sockaddr_in destAddr;
+
+        if ((sockFd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+        {
+            perror("socket creation failed");
+            exit(EXIT_FAILURE);
+        }
+
+        for (uint16_t threadPort : {kTestThreadBaPort, kTestThreadEpskcPort})
+        {
+            memset(&destAddr, 0, sizeof(destAddr));
+            destAddr.sin_family      = AF_INET;
+            destAddr.sin_port        = htons(udpProxy.GetHostPort(threadPort));
+            destAddr.sin_addr.s_addr = inet_addr("127.0.0.1"); // Loopback address
+
+            if (sendto(sockFd, kHello.c_str(), kHello.size(), 0, (const struct sockaddr *)&destAddr,
+                       sizeof(destAddr)) < 0)
+            {
+                perror("Failed to send UDP packet through loopback interface");
+                exit(EXIT_FAILURE);
+            }
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    while (tester.mForwardedCount < 2)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {100, 0};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+
+    EXPECT_THAT(tester.mForwardedPorts, ::testing::UnorderedElementsAre(kTestThreadBaPort, kTestThreadEpskcPort));
+    EXPECT_EQ(udpProxy.GetCounters(kTestThreadBaPort)->mRxPackets, 1);
+    EXPECT_EQ(udpProxy.GetCounters(kTestThreadEpskcPort)->mRxPackets, 1);
+
+    udpProxy.Stop(kTestThreadEpskcPort);
+    EXPECT_EQ(udpProxy.GetHostPort(kTestThreadEpskcPort), 0);
+    EXPECT_EQ(udpProxy.GetCounters(kTestThreadEpskcPort), nullptr);
+    EXPECT_NE(udpProxy.GetHostPort(kTestThreadBaPort), 0);
+
+    udpProxy.Stop();
+    EXPECT_EQ(udpProxy.GetHostPort(kTestThreadBaPort), 0);
+}
+
+TEST(UdpProxy, UdpProxyKeepsSharedPortUntilLastStop)
+{
+    UdpProxyTest   tester;
+    otbr::UdpProxy udpProxy(tester);
+    uint16_t       hostPort;
+
+    // The Border Agent and an ePSKc session proxy the same Thread port.
+    EXPECT_EQ(udpProxy.Start(kTestThreadBaPort), OTBR_ERROR_NONE);
+    hostPort = udpProxy.GetHostPort(kTestThreadBaPort);
+    EXPECT_NE(hostPort, 0);
+    EXPECT_EQ(udpProxy.Start(kTestThreadBaPort), OTBR_ERROR_NONE);
+    EXPECT_EQ(udpProxy.GetHostPort(kTestThreadBaPort), hostPort);
+
+    // Stopping the ePSKc session must not close the socket of the Border Agent.
+    udpProxy.Stop(kTestThreadBaPort);
+    EXPECT_EQ(udpProxy.GetHostPort(kTestThreadBaPort), hostPort);
+
+    {
+        int                sockFd;
+        struct sockaddr_in destAddr;
+
+        if ((sockFd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+        {
+            perror("socket creation failed");
+            exit(EXIT_FAILURE);
+        }
+
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin_family      = AF_INET;
+        destAddr.sin_port        = htons(hostPort);
+        destAddr.sin_addr.s_addr = inet_addr("127.0.0.1"); // Loopback address
+
+        if (sendto(sockFd, kHello.c_str(), kHello.size(), 0, (const struct sockaddr *)&destAddr, sizeof(destAddr)) < 0)
+        {
+            perror("Failed to send UDP packet through loopback interface");
+            exit(EXIT_FAILURE);
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    while (!tester.mForwarded)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {100, 0};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+
+    EXPECT_EQ(tester.mLocalPort, kTestThreadBaPort);
+    EXPECT_EQ(tester.mLength, kHello.size());
+
+    udpProxy.Stop(kTestThreadBaPort);
+    EXPECT_EQ(udpProxy.GetHostPort(kTestThreadBaPort), 0);
+    EXPECT_EQ(udpProxy.GetCounters(kTestThreadBaPort), nullptr);
+}
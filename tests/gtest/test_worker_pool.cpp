@@ -0,0 +1,186 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/task_runner.hpp"
+#include "common/worker_pool.hpp"
+
+namespace {
+
+void RunMainloopOnce(otbr::TaskRunner &aTaskRunner)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {1, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+           &mainloop.mTimeout);
+    aTaskRunner.Process(mainloop);
+}
+
+} // namespace
+
+TEST(WorkerPool, TestCompletionRunsOnMainloop)
+{
+    otbr::TaskRunner taskRunner;
+    otbr::WorkerPool workerPool(taskRunner);
+    std::thread::id  mainloopThread = std::this_thread::get_id();
+    std::thread::id  jobThread;
+    std::thread::id  completionThread;
+    std::string      result;
+
+    EXPECT_EQ(workerPool.Post<std::string>(
+                  [&jobThread]() {
+                      jobThread = std::this_thread::get_id();
+                      return std::string("done");
+                  },
+                  [&](otbrError aError, std::string aResult) {
+                      EXPECT_EQ(aError, OTBR_ERROR_NONE);
+                      completionThread = std::this_thread::get_id();
+                      result           = std::move(aResult);
+                  }),
+              OTBR_ERROR_NONE);
+
+    for (int i = 0; i < 10 && result.empty(); i++)
+    {
+        RunMainloopOnce(taskRunner);
+    }
+
+    EXPECT_EQ(result, "done");
+    EXPECT_NE(jobThread, mainloopThread);
+    EXPECT_EQ(completionThread, mainloopThread);
+}
+
+TEST(WorkerPool, TestVoidJob)
+{
+    otbr::TaskRunner taskRunner;
+    otbr::WorkerPool workerPool(taskRunner, 1);
+    std::atomic_int  counter(0);
+    bool             completed = false;
+
+    EXPECT_EQ(workerPool.Post([&counter]() { ++counter; }, [&completed](otbrError) { completed = true; }),
+              OTBR_ERROR_NONE);
+
+    for (int i = 0; i < 10 && !completed; i++)
+    {
+        RunMainloopOnce(taskRunner);
+    }
+
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(counter, 1);
+}
+
+TEST(WorkerPool, TestBoundedQueue)
+{
+    otbr::TaskRunner         taskRunner;
+    otbr::WorkerPool         workerPool(taskRunner, 1, 2);
+    std::promise<void>       started;
+    std::promise<void>       release;
+    std::shared_future<void> releaseFuture = release.get_future().share();
+
+    // Occupy the only worker so that the following jobs stay in the queue.
+    EXPECT_EQ(workerPool.Post(
+                  [&started, releaseFuture]() {
+                      started.set_value();
+                      releaseFuture.wait();
+                  },
+                  nullptr),
+              OTBR_ERROR_NONE);
+    started.get_future().wait();
+
+    EXPECT_EQ(workerPool.Post([]() {}, nullptr), OTBR_ERROR_NONE);
+    EXPECT_EQ(workerPool.Post([]() {}, nullptr), OTBR_ERROR_NONE);
+    EXPECT_EQ(workerPool.GetPendingJobCount(), 2u);
+    EXPECT_EQ(workerPool.Post([]() {}, nullptr), OTBR_ERROR_BUSY);
+
+    release.set_value();
+}
+
+TEST(WorkerPool, TestPendingJobsAbortedOnDestruction)
+{
+    otbr::TaskRunner         taskRunner;
+    std::promise<void>       started;
+    std::promise<void>       release;
+    std::shared_future<void> releaseFuture = release.get_future().share();
+    std::vector<otbrError>   errors;
+    bool                     jobRun = false;
+    std::thread              releaser;
+
+    {
+        otbr::WorkerPool workerPool(taskRunner, 1);
+
+        // Occupy the only worker so that the following jobs stay in the queue.
+        EXPECT_EQ(workerPool.Post(
+                      [&started, releaseFuture]() {
+                          started.set_value();
+                          releaseFuture.wait();
+                      },
+                      nullptr),
+                  OTBR_ERROR_NONE);
+        started.get_future().wait();
+
+        EXPECT_EQ(workerPool.Post<int>(
+                      [&jobRun]() {
+                          jobRun = true;
+                          return 1;
+                      },
+                      [&errors](otbrError aError, int aResult) {
+                          EXPECT_EQ(aResult, 0);
+                          errors.push_back(aError);
+                      }),
+                  OTBR_ERROR_NONE);
+        EXPECT_EQ(workerPool.Post([]() {}, [&errors](otbrError aError) { errors.push_back(aError); }),
+                  OTBR_ERROR_NONE);
+
+        // Releases the worker only after the destructor takes the pending jobs.
+        releaser = std::thread([&workerPool, &release]() {
+            while (workerPool.GetPendingJobCount() != 0)
+            {
+                std::this_thread::yield();
+            }
+            release.set_value();
+        });
+    }
+
+    releaser.join();
+    EXPECT_FALSE(jobRun);
+    EXPECT_EQ(errors, std::vector<otbrError>({OTBR_ERROR_ABORTED, OTBR_ERROR_ABORTED}));
+}
@@ -315,6 +315,32 @@ def node_coprocessor_version_check(data):
     return True
 
 
+def node_mainloop_stats_check(data):
+    assert data is not None
+
+    assert (type(data) == list)
+    assert len(data) > 0
+
+    for stats in data:
+        assert (type(stats["name"]) == str)
+        assert stats["iterations"] > 0
+        assert len(stats["processTimeHistogram"]) == 20
+        assert sum(stats["processTimeHistogram"]) == stats["iterations"]
+
+    return True
+
+
+def node_flight_recorder_check(data):
+    assert data is not None
+
+    assert (type(data) == list)
+
+    for record in data:
+        assert (type(record) == str)
+
+    return True
+
+
 def node_test(thread_num):
     url = rest_api_addr + "/node"
 
@@ -511,6 +537,30 @@ def node_coprocessor_version_test(thread_num):
     print(" /node/coprocessor/version : all {}, valid {} ".format(thread_num, valid))
 
 
+def node_mainloop_stats_test(thread_num):
+    url = rest_api_addr + "/node/mainloop-stats"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [node_mainloop_stats_check(data) for data in response_data].count(True)
+
+    print(" /node/mainloop-stats : all {}, valid {} ".format(thread_num, valid))
+
+
+def node_flight_recorder_test(thread_num):
+    url = rest_api_addr + "/node/flight-recorder"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [node_flight_recorder_check(data) for data in response_data].count(True)
+
+    print(" /node/flight-recorder : all {}, valid {} ".format(thread_num, valid))
+
+
 def diagnostics_test(thread_num):
     url = rest_api_addr + "/diagnostics"
 
@@ -728,6 +778,8 @@ def main():
     node_num_of_router_test(200)
     node_ext_panid_test(200)
     node_coprocessor_version_test(200)
+    node_mainloop_stats_test(20)
+    node_flight_recorder_test(20)
     # diagnostics_test(20)  # partly replaced with restjsonapi tests
     error_test(10)
     well_known_thread_test(20)